@@ -581,6 +581,11 @@ private:
     static PyObject *sSetLogLevel       (PyObject *self,PyObject *args);
     static PyObject *sGetLogLevel       (PyObject *self,PyObject *args);
 
+    static PyObject *sStartProfiler     (PyObject *self,PyObject *args);
+    static PyObject *sStopProfiler      (PyObject *self,PyObject *args);
+    static PyObject *sGetProfile        (PyObject *self,PyObject *args);
+    static PyObject *sDumpProfile       (PyObject *self,PyObject *args);
+
     static PyObject *sCheckLinkDepth    (PyObject *self,PyObject *args);
     static PyObject *sGetLinksTo        (PyObject *self,PyObject *args);
 
@@ -29,8 +29,10 @@
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Sequencer.h>
+#include <Base/Stream.h>
 
 #include "Application.h"
 #include "DocumentPy.h"
@@ -213,6 +215,27 @@ PyMethodDef Application::Methods[] = {
      (PyCFunction)Application::sGetLogLevel,
      METH_VARARGS,
      "getLogLevel(tag) -- Get the log level of a string tag"},
+    {"startProfiler",
+     (PyCFunction)Application::sStartProfiler,
+     METH_VARARGS,
+     "startProfiler(clear=True) -- start recording the built-in profiler zones\n\n"
+     "clear: discard the events recorded so far"},
+    {"stopProfiler",
+     (PyCFunction)Application::sStopProfiler,
+     METH_VARARGS,
+     "stopProfiler() -- stop recording the built-in profiler zones"},
+    {"getProfile",
+     (PyCFunction)Application::sGetProfile,
+     METH_VARARGS,
+     "getProfile() -> list\n\n"
+     "Return the recorded profiler zones as a list of tuples\n"
+     "(name, detail, start, duration, thread, depth), with times in seconds"},
+    {"dumpProfile",
+     (PyCFunction)Application::sDumpProfile,
+     METH_VARARGS,
+     "dumpProfile(filename) -- write the recorded profiler zones to a file\n\n"
+     "The file uses the Chrome trace event format, which can be opened with\n"
+     "chrome://tracing or https://ui.perfetto.dev"},
     {"checkLinkDepth",
      (PyCFunction)Application::sCheckLinkDepth,
      METH_VARARGS,
@@ -1034,6 +1057,80 @@ PyObject* Application::sGetLogLevel(PyObject* /*self*/, PyObject* args)
     PY_CATCH;
 }
 
+PyObject* Application::sStartProfiler(PyObject* /*self*/, PyObject* args)
+{
+    PyObject* clear = Py_True;
+    if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &clear)) {
+        return nullptr;
+    }
+
+    if (Base::asBoolean(clear)) {
+        Base::Profiler::clear();
+    }
+    Base::Profiler::setEnabled(true);
+    Py_Return;
+}
+
+PyObject* Application::sStopProfiler(PyObject* /*self*/, PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    Base::Profiler::setEnabled(false);
+    Py_Return;
+}
+
+PyObject* Application::sGetProfile(PyObject* /*self*/, PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        constexpr double nsPerSecond {1e9};
+        auto events = Base::Profiler::getEvents();
+        Py::List list(static_cast<int>(events.size()));
+        int index = 0;
+        for (auto& event : events) {
+            Py::Tuple tuple(6);
+            tuple.setItem(0, Py::String(event.name));
+            tuple.setItem(1, Py::String(event.detail));
+            tuple.setItem(2, Py::Float(static_cast<double>(event.start) / nsPerSecond));
+            tuple.setItem(3, Py::Float(static_cast<double>(event.duration) / nsPerSecond));
+            tuple.setItem(4, Py::Long(event.thread));
+            tuple.setItem(5, Py::Long(event.depth));
+            list.setItem(index++, tuple);
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
+PyObject* Application::sDumpProfile(PyObject* /*self*/, PyObject* args)
+{
+    char* fileName;
+    if (!PyArg_ParseTuple(args, "et", "utf-8", &fileName)) {
+        return nullptr;
+    }
+    std::string utf8Name = fileName;
+    PyMem_Free(fileName);
+
+    PY_TRY
+    {
+        Base::FileInfo fi(utf8Name);
+        Base::ofstream str(fi, std::ios::out | std::ios::binary);
+        if (!str) {
+            PyErr_Format(PyExc_IOError, "Cannot open file %s", utf8Name.c_str());
+            return nullptr;
+        }
+        Base::Profiler::writeChromeTrace(str);
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
 PyObject* Application::sCheckLinkDepth(PyObject* /*self*/, PyObject* args)
 {
     short depth = 0;
@@ -637,8 +637,14 @@ void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
 {
     flushElementMap();
     if (_elementMap) {
-        writer.Stream() << "BeginElementMap v1\n";
-        _elementMap->save(writer.Stream());
+        if (writer.getMode("BinaryElementMap")) {
+            writer.Stream() << "BeginElementMap v2\n";
+            _elementMap->saveBinary(writer.Stream());
+        }
+        else {
+            writer.Stream() << "BeginElementMap v1\n";
+            _elementMap->save(writer.Stream());
+        }
     }
 }
 
@@ -650,6 +656,13 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     if (boost::equals(marker, "BeginElementMap")) {
         resetElementMap();
         reader >> ver;
+        if (ver == "v2") {
+            // skip the line break ending the marker
+            reader.get();
+            resetElementMap(std::make_shared<ElementMap>());
+            _elementMap = _elementMap->restoreBinary(Hasher, reader);
+            return;
+        }
         if (ver != "v1") {
             FC_WARN("Unknown element map format");  // NOLINT
         }
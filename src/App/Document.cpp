@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <cstdio>
 #include <bitset>
 #include <stack>
 #include <boost/filesystem.hpp>
@@ -2093,6 +2094,7 @@ private:
 
 bool Document::saveToFile(const char* filename) const
 {
+    FC_PROFILE_ZONE_DETAIL("Document::saveToFile", filename);
     signalStartSave(*this, filename);
 
     auto hGrp = App::GetApplication().GetParameterGroupByPath(
@@ -2164,6 +2166,9 @@ bool Document::saveToFile(const char* filename) const
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
+        if (hGrp->GetBool("SaveBinaryElementMap", false)) {
+            writer.setMode("BinaryElementMap");
+        }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << endl
                         << "<!--" << endl
@@ -2264,6 +2269,7 @@ void Document::restore(const char* filename,
                        bool delaySignal,
                        const std::vector<std::string>& objNames)
 {
+    FC_PROFILE_ZONE_DETAIL("Document::restore", filename);
     clearUndos();
     d->activeObject = nullptr;
 
@@ -2367,6 +2373,7 @@ bool Document::afterRestore(bool checkPartial)
 
 bool Document::afterRestore(const std::vector<DocumentObject*>& objArray, bool checkPartial)
 {
+    FC_PROFILE_ZONE("Document::afterRestore");
     checkPartial = checkPartial && testStatus(Document::PartialDoc);
     if (checkPartial && !d->touchedObjs.empty()) {
         return false;
@@ -2933,7 +2940,7 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                         bool* hasError,
                         int options)
 {
-    ZoneScoped;
+    FC_PROFILE_ZONE("Document::recompute");
 
     if (d->undoing || d->rollback) {
         if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
@@ -3043,8 +3050,16 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                 if (obj->isTouched() || doRecompute) {
                     signalRecomputedObject(*obj);
                     obj->purgeTouched();
-                    // set all dependent object touched to force recompute
+                    // set all dependent object touched to force recompute, except
+                    // those depending on this object only through expression
+                    // bindings whose inputs did not change
                     for (auto inObjIt : obj->getInList()) {
+                        if (!inObjIt->ExpressionEngine.hasPendingBindings()) {
+                            auto outList = inObjIt->getOutList(DocumentObject::OutListNoExpression);
+                            if (std::find(outList.begin(), outList.end(), obj) == outList.end()) {
+                                continue;
+                            }
+                        }
                         inObjIt->enforceRecompute();
                     }
                 }
@@ -3308,8 +3323,58 @@ const char* Document::getErrorDescription(const App::DocumentObject* Obj) const
 // call the recompute of the Feature and handle the exceptions and errors.
 int Document::_recomputeFeature(DocumentObject* Feat)
 {
+    FC_PROFILE_ZONE_DETAIL("DocumentObject::execute", Feat->getFullName());
     FC_LOG("Recomputing " << Feat->getFullName());
 
+    RecomputeStatistics* stats = nullptr;
+    if (testStatus(Status::RecomputeStatistics)) {
+        stats = &Feat->recomputeStatistics;
+        stats->touchedBy.clear();
+        std::vector<std::pair<const char*, Property*>> props;
+        Feat->getPropertyNamedList(props);
+        for (auto& [name, prop] : props) {
+            if (prop->isTouched()) {
+                if (!stats->touchedBy.empty()) {
+                    stats->touchedBy += ' ';
+                }
+                stats->touchedBy += name;
+            }
+        }
+        if (stats->touchedBy.empty()) {
+            stats->touchedBy = "<dependency>";
+        }
+    }
+
+    // account the execution time, whichever way this function is left
+    struct ExecutionTimer
+    {
+        RecomputeStatistics* stats;
+        Base::TimeElapsed start;
+        bool stopped = false;
+        void stop()
+        {
+            if (stopped || !stats) {
+                return;
+            }
+            stopped = true;
+            double time = Base::TimeElapsed::diffTimeF(start);
+            ++stats->executions;
+            stats->lastTime = time;
+            stats->totalTime += time;
+            stats->maxTime = std::max(stats->maxTime, time);
+        }
+        void fail()
+        {
+            if (stats) {
+                ++stats->failures;
+            }
+        }
+        ~ExecutionTimer()
+        {
+            stop();
+        }
+    } timer {stats, {}};
+
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
@@ -3325,44 +3390,145 @@ int Document::_recomputeFeature(DocumentObject* Feat)
         e.ReportException();
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << e.what());
         d->addRecomputeLog("User abort", Feat);
+        timer.fail();
         return -1;
     }
     catch (const Base::MemoryException& e) {
         FC_ERR("Memory exception in " << Feat->getFullName() << " thrown: " << e.what());
         d->addRecomputeLog("Out of memory exception", Feat);
+        timer.fail();
         return 1;
     }
     catch (Base::Exception& e) {
         e.ReportException();
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << e.what());
         d->addRecomputeLog(e.what(), Feat);
+        timer.fail();
         return 1;
     }
     catch (std::exception& e) {
         FC_ERR("Exception in " << Feat->getFullName() << " thrown: " << e.what());
         d->addRecomputeLog(e.what(), Feat);
+        timer.fail();
         return 1;
     }
 #ifndef FC_DEBUG
     catch (...) {
         FC_ERR("Unknown exception in " << Feat->getFullName() << " thrown");
         d->addRecomputeLog("Unknown exception!", Feat);
+        timer.fail();
         return 1;
     }
 #endif
 
     if (returnCode == DocumentObject::StdReturn) {
         Feat->resetError();
+        timer.stop();
+        if (stats) {
+            stats->memSize = Feat->getMemSize();
+        }
     }
     else {
         returnCode->Which = Feat;
         d->addRecomputeLog(returnCode);
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << returnCode->Why);
+        timer.fail();
         return 1;
     }
     return 0;
 }
 
+void Document::exportRecomputeStatistics(std::ostream& out, bool json) const
+{
+    std::vector<DocumentObject*> objs;
+    for (auto obj : d->objectArray) {
+        if (obj->recomputeStatistics.executions != 0) {
+            objs.push_back(obj);
+        }
+    }
+    std::stable_sort(objs.begin(), objs.end(), [](DocumentObject* a, DocumentObject* b) {
+        return a->recomputeStatistics.totalTime > b->recomputeStatistics.totalTime;
+    });
+
+    if (!json) {
+        out << "Name,Label,Type,Executions,Failures,LastTime,AverageTime,MaxTime,TotalTime,"
+               "MemSize,TouchedBy\n";
+        auto quoted = [&out](const std::string& text) {
+            out << '"' << boost::replace_all_copy(text, "\"", "\"\"") << '"';
+        };
+        for (auto obj : objs) {
+            auto& stats = obj->recomputeStatistics;
+            out << obj->getNameInDocument() << ',';
+            quoted(obj->Label.getStrValue());
+            out << ',' << obj->getTypeId().getName() << ',' << stats.executions << ','
+                << stats.failures << ',' << stats.lastTime << ',' << stats.averageTime() << ','
+                << stats.maxTime << ',' << stats.totalTime << ',' << stats.memSize << ',';
+            quoted(stats.touchedBy);
+            out << '\n';
+        }
+        return;
+    }
+
+    auto quoted = [&out](const std::string& text) {
+        out << '"';
+        for (char ch : text) {
+            switch (ch) {
+                case '"':
+                    out << "\\\"";
+                    break;
+                case '\\':
+                    out << "\\\\";
+                    break;
+                case '\n':
+                    out << "\\n";
+                    break;
+                case '\r':
+                    out << "\\r";
+                    break;
+                case '\t':
+                    out << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(ch) < 0x20) {  // NOLINT
+                        char code[8];
+                        std::snprintf(code, sizeof(code), "\\u%04x", ch);
+                        out << code;
+                    }
+                    else {
+                        out << ch;
+                    }
+            }
+        }
+        out << '"';
+    };
+    out << '[';
+    bool first = true;
+    for (auto obj : objs) {
+        auto& stats = obj->recomputeStatistics;
+        out << (first ? "\n" : ",\n") << "{\"Name\":";
+        quoted(obj->getNameInDocument());
+        out << ",\"Label\":";
+        quoted(obj->Label.getStrValue());
+        out << ",\"Type\":";
+        quoted(obj->getTypeId().getName());
+        out << ",\"Executions\":" << stats.executions << ",\"Failures\":" << stats.failures
+            << ",\"LastTime\":" << stats.lastTime << ",\"AverageTime\":" << stats.averageTime()
+            << ",\"MaxTime\":" << stats.maxTime << ",\"TotalTime\":" << stats.totalTime
+            << ",\"MemSize\":" << stats.memSize << ",\"TouchedBy\":";
+        quoted(stats.touchedBy);
+        out << '}';
+        first = false;
+    }
+    out << "\n]\n";
+}
+
+void Document::resetRecomputeStatistics()
+{
+    for (auto obj : d->objectArray) {
+        obj->resetRecomputeStatistics();
+    }
+}
+
 bool Document::recomputeFeature(DocumentObject* feature, bool recursive)
 {
     // delete recompute log
@@ -84,7 +84,8 @@ public:
         LinkStampChanged = 11,        // Indicates during restore time if any linked document's time stamp has changed
         IgnoreErrorOnRecompute = 12,  // Don't report errors if the recompute failed
         RecomputeOnRestore = 13,      // Mark pending recompute on restore for migration purposes
-        MigrateLCS = 14               // Migrate local coordinate system of older versions
+        MigrateLCS = 14,              // Migrate local coordinate system of older versions
+        RecomputeStatistics = 15      // Collect the recompute statistics of the executed objects
     };
     // clang-format on
 
@@ -400,6 +401,16 @@ public:
                   int options = 0);
     /// Recompute only one feature
     bool recomputeFeature(DocumentObject* Feat, bool recursive = false);
+    /** Write the recompute statistics of the objects executed in this session
+     *
+     * @param json: write a JSON array instead of CSV
+     *
+     * Objects are sorted by their accumulated execution time, slowest first.
+     * The statistics are only collected while the RecomputeStatistics status is set.
+     */
+    void exportRecomputeStatistics(std::ostream& out, bool json = false) const;
+    /// Clear the recompute statistics of all objects
+    void resetRecomputeStatistics();
     /// get the text of the error of a specified object
     const char* getErrorDescription(const App::DocumentObject*) const;
     /// return the status bits
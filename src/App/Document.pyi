@@ -1,6 +1,6 @@
 from PropertyContainer import PropertyContainer
 from DocumentObject import DocumentObject
-from typing import Final, List, Tuple, Sequence
+from typing import Final, List, Optional, Tuple, Sequence
 
 
 class Document(PropertyContainer):
@@ -52,6 +52,9 @@ class Document(PropertyContainer):
     RecomputesFrozen: bool = False
     """Returns or sets if automatic recomputes for this document are disabled."""
 
+    RecomputeStatistics: bool = False
+    """Returns or sets if the recompute statistics of the executed objects are collected."""
+
     HasPendingTransaction: Final[bool] = False
     """Check if there is a pending transaction"""
 
@@ -320,6 +323,25 @@ class Document(PropertyContainer):
         """
         ...
 
+    def exportRecomputeStatistics(self, filename: str = None, json: bool = False) -> Optional[str]:
+        """
+        exportRecomputeStatistics(filename=None, json=False)
+
+        Export the recompute statistics of the objects executed in this session,
+        slowest first, as CSV or as JSON. The statistics are only collected
+        while RecomputeStatistics is set.
+
+        filename: the file to write. If omitted, the text is returned instead.
+        json: write a JSON array instead of CSV.
+        """
+        ...
+
+    def resetRecomputeStatistics(self) -> None:
+        """
+        Clear the recompute statistics of all objects
+        """
+        ...
+
     def mustExecute(self) -> bool:
         """
         Check if any object must be recomputed
@@ -100,6 +100,31 @@ public:
     DocumentObject* Which;
 };
 
+/** Recompute statistics of a document object, collected during the session
+ */
+struct RecomputeStatistics
+{
+    /// number of executions, including the failed ones
+    unsigned long executions {0};
+    /// number of failed executions
+    unsigned long failures {0};
+    /// duration of the last execution in seconds
+    double lastTime {0.0};
+    /// accumulated duration of all executions in seconds
+    double totalTime {0.0};
+    /// duration of the longest execution in seconds
+    double maxTime {0.0};
+    /// memory used by the properties after the last successful execution
+    unsigned int memSize {0};
+    /// what caused the last execution, the touched properties or "<dependency>"
+    std::string touchedBy;
+
+    double averageTime() const
+    {
+        return executions != 0 ? totalTime / static_cast<double>(executions) : 0.0;
+    }
+};
+
 
 /**
  * @brief %Base class of all objects handled in the @ref App::Document "Document".
@@ -241,6 +266,16 @@ public:
     }
     //@}
 
+    /// return the statistics of the recomputes of this object during this session
+    const RecomputeStatistics& getRecomputeStatistics() const
+    {
+        return recomputeStatistics;
+    }
+    void resetRecomputeStatistics()
+    {
+        recomputeStatistics = RecomputeStatistics();
+    }
+
     int isExporting() const;
 
     /** Child element handling
@@ -786,6 +821,9 @@ private:
     // unique identifier (among a document) of this object.
     long _Id {0};
 
+    // updated by App::Document on each execution
+    RecomputeStatistics recomputeStatistics;
+
 private:
     // Back pointer to all the fathers in a DAG of the document
     // this is used by the document (via friend) to have a effective DAG handling
@@ -3,7 +3,7 @@ from Base.Matrix import Matrix
 from Document import Document
 from DocumentObjectGroup import DocumentObjectGroup
 from ExtensionContainer import ExtensionContainer
-from typing import Any, Final, List, Optional, Union, Tuple
+from typing import Any, Dict, Final, List, Optional, Union, Tuple
 
 
 class DocumentObject(ExtensionContainer):
@@ -146,6 +146,15 @@ class DocumentObject(ExtensionContainer):
         """
         ...
 
+    @constmethod
+    def getRecomputeStatistics(self) -> Dict[str, Any]:
+        """
+        Returns the statistics of the executions of this object in this session,
+        as a dict with the keys Executions, Failures, LastTime, AverageTime,
+        MaxTime, TotalTime (in seconds), MemSize (in bytes) and TouchedBy.
+        """
+        ...
+
     @constmethod
     def isValid(self) -> bool:
         """
@@ -481,6 +481,25 @@ PyObject* DocumentObjectPy::getStatusString(PyObject* args) const
     }
 }
 
+PyObject* DocumentObjectPy::getRecomputeStatistics(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const auto& stats = getDocumentObjectPtr()->getRecomputeStatistics();
+    Py::Dict dict;
+    dict.setItem("Executions", Py::Long(stats.executions));
+    dict.setItem("Failures", Py::Long(stats.failures));
+    dict.setItem("LastTime", Py::Float(stats.lastTime));
+    dict.setItem("AverageTime", Py::Float(stats.averageTime()));
+    dict.setItem("MaxTime", Py::Float(stats.maxTime));
+    dict.setItem("TotalTime", Py::Float(stats.totalTime));
+    dict.setItem("MemSize", Py::Long(static_cast<unsigned long>(stats.memSize)));
+    dict.setItem("TouchedBy", Py::String(stats.touchedBy));
+    return Py::new_reference_to(dict);
+}
+
 PyObject* DocumentObjectPy::getSubObject(PyObject* args, PyObject* keywds)
 {
     enum class ReturnType
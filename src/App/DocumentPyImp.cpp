@@ -715,6 +715,53 @@ PyObject* DocumentPy::recompute(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* DocumentPy::exportRecomputeStatistics(PyObject* args)
+{
+    PyObject* file = Py_None;
+    PyObject* json = Py_False;
+    if (!PyArg_ParseTuple(args, "|OO!", &file, &PyBool_Type, &json)) {
+        return nullptr;
+    }
+
+    std::string utf8Name;
+    if (file != Py_None) {
+        char* fn = nullptr;
+        if (!PyArg_Parse(file, "et", "utf-8", &fn)) {
+            return nullptr;
+        }
+        utf8Name = fn;
+        PyMem_Free(fn);
+    }
+
+    PY_TRY
+    {
+        if (file != Py_None) {
+            Base::FileInfo fi(utf8Name);
+            Base::ofstream str(fi);
+            if (!str.is_open()) {
+                throw Base::FileException("Failed to open file", fi);
+            }
+            getDocumentPtr()->exportRecomputeStatistics(str, Base::asBoolean(json));
+            str.close();
+            Py_Return;
+        }
+
+        std::stringstream str;
+        getDocumentPtr()->exportRecomputeStatistics(str, Base::asBoolean(json));
+        return PyUnicode_FromString(str.str().c_str());
+    }
+    PY_CATCH
+}
+
+PyObject* DocumentPy::resetRecomputeStatistics(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->resetRecomputeStatistics();
+    Py_Return;
+}
+
 PyObject* DocumentPy::mustExecute(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -977,6 +1024,16 @@ void DocumentPy::setRecomputesFrozen(Py::Boolean arg)
     getDocumentPtr()->setStatus(Document::Status::SkipRecompute, arg.isTrue());
 }
 
+Py::Boolean DocumentPy::getRecomputeStatistics() const
+{
+    return {getDocumentPtr()->testStatus(Document::Status::RecomputeStatistics)};
+}
+
+void DocumentPy::setRecomputeStatistics(Py::Boolean arg)
+{
+    getDocumentPtr()->setStatus(Document::Status::RecomputeStatistics, arg.isTrue());
+}
+
 PyObject* DocumentPy::getTempFileName(PyObject* args)
 {
     PyObject* value;
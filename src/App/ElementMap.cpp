@@ -1,5 +1,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <limits>
+#include <sstream>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -11,6 +14,7 @@
 
 #include "App/Application.h"
 #include "Base/Console.h"
+#include "Base/Stream.h"
 #include "Document.h"
 #include "DocumentObject.h"
 
@@ -44,6 +48,33 @@ namespace Data
 static std::unordered_map<const ElementMap*, unsigned> _elementMapToId;
 static std::unordered_map<unsigned, ElementMapPtr> _idToElementMap;
 
+namespace
+{
+
+void writeBytes(Base::OutputStream& out, const char* data, int size)
+{
+    out << static_cast<uint32_t>(size);
+    out.write(data, size);
+}
+
+QByteArray readBytes(Base::InputStream& in, std::istream& stream)
+{
+    constexpr uint32_t maxSize {1 << 30};
+    uint32_t size = 0;
+    in >> size;
+    if (!stream || size > maxSize) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map");  // NOLINT
+    }
+    QByteArray bytes(static_cast<int>(size), Qt::Uninitialized);
+    in.read(bytes.data(), static_cast<int>(size));
+    if (!stream) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map");  // NOLINT
+    }
+    return bytes;
+}
+
+}  // namespace
+
 
 void ElementMap::init()
 {
@@ -72,6 +103,132 @@ ElementMap::ElementMap()
     init();
 }
 
+std::size_t ElementMap::MappedNameTable::hashName(const MappedName& name)
+{
+    // FNV-1a over the concatenated data and postfix. Names compare equal by
+    // their concatenation, so the hash must not depend on where data ends.
+    std::uint64_t hash = 14695981039346656037ULL;  // NOLINT
+    for (const QByteArray* bytes : {&name.dataBytes(), &name.postfixBytes()}) {
+        for (char c : *bytes) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;  // NOLINT
+        }
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+std::size_t ElementMap::MappedNameTable::findSlot(const MappedName& name, std::size_t hash) const
+{
+    std::size_t mask = slots.size() - 1;
+    for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+        std::uint32_t pos = slots[i];
+        if (pos == 0) {
+            return i;
+        }
+        const Entry& entry = entries[pos - 1];
+        if (entry.hash == hash && entry.name == name) {
+            return i;
+        }
+    }
+}
+
+std::size_t ElementMap::MappedNameTable::findSlot(std::uint32_t pos, std::size_t hash) const
+{
+    std::size_t mask = slots.size() - 1;
+    std::size_t i = hash & mask;
+    while (slots[i] != pos) {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+void ElementMap::MappedNameTable::rehash(std::size_t count)
+{
+    slots.assign(count, 0);
+    std::size_t mask = count - 1;
+    for (std::size_t pos = 0; pos < entries.size(); ++pos) {
+        std::size_t i = entries[pos].hash & mask;
+        while (slots[i] != 0) {
+            i = (i + 1) & mask;
+        }
+        slots[i] = static_cast<std::uint32_t>(pos + 1);
+    }
+}
+
+const ElementMap::MappedNameTable::Entry*
+ElementMap::MappedNameTable::find(const MappedName& name) const
+{
+    if (entries.empty()) {
+        return nullptr;
+    }
+    std::uint32_t pos = slots[findSlot(name, hashName(name))];
+    return pos != 0 ? &entries[pos - 1] : nullptr;
+}
+
+std::pair<ElementMap::MappedNameTable::Entry*, bool>
+ElementMap::MappedNameTable::insert(const MappedName& name, const IndexedName& idx)
+{
+    // keep the load factor at or below one half
+    if ((entries.size() + 1) * 2 > slots.size()) {
+        rehash(std::max<std::size_t>(16, slots.size() * 2));  // NOLINT
+    }
+    std::size_t hash = hashName(name);
+    std::size_t slot = findSlot(name, hash);
+    if (slots[slot] != 0) {
+        return {&entries[slots[slot] - 1], false};
+    }
+    entries.push_back(Entry {name, idx, hash});
+    slots[slot] = static_cast<std::uint32_t>(entries.size());
+    return {&entries.back(), true};
+}
+
+void ElementMap::MappedNameTable::erase(const MappedName& name)
+{
+    if (entries.empty()) {
+        return;
+    }
+    std::size_t hole = findSlot(name, hashName(name));
+    std::uint32_t pos = slots[hole];
+    if (pos == 0) {
+        return;
+    }
+
+    // Backward shift deletion: move up any following entry of the probe
+    // cluster whose home slot is not after the hole, so that no tombstones
+    // are needed.
+    std::size_t mask = slots.size() - 1;
+    for (std::size_t i = (hole + 1) & mask; slots[i] != 0; i = (i + 1) & mask) {
+        std::size_t home = entries[slots[i] - 1].hash & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            slots[hole] = slots[i];
+            hole = i;
+        }
+    }
+    slots[hole] = 0;
+
+    // Keep the entries contiguous by moving the last one into the gap
+    auto last = static_cast<std::uint32_t>(entries.size());
+    if (pos != last) {
+        slots[findSlot(last, entries.back().hash)] = pos;
+        entries[pos - 1] = std::move(entries.back());
+    }
+    entries.pop_back();
+}
+
+std::vector<const ElementMap::MappedNameTable::Entry*>
+ElementMap::MappedNameTable::sortedEntries() const
+{
+    std::vector<const Entry*> res;
+    res.reserve(entries.size());
+    for (const auto& entry : entries) {
+        res.push_back(&entry);
+    }
+    std::sort(res.begin(), res.end(), [](const Entry* a, const Entry* b) {
+        return a->name < b->name;
+    });
+    return res;
+}
+
 
 void ElementMap::beforeSave(const ::App::StringHasherRef& hasherRef) const
 {
@@ -447,7 +604,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
+                this->mappedNames.insert(ref->name, idx);
 
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
@@ -496,9 +653,429 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         FC_THROWM(Base::RuntimeError, "unexpected end of child element map");  // NOLINT
     }
 
+    map = shared_from_this();
+    return map;
+}
+
+void ElementMap::saveBinary(std::ostream& stream) const
+{
+    std::map<const ElementMap*, int> childMapSet;
+    std::vector<const ElementMap*> childMaps;
+    std::map<QByteArray, int> postfixMap;
+    std::vector<QByteArray> postfixes;
+
+    collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
+
+    Base::OutputStream out(stream);
+    out << static_cast<uint32_t>(this->_id) << static_cast<uint32_t>(postfixes.size());
+    for (auto& postfix : postfixes) {
+        writeBytes(out, postfix.constData(), postfix.size());
+    }
+    out << static_cast<uint32_t>(childMaps.size());
+    int index = 0;
+    for (auto& elementMap : childMaps) {
+        // Store each map with its size, so that an already restored one can be skipped
+        std::ostringstream buffer;
+        elementMap->saveBinary(buffer, ++index, childMapSet, postfixMap);
+        std::string data = buffer.str();
+        out << static_cast<uint32_t>(elementMap->_id) << static_cast<uint64_t>(data.size());
+        stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+}
+
+void ElementMap::saveBinary(std::ostream& stream,
+                            int index,
+                            const std::map<const ElementMap*, int>& childMapSet,
+                            const std::map<QByteArray, int>& postfixMap) const
+{
+    Base::OutputStream out(stream);
+    out << static_cast<uint32_t>(index) << static_cast<uint32_t>(this->indexedNames.size());
+
+    for (auto& indexedName : this->indexedNames) {
+        writeBytes(out, indexedName.first, static_cast<int>(qstrlen(indexedName.first)));
+
+        out << static_cast<uint32_t>(indexedName.second.children.size());
+        for (auto& vv : indexedName.second.children) {
+            auto& child = vv.second;
+            int mapIndex = 0;
+            if (child.elementMap) {
+                auto it = childMapSet.find(child.elementMap.get());
+                if (it == childMapSet.end() || it->second == 0) {
+                    FC_ERR("Invalid child element map");  // NOLINT
+                }
+                else {
+                    mapIndex = it->second;
+                }
+            }
+            out << static_cast<int32_t>(child.indexedName.getIndex())
+                << static_cast<int32_t>(child.offset) << static_cast<int32_t>(child.count)
+                << static_cast<int64_t>(child.tag) << static_cast<int32_t>(mapIndex);
+            writeBytes(out, child.postfix.constData(), child.postfix.size());
+            auto sidCount = std::count_if(child.sids.begin(), child.sids.end(), [](auto& sid) {
+                return sid.isMarked();
+            });
+            out << static_cast<uint32_t>(sidCount);
+            for (auto& sid : child.sids) {
+                if (sid.isMarked()) {
+                    out << static_cast<uint32_t>(sid.value());
+                }
+            }
+        }
+
+        out << static_cast<uint32_t>(indexedName.second.names.size());
+
+        // the data of the last name stored in full, for prefix compression
+        QByteArray previous;
+        for (auto& dequeueOfMappedNameRef : indexedName.second.names) {
+            for (auto ref = &dequeueOfMappedNameRef; ref; ref = ref->next.get()) {
+                if (!ref->name) {
+                    break;
+                }
+
+                ::App::StringID::IndexID prefixID {};
+                prefixID.id = 0;
+                IndexedName idx(ref->name.dataBytes());
+                char marker = ';';
+                int postfixIndex = 0;
+                if (idx) {
+                    auto key = QByteArray::fromRawData(idx.getType(),
+                                                       static_cast<int>(qstrlen(idx.getType())));
+                    auto it = postfixMap.find(key);
+                    if (it != postfixMap.end()) {
+                        marker = ':';
+                        postfixIndex = it->second;
+                    }
+                }
+                else {
+                    prefixID = ::App::StringID::fromString(ref->name.dataBytes());
+                    if (prefixID.id != 0) {
+                        for (auto& sid : ref->sids) {
+                            if (sid.isMarked() && sid.value() == prefixID.id) {
+                                marker = '$';
+                                break;
+                            }
+                        }
+                        if (marker != '$') {
+                            prefixID.id = 0;
+                        }
+                    }
+                }
+
+                out << static_cast<uint8_t>(marker);
+                if (marker == ':') {
+                    out << static_cast<uint32_t>(postfixIndex)
+                        << static_cast<int32_t>(idx.getIndex());
+                }
+                else {
+                    const QByteArray& data = ref->name.dataBytes();
+                    int shared = 0;
+                    int maxShared = std::min({static_cast<int>(previous.size()),
+                                              static_cast<int>(data.size()),
+                                              static_cast<int>(UINT16_MAX)});
+                    while (shared < maxShared && previous[shared] == data[shared]) {
+                        ++shared;
+                    }
+                    out << static_cast<uint16_t>(shared);
+                    writeBytes(out, data.constData() + shared, data.size() - shared);
+                    previous = data;
+                }
+
+                const QByteArray& postfix = ref->name.postfixBytes();
+                if (postfix.isEmpty()) {
+                    out << static_cast<uint32_t>(0);
+                }
+                else {
+                    auto it = postfixMap.find(postfix);
+                    assert(it != postfixMap.end());
+                    out << static_cast<uint32_t>(it->second);
+                }
+
+                auto sidCount = std::count_if(ref->sids.begin(), ref->sids.end(), [&](auto& sid) {
+                    return sid.isMarked() && sid.value() != prefixID.id;
+                });
+                out << static_cast<uint32_t>(sidCount);
+                for (auto& sid : ref->sids) {
+                    if (sid.isMarked() && sid.value() != prefixID.id) {
+                        out << static_cast<uint32_t>(sid.value());
+                    }
+                }
+            }
+            out << static_cast<uint8_t>(0);
+        }
+    }
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream)
+{
+    const char* msg = "Invalid element map";
+
+    Base::InputStream in(stream);
+    uint32_t id = 0;
+    uint32_t count = 0;
+    in >> id >> count;
+    if (!stream) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+
+    auto& map = _idToElementMap[id];
+    if (map) {
+        return map;
+    }
+
+    std::vector<std::string> postfixes;
+    postfixes.reserve(std::min<uint32_t>(count, UINT16_MAX));
+    for (uint32_t i = 0; i < count; ++i) {
+        postfixes.push_back(readBytes(in, stream).toStdString());
+    }
+
+    std::vector<ElementMapPtr> childMaps;
+    count = 0;
+    constexpr uint32_t practicalMaximum {(1 << 30) / sizeof(ElementMapPtr)};
+    in >> count;
+    if (!stream || count == 0 || count > practicalMaximum) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+    childMaps.reserve(count - 1);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t mapID = 0;
+        uint64_t size = 0;
+        in >> mapID >> size;
+        if (!stream) {
+            FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+        }
+        // The last map is the one being restored, all others are its children
+        ElementMapPtr elementMap = _idToElementMap[mapID];
+        if (elementMap) {
+            stream.ignore(static_cast<std::streamsize>(size));
+        }
+        else {
+            auto target = i + 1 < count ? std::make_shared<ElementMap>() : shared_from_this();
+            elementMap = target->restoreBinary(hasherRef, stream, childMaps, postfixes);
+            // Let the other maps sharing this one skip it
+            _idToElementMap[mapID] = elementMap;
+        }
+        if (i + 1 == count) {
+            return elementMap;
+        }
+        childMaps.push_back(elementMap);
+    }
     return shared_from_this();
 }
 
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef,
+                                        std::istream& stream,
+                                        std::vector<ElementMapPtr>& childMaps,
+                                        const std::vector<std::string>& postfixes)
+{
+    const char* msg = "Invalid element map";
+    Base::InputStream in(stream);
+    uint32_t index = 0;
+    uint32_t typeCount = 0;
+    in >> index >> typeCount;
+    if (!stream) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+    constexpr uint32_t maxTypeCount(1000);
+    if (typeCount > maxTypeCount) {
+        FC_THROWM(Base::RuntimeError, "Bad type count in element map, ignoring map");  // NOLINT
+    }
+
+    const char* hasherWarn = nullptr;
+    const char* hasherIDWarn = nullptr;
+    const char* postfixWarn = nullptr;
+    const char* childSIDWarn = nullptr;
+    std::vector<uint32_t> sidValues;
+
+    auto readSids = [&]() {
+        uint32_t sidCount = 0;
+        in >> sidCount;
+        if (!stream || sidCount > maxTypeCount * maxTypeCount) {
+            FC_THROWM(Base::RuntimeError, "Invalid element string id count");  // NOLINT
+        }
+        sidValues.resize(sidCount);
+        for (auto& value : sidValues) {
+            in >> value;
+        }
+    };
+
+    for (uint32_t i = 0; i < typeCount; ++i) {
+        std::string type = readBytes(in, stream).toStdString();
+        IndexedName idx(type.c_str(), 1);
+
+        uint32_t childCount = 0;
+        in >> childCount;
+        if (!stream) {
+            FC_THROWM(Base::RuntimeError, "missing element child count");  // NOLINT
+        }
+
+        auto& indices = this->indexedNames[idx.getType()];
+        for (uint32_t j = 0; j < childCount; ++j) {
+            int32_t cIndex = 0;
+            int32_t offset = 0;
+            int32_t count = 0;
+            int64_t tag = 0;
+            int32_t mapIndex = 0;
+            in >> cIndex >> offset >> count >> tag >> mapIndex;
+            if (!stream) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child");  // NOLINT
+            }
+            if (cIndex < 0) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child index");  // NOLINT
+            }
+            if (offset < 0) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child offset");  // NOLINT
+            }
+            if (mapIndex >= (int)index || mapIndex < 0 || mapIndex > (int)childMaps.size()) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child map index");  // NOLINT
+            }
+            auto& child = indices.children[cIndex + offset + count];
+            child.indexedName = IndexedName::fromConst(idx.getType(), cIndex);
+            child.offset = offset;
+            child.count = count;
+            child.tag = static_cast<long>(tag);
+            if (mapIndex > 0) {
+                child.elementMap = childMaps[mapIndex - 1];
+            }
+            else {
+                child.elementMap = nullptr;
+            }
+            child.postfix = readBytes(in, stream);
+            this->childElements[child.postfix].childMap = &child;
+            this->childElementSize += child.count;
+
+            readSids();
+            child.sids.reserve(static_cast<int>(sidValues.size()));
+            for (auto value : sidValues) {
+                auto sid = hasherRef->getID(value);
+                if (!sid) {
+                    childSIDWarn = "Missing element child string id";
+                }
+                else {
+                    child.sids.push_back(sid);
+                }
+            }
+        }
+
+        uint32_t nameCount = 0;
+        in >> nameCount;
+        if (!stream || nameCount > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+            FC_THROWM(Base::RuntimeError, "missing element name count");  // NOLINT
+        }
+
+        QByteArray previous;
+        indices.names.resize(nameCount);
+        for (uint32_t j = 0; j < nameCount; ++j) {
+            idx.setIndex(static_cast<int>(j));
+            auto* ref = &indices.names[j];
+            int innerCount = 0;
+            while (true) {
+                uint8_t marker = 0;
+                in >> marker;
+                if (!stream) {
+                    FC_THROWM(Base::RuntimeError, "Failed to read element name");  // NOLINT
+                }
+                if (marker == 0) {
+                    break;
+                }
+                if (innerCount++ != 0) {
+                    ref->next = std::make_unique<MappedNameRef>();
+                    ref = ref->next.get();
+                }
+
+                ::App::StringID::IndexID prefixID {};
+                prefixID.id = 0;
+
+                switch (marker) {
+                    case ':': {
+                        uint32_t elementNameIndex = 0;
+                        int32_t elementIndex = 0;
+                        in >> elementNameIndex >> elementIndex;
+                        if (elementNameIndex == 0 || elementNameIndex > postfixes.size()) {
+                            FC_THROWM(Base::RuntimeError, "Invalid element name index");  // NOLINT
+                        }
+                        ref->name = MappedName(
+                            IndexedName::fromConst(postfixes[elementNameIndex - 1].c_str(),
+                                                   static_cast<int>(elementIndex)));
+                        break;
+                    }
+                    case '$':
+                    case ';': {
+                        uint16_t shared = 0;
+                        in >> shared;
+                        if (shared > previous.size()) {
+                            FC_THROWM(Base::RuntimeError, "Invalid element name");  // NOLINT
+                        }
+                        previous = previous.left(shared) + readBytes(in, stream);
+                        ref->name = MappedName(previous.constData(), previous.size());
+                        if (marker == '$') {
+                            prefixID = ::App::StringID::fromString(ref->name.dataBytes());
+                        }
+                        break;
+                    }
+                    default:
+                        FC_THROWM(Base::RuntimeError, "Invalid element name marker");  // NOLINT
+                }
+
+                uint32_t postfixIndex = 0;
+                in >> postfixIndex;
+                if (postfixIndex != 0) {
+                    if (postfixIndex > postfixes.size()) {
+                        postfixWarn = "Invalid element postfix index";
+                    }
+                    else {
+                        ref->name += postfixes[postfixIndex - 1];
+                    }
+                }
+
+                this->mappedNames.insert(ref->name, idx);
+
+                readSids();
+                if (!hasherRef) {
+                    if (!sidValues.empty()) {
+                        hasherWarn = "No hasherRef";
+                    }
+                    continue;
+                }
+
+                ref->sids.reserve(static_cast<int>(sidValues.size()) + (prefixID.id != 0 ? 1 : 0));
+                if (prefixID.id != 0) {
+                    auto sid = hasherRef->getID(prefixID.id);
+                    if (!sid) {
+                        hasherIDWarn = "Missing element name prefix id";
+                    }
+                    else {
+                        ref->sids.push_back(sid);
+                    }
+                }
+                for (auto value : sidValues) {
+                    auto sid = hasherRef->getID(value);
+                    if (!sid) {
+                        hasherIDWarn = "Invalid element name string id";
+                    }
+                    else {
+                        ref->sids.push_back(sid);
+                    }
+                }
+            }
+        }
+    }
+    if (hasherWarn) {
+        FC_WARN(hasherWarn);  // NOLINT
+    }
+    if (hasherIDWarn) {
+        FC_WARN(hasherIDWarn);  // NOLINT
+    }
+    if (postfixWarn) {
+        FC_WARN(postfixWarn);  // NOLINT
+    }
+    if (childSIDWarn) {
+        FC_WARN(childSIDWarn);  // NOLINT
+    }
+
+    return shared_from_this();
+}
+
+
 MappedName ElementMap::addName(MappedName& name,
                                const IndexedName& idx,
                                const ElementIDRefs& sids,
@@ -514,25 +1091,27 @@ MappedName ElementMap::addName(MappedName& name,
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
-        if (ret.second) {                // element just inserted did not exist yet in the map
-            ret.first->first.compact();  // FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+        auto ret = mappedNames.insert(name, idx);
+        if (ret.second) {               // element just inserted did not exist yet in the map
+            ret.first->name.compact();  // FIXME see MappedName.cpp
+            mappedRef(idx).append(ret.first->name, sids);
             FC_TRACE(idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return ret.first->name;
         }
-        if (ret.first->second == idx) {
+        if (ret.first->index == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return ret.first->name;
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = ret.first->index;
             }
             return {};
         }
 
-        erase(ret.first->first);
+        // copy the name, the entry is gone after erasing it
+        MappedName duplicate(ret.first->name);
+        erase(duplicate);
     };
 }
 
@@ -782,16 +1361,16 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    auto entry = this->mappedNames.find(name);
+    if (!entry) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
+    MappedNameRef* ref = findMappedRef(entry->index);
     if (!ref) {
         return;
     }
     ref->erase(name);
-    this->mappedNames.erase(it);
+    this->mappedNames.erase(name);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -823,8 +1402,8 @@ bool ElementMap::empty() const
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    auto entry = mappedNames.find(name);
+    if (!entry) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -861,7 +1440,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
     }
 
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
+        const MappedNameRef* ref = findMappedRef(entry->index);
         for (; ref; ref = ref->next.get()) {
             if (ref->name == name) {
                 if (sids->empty()) {
@@ -874,7 +1453,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
             }
         }
     }
-    return nameIter->second;
+    return entry->index;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -1077,8 +1656,9 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // walk the names in order to keep the saved postfix table stable
+    for (auto entry : this->mappedNames.sortedEntries()) {
+        addPostfix(entry->name.constPostfix(), postfixMap, postfixes);
     }
 
     childMaps.push_back(this);
@@ -1304,8 +1884,8 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
+    for (auto entry : this->mappedNames.sortedEntries()) {
+        ret.emplace_back(entry->name, entry->index);
     }
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
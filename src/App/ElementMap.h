@@ -32,11 +32,13 @@
 #include "MappedElement.h"
 #include "StringHasher.h"
 
+#include <cstdint>
 #include <cstring>
 #include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 
 namespace Data
@@ -101,6 +103,19 @@ public:
      */
     ElementMapPtr restore(::App::StringHasherRef hasherRef, std::istream& stream);
 
+    /** Serialize this map in a compact, length prefixed binary form. Names
+     * sharing a common prefix with the previously stored one are only stored
+     * by their differing tail.
+     * @param stream: serialized stream
+     */
+    void saveBinary(std::ostream& stream) const;
+
+    /** Deserialize and restore a map saved by saveBinary().
+     * @param hasherRef: where all the StringIDs are stored
+     * @param stream: stream to deserialize
+     */
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream);
+
 
     /** Add a sub-element name mapping.
      *
@@ -233,6 +248,18 @@ private:
                           std::vector<ElementMapPtr>& childMaps,
                           const std::vector<std::string>& postfixes);
 
+    /// Binary variant of save(std::ostream&, int, ...)
+    void saveBinary(std::ostream& stream,
+                    int index,
+                    const std::map<const ElementMap*, int>& childMapSet,
+                    const std::map<QByteArray, int>& postfixMap) const;
+
+    /// Binary variant of restore(::App::StringHasherRef, std::istream&, ...)
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef,
+                                std::istream& stream,
+                                std::vector<ElementMapPtr>& childMaps,
+                                const std::vector<std::string>& postfixes);
+
     /** Associate the MappedName \c name with the IndexedName \c idx.
      * @param name: the name to add
      * @param idx: the indexed name that \c name will be bound to
@@ -303,7 +330,61 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    /** Hash table mapping a MappedName to its IndexedName
+     *
+     * The entries are stored in a contiguous vector, and an open addressing
+     * table with linear probing holds the entry positions. This avoids one
+     * heap allocation per element name and keeps lookups in a single cache
+     * friendly array. There is no particular iteration order, use
+     * sortedEntries() where the ordering of the names matters.
+     */
+    class MappedNameTable
+    {
+    public:
+        struct Entry
+        {
+            MappedName name;
+            IndexedName index;
+            std::size_t hash;
+        };
+
+        const Entry* find(const MappedName& name) const;
+        /// Insert a new entry, or return the existing one with the same name
+        std::pair<Entry*, bool> insert(const MappedName& name, const IndexedName& idx);
+        void erase(const MappedName& name);
+
+        std::size_t size() const
+        {
+            return entries.size();
+        }
+        bool empty() const
+        {
+            return entries.empty();
+        }
+        std::vector<Entry>::const_iterator begin() const
+        {
+            return entries.begin();
+        }
+        std::vector<Entry>::const_iterator end() const
+        {
+            return entries.end();
+        }
+        /// Returns the entries ordered by name
+        std::vector<const Entry*> sortedEntries() const;
+
+    private:
+        static std::size_t hashName(const MappedName& name);
+        /// Returns the slot holding \c name, or the first empty slot of its probe sequence
+        std::size_t findSlot(const MappedName& name, std::size_t hash) const;
+        std::size_t findSlot(std::uint32_t pos, std::size_t hash) const;
+        void rehash(std::size_t count);
+
+        std::vector<Entry> entries;
+        /// Entry position plus one, zero marks an empty slot
+        std::vector<std::uint32_t> slots;
+    };
+
+    MappedNameTable mappedNames;
 
     struct ChildMapInfo
     {
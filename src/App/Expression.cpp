@@ -34,6 +34,7 @@
 #include <boost/math/special_functions/round.hpp>
 #include <boost/math/special_functions/trunc.hpp>
 
+#include <cmath>
 #include <numbers>
 #include <limits>
 #include <sstream>
@@ -851,6 +852,7 @@ Expression::~Expression()
 {
     for(auto c : components)
         delete c;
+    delete program.load();
 }
 
 Expression::Component* Expression::createComponent(const std::string &n) {
@@ -1092,10 +1094,70 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    App::any value;
+    if(getNativeValue(value))
+        return value;
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
 
+/**
+  * Evaluate the expression without Python, if possible.
+  *
+  * The expression is compiled into an ExpressionProgram on first use. The
+  * same expression may be evaluated from several threads at once.
+  *
+  * @param value Receives the result on success.
+  * @param keepBool Return a boolean result as bool instead of long.
+  * @returns false if the expression, or the values it reads, are not supported
+  * natively. The caller should then use getPyValue().
+  */
+
+bool Expression::getNativeValue(App::any &value, bool keepBool) const {
+    const ExpressionProgram &prog = nativeProgram();
+    return !prog.empty() && prog.run(value, keepBool);
+}
+
+/**
+  * Compile the native program of this expression if not done yet.
+  *
+  * @returns true if the expression may be evaluated by getNativeValue().
+  */
+
+bool Expression::prepareNativeValue() const {
+    return !nativeProgram().empty();
+}
+
+/**
+  * Returns the native program of this expression, compiling it on first use.
+  *
+  * Threads racing on the first use each compile a program, the first one
+  * published is kept and the others are discarded.
+  */
+
+const ExpressionProgram &Expression::nativeProgram() const {
+    ExpressionProgram *prog = program.load(std::memory_order_acquire);
+    if(!prog) {
+        auto compiled = std::make_unique<ExpressionProgram>();
+        if(!compile(*compiled))
+            compiled->clear();
+        if(program.compare_exchange_strong(prog, compiled.get(),
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+            prog = compiled.release();
+    }
+    return *prog;
+}
+
+/**
+  * Append the native instructions evaluating this expression to \a program.
+  *
+  * @returns false if any part of the expression is not supported natively.
+  */
+
+bool Expression::compile(ExpressionProgram &prog) const {
+    return components.empty() && _compile(prog);
+}
+
 Py::Object Expression::getPyValue() const {
     try {
         Py::Object pyobj = _getPyValue();
@@ -1113,6 +1175,7 @@ Py::Object Expression::getPyValue() const {
 void Expression::addComponent(Component *component) {
     assert(component);
     components.push_back(component);
+    delete program.exchange(nullptr);
 }
 
 void Expression::visit(ExpressionVisitor &v) {
@@ -1256,6 +1319,11 @@ Py::Object UnitExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool UnitExpression::_compile(ExpressionProgram &prog) const {
+    prog.add(ExpressionProgram::Constant, 0, this);
+    return true;
+}
+
 //
 // NumberExpression class
 //
@@ -1465,6 +1533,19 @@ Py::Object OperatorExpression::_getPyValue() const {
     return calc(this,op,left,right,false);
 }
 
+bool OperatorExpression::_compile(ExpressionProgram &prog) const {
+    if(!left->compile(prog))
+        return false;
+    if(op == NEG || op == POS) {
+        prog.add(ExpressionProgram::Unary, op, this);
+        return true;
+    }
+    if(!right->compile(prog))
+        return false;
+    prog.add(ExpressionProgram::Binary, op, this);
+    return true;
+}
+
 /**
   * Simplify the expression. For OperatorExpressions, we return a NumberExpression if
   * both the left and right side can be simplified to NumberExpressions. In this case
@@ -2379,21 +2460,46 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     }
 
-    Py::Object e1 = args[0]->getPyValue();
-    Quantity v1 = pyToQuantity(e1,expr,"Invalid first argument.");
-    Py::Object e2;
+    Quantity v1 = pyToQuantity(args[0]->getPyValue(),expr,"Invalid first argument.");
     Quantity v2;
-    if (args.size() > 1) {
-        e2 = args[1]->getPyValue();
-        v2 = pyToQuantity(e2,expr,"Invalid second argument.");
-    }
-    Py::Object e3;
+    if (args.size() > 1)
+        v2 = pyToQuantity(args[1]->getPyValue(),expr,"Invalid second argument.");
     Quantity v3;
-    if (args.size() > 2) {
-        e3 = args[2]->getPyValue();
-        v3 = pyToQuantity(e3,expr,"Invalid third argument.");
+    if (args.size() > 2)
+        v3 = pyToQuantity(args[2]->getPyValue(),expr,"Invalid third argument.");
+
+    switch (f) {
+    case ROTATIONX:
+    case ROTATIONY:
+    case ROTATIONZ:
+        if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
+            _EXPR_THROW("Unit must be either empty or an angle.", expr);
+        return Py::asObject(new Base::RotationPy(Base::Rotation(
+            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
+            Base::toRadians(v1.getValue()))));
+    case TRANSLATIONM:
+        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
+            return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
+        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
+    default:
+        break;
     }
 
+    return Py::asObject(new QuantityPy(new Quantity(evaluateQuantity(expr, f, v1, v2, v3, args.size()))));
+}
+
+/**
+  * Evaluate one of the plain numeric functions (ABS to TRUNC) on already
+  * evaluated arguments. Shared by the Python and the native evaluation path.
+  *
+  * @param count Number of arguments given to the function.
+  */
+
+Quantity FunctionExpression::evaluateQuantity(const Expression *expr, int f,
+        const Quantity &v1, const Quantity &v2, const Quantity &v3, std::size_t count)
+{
+    using std::numbers::pi;
+
     double output;
     Unit unit;
     double scaler = 1;
@@ -2405,9 +2511,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case COS:
     case SIN:
     case TAN:
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
         if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
             _EXPR_THROW("Unit must be either empty or an angle.", expr);
 
@@ -2447,7 +2550,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         unit = v1.getUnit().cbrt();
         break;
     case ATAN2:
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (v1.getUnit() != v2.getUnit())
@@ -2456,14 +2559,14 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         scaler = 180.0 / pi;
         break;
     case MOD:
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit() && !v1.isDimensionless() && !v2.isDimensionless())
             _EXPR_THROW("Units must be equal or dimensionless.",expr);
         unit = v1.getUnit();
         break;
     case POW: {
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (!v2.isDimensionless())
@@ -2481,23 +2584,17 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     case HYPOT:
     case CATH:
-        if (e2.isNone())
+        if (count < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit())
             _EXPR_THROW("Units must be equal.",expr);
 
-        if (args.size() > 2) {
-            if (e3.isNone())
-                _EXPR_THROW("Invalid second argument.",expr);
+        if (count > 2) {
             if (v2.getUnit() != v3.getUnit())
                 _EXPR_THROW("Units must be equal.",expr);
         }
         unit = v1.getUnit();
         break;
-    case TRANSLATIONM:
-        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
-            break;
-        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
@@ -2562,11 +2659,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case HYPOT: {
-        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (count > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case CATH: {
-        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (count > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case ROUND:
@@ -2581,25 +2678,32 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case FLOOR:
         output = floor(value);
         break;
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
-        return Py::asObject(new Base::RotationPy(Base::Rotation(
-            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
-            value)));
-    case TRANSLATIONM:
-        return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
 
-    return Py::asObject(new QuantityPy(new Quantity(scaler * output, unit)));
+    return Quantity(scaler * output, unit);
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
     return evaluate(this,f,args);
 }
 
+bool FunctionExpression::_compile(ExpressionProgram &prog) const {
+    if(f == HIDDENREF || f == HREF)
+        return owner && !args.empty() && args[0]->compile(prog);
+
+    // Only the plain numeric functions, all others produce Python objects
+    if(f <= NONE || f >= VANGLE || args.empty() || args.size() > 3)
+        return false;
+    for(auto arg : args) {
+        if(!arg->compile(prog))
+            return false;
+    }
+    prog.add(ExpressionProgram::Function, f, this, static_cast<int>(args.size()));
+    return true;
+}
+
 /**
   * Try to simplify the expression, i.e calculate all constant expressions.
   *
@@ -2914,6 +3018,11 @@ Py::Object VariableExpression::_getPyValue() const {
     return var.getPyValue(true);
 }
 
+bool VariableExpression::_compile(ExpressionProgram &prog) const {
+    prog.add(ExpressionProgram::Variable, 0, this, 0, &var);
+    return true;
+}
+
 void VariableExpression::_toString(std::ostream &ss, bool persistent,int) const {
     if(persistent)
         ss << var.toPersistentString();
@@ -3193,6 +3302,20 @@ Py::Object ConditionalExpression::_getPyValue() const {
         return falseExpr->getPyValue();
 }
 
+bool ConditionalExpression::_compile(ExpressionProgram &prog) const {
+    if(!condition->compile(prog))
+        return false;
+    int jumpFalse = prog.add(ExpressionProgram::JumpIfFalse);
+    if(!trueExpr->compile(prog))
+        return false;
+    int jumpEnd = prog.add(ExpressionProgram::Jump);
+    prog.setJumpTarget(jumpFalse, prog.size());
+    if(!falseExpr->compile(prog))
+        return false;
+    prog.setJumpTarget(jumpEnd, prog.size());
+    return true;
+}
+
 Expression *ConditionalExpression::simplify() const
 {
     std::unique_ptr<Expression> e(condition->simplify());
@@ -3279,6 +3402,16 @@ Py::Object ConstantExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool ConstantExpression::_compile(ExpressionProgram &prog) const {
+    if(strcmp(name,"None")==0)
+        return false;
+    if(strcmp(name,"True")==0 || strcmp(name,"False")==0) {
+        prog.add(ExpressionProgram::Boolean, strcmp(name,"True")==0 ? 1 : 0, this);
+        return true;
+    }
+    return NumberExpression::_compile(prog);
+}
+
 bool ConstantExpression::isNumber() const {
     return strcmp(name,"None")
         && strcmp(name,"True")
@@ -3457,6 +3590,515 @@ void RangeExpression::_offsetCells(int rowOffset, int colOffset, ExpressionVisit
 }
 
 
+//
+// ExpressionProgram class
+//
+// The native evaluator mirrors what the Python objects do in calc() and
+// FunctionExpression::evaluate(), for int, bool, float and Base::Quantity
+// values. Anything it cannot reproduce exactly, including every error, makes
+// run() return false, so that the Python path can produce the proper result
+// or exception.
+//
+
+namespace {
+
+struct NativeValue {
+    enum Type {
+        TypeBool,
+        TypeLong,
+        TypeFloat,
+        TypeQuantity,
+    };
+
+    Type type = TypeLong;
+    long l = 0;
+    double d = 0.0;
+    Quantity q;
+
+    bool isInteger() const {
+        return type == TypeBool || type == TypeLong;
+    }
+
+    double toDouble() const {
+        switch(type) {
+        case TypeFloat:
+            return d;
+        case TypeQuantity:
+            return q.getValue();
+        default:
+            return static_cast<double>(l);
+        }
+    }
+
+    Quantity toQuantity() const {
+        if(type == TypeQuantity)
+            return q;
+        return Quantity(toDouble());
+    }
+
+    bool isTrue() const {
+        switch(type) {
+        case TypeFloat:
+            return d != 0.0;
+        case TypeQuantity:
+            return q.getValue() != 0.0;
+        default:
+            return l != 0;
+        }
+    }
+
+    void setBool(bool v) { type = TypeBool; l = v ? 1 : 0; }
+    void setLong(long v) { type = TypeLong; l = v; }
+    void setFloat(double v) { type = TypeFloat; d = v; }
+    void setQuantity(const Quantity &v) { type = TypeQuantity; q = v; }
+};
+
+// Python integers are unbounded and compared with floats exactly, so integer
+// results are only trusted within the range a double represents exactly.
+constexpr double maxExactInteger = 9007199254740992.0;
+
+inline bool isExact(long v) {
+    return std::fabs(static_cast<double>(v)) <= maxExactInteger;
+}
+
+bool addLong(long a, long b, long &res) {
+    if((b > 0 && a > std::numeric_limits<long>::max() - b)
+            || (b < 0 && a < std::numeric_limits<long>::min() - b))
+        return false;
+    res = a + b;
+    return true;
+}
+
+bool subtractLong(long a, long b, long &res) {
+    if((b < 0 && a > std::numeric_limits<long>::max() + b)
+            || (b > 0 && a < std::numeric_limits<long>::min() + b))
+        return false;
+    res = a - b;
+    return true;
+}
+
+bool multiplyLong(long a, long b, long &res) {
+    constexpr long maxLong = std::numeric_limits<long>::max();
+    constexpr long minLong = std::numeric_limits<long>::min();
+    if(a != 0 && b != 0) {
+        if(a > 0) {
+            if(b > 0 ? a > maxLong / b : b < minLong / a)
+                return false;
+        }
+        else if(b > 0 ? a < minLong / b : a < maxLong / b)
+            return false;
+    }
+    res = a * b;
+    return true;
+}
+
+bool powerLong(long base, long exponent, long &res) {
+    long result = 1;
+    while(exponent > 0) {
+        if((exponent & 1) && !multiplyLong(result, base, result))
+            return false;
+        exponent >>= 1;
+        if(exponent > 0 && !multiplyLong(base, base, base))
+            return false;
+    }
+    res = result;
+    return true;
+}
+
+bool moduloLong(long a, long b, long &res) {
+    if(b == 0)
+        return false;
+    if(b == -1) {
+        res = 0;
+        return true;
+    }
+    long mod = a % b;
+    if(mod != 0 && ((mod < 0) != (b < 0)))
+        mod += b;
+    res = mod;
+    return true;
+}
+
+bool moduloFloat(double a, double b, double &res) {
+    if(b == 0.0)
+        return false;
+    double mod = std::fmod(a, b);
+    if(mod != 0.0) {
+        if((b < 0.0) != (mod < 0.0))
+            mod += b;
+    }
+    else
+        mod = std::copysign(0.0, b);
+    res = mod;
+    return true;
+}
+
+bool powerFloat(double a, double b, double &res) {
+    if(b == 0.0) {
+        res = 1.0;
+        return true;
+    }
+    // ZeroDivisionError, complex result and OverflowError in Python
+    if(a == 0.0 && b < 0.0)
+        return false;
+    if(a < 0.0 && std::isfinite(a) && std::isfinite(b) && b != std::floor(b))
+        return false;
+    res = std::pow(a, b);
+    return !(std::isinf(res) && std::isfinite(a) && std::isfinite(b));
+}
+
+bool compare(int op, const NativeValue &l, const NativeValue &r, bool &res) {
+    using OP = OperatorExpression;
+
+    if(l.type == NativeValue::TypeQuantity && r.type == NativeValue::TypeQuantity) {
+        // Same as QuantityPy::richCompare()
+        const Quantity &a = l.q;
+        const Quantity &b = r.q;
+        switch(op) {
+        case OP::EQ: res = a == b; break;
+        case OP::NEQ: res = !(a == b); break;
+        case OP::LT: res = a < b; break;
+        case OP::LTE: res = a < b || a == b; break;
+        case OP::GT: res = !(a < b) && !(a == b); break;
+        case OP::GTE: res = !(a < b); break;
+        default: return false;
+        }
+        return true;
+    }
+
+    if(l.isInteger() && r.isInteger()) {
+        switch(op) {
+        case OP::EQ: res = l.l == r.l; break;
+        case OP::NEQ: res = l.l != r.l; break;
+        case OP::LT: res = l.l < r.l; break;
+        case OP::LTE: res = l.l <= r.l; break;
+        case OP::GT: res = l.l > r.l; break;
+        case OP::GTE: res = l.l >= r.l; break;
+        default: return false;
+        }
+        return true;
+    }
+
+    if((l.isInteger() && !isExact(l.l)) || (r.isInteger() && !isExact(r.l)))
+        return false;
+    double a = l.toDouble();
+    double b = r.toDouble();
+    switch(op) {
+    case OP::EQ: res = a == b; break;
+    case OP::NEQ: res = a != b; break;
+    case OP::LT: res = a < b; break;
+    case OP::LTE: res = a <= b; break;
+    case OP::GT: res = a > b; break;
+    case OP::GTE: res = a >= b; break;
+    default: return false;
+    }
+    return true;
+}
+
+bool unaryOperation(int op, NativeValue &v) {
+    switch(v.type) {
+    case NativeValue::TypeQuantity:
+        if(op == OperatorExpression::NEG)
+            v.q = v.q * -1.0;
+        return op == OperatorExpression::NEG || op == OperatorExpression::POS;
+    case NativeValue::TypeFloat:
+        if(op == OperatorExpression::NEG)
+            v.d = -v.d;
+        return op == OperatorExpression::NEG || op == OperatorExpression::POS;
+    default:
+        if(op == OperatorExpression::NEG) {
+            if(v.l == std::numeric_limits<long>::min())
+                return false;
+            v.setLong(-v.l);
+            return true;
+        }
+        v.setLong(v.l);
+        return op == OperatorExpression::POS;
+    }
+}
+
+bool binaryOperation(int op, const NativeValue &l, const NativeValue &r, NativeValue &res) {
+    using OP = OperatorExpression;
+
+    bool isQuantity = l.type == NativeValue::TypeQuantity;
+    bool isRightQuantity = r.type == NativeValue::TypeQuantity;
+
+    switch(op) {
+    case OP::EQ:
+    case OP::NEQ:
+    case OP::LT:
+    case OP::LTE:
+    case OP::GT:
+    case OP::GTE: {
+        bool v;
+        if(!compare(op, l, r, v))
+            return false;
+        res.setBool(v);
+        return true;
+    }
+    case OP::ADD:
+    case OP::SUB:
+    case OP::MUL:
+    case OP::UNIT:
+    case OP::DIV:
+        if(isQuantity || isRightQuantity) {
+            Quantity a = l.toQuantity();
+            Quantity b = r.toQuantity();
+            switch(op) {
+            case OP::ADD: res.setQuantity(a + b); break;
+            case OP::SUB: res.setQuantity(a - b); break;
+            case OP::DIV: res.setQuantity(a / b); break;
+            default: res.setQuantity(a * b); break;
+            }
+            return true;
+        }
+        if(l.isInteger() && r.isInteger()) {
+            long v = 0;
+            switch(op) {
+            case OP::ADD:
+                if(!addLong(l.l, r.l, v))
+                    return false;
+                break;
+            case OP::SUB:
+                if(!subtractLong(l.l, r.l, v))
+                    return false;
+                break;
+            case OP::DIV:
+                if(r.l == 0 || !isExact(l.l) || !isExact(r.l))
+                    return false;
+                res.setFloat(static_cast<double>(l.l) / static_cast<double>(r.l));
+                return true;
+            default:
+                if(!multiplyLong(l.l, r.l, v))
+                    return false;
+                break;
+            }
+            res.setLong(v);
+            return true;
+        }
+        switch(op) {
+        case OP::ADD: res.setFloat(l.toDouble() + r.toDouble()); break;
+        case OP::SUB: res.setFloat(l.toDouble() - r.toDouble()); break;
+        case OP::DIV:
+            if(r.toDouble() == 0.0)
+                return false;
+            res.setFloat(l.toDouble() / r.toDouble());
+            break;
+        default: res.setFloat(l.toDouble() * r.toDouble()); break;
+        }
+        return true;
+    case OP::POW: {
+        // Same as QuantityPy::number_power_handler(), which requires the base
+        // to be a quantity
+        if(isQuantity) {
+            res.setQuantity(isRightQuantity ? l.q.pow(r.q) : l.q.pow(r.toDouble()));
+            return true;
+        }
+        if(isRightQuantity)
+            return false;
+        if(l.isInteger() && r.isInteger() && r.l >= 0) {
+            long v;
+            if(!powerLong(l.l, r.l, v))
+                return false;
+            res.setLong(v);
+            return true;
+        }
+        if((l.isInteger() && !isExact(l.l)) || (r.isInteger() && !isExact(r.l)))
+            return false;
+        double v;
+        if(!powerFloat(l.toDouble(), r.toDouble(), v))
+            return false;
+        res.setFloat(v);
+        return true;
+    }
+    case OP::MOD: {
+        // Same as QuantityPy::number_remainder_handler()
+        if(isQuantity) {
+            double v;
+            if(!moduloFloat(l.q.getValue(), r.toDouble(), v))
+                return false;
+            res.setQuantity(Quantity(v, l.q.getUnit()));
+            return true;
+        }
+        if(isRightQuantity)
+            return false;
+        if(l.isInteger() && r.isInteger()) {
+            long v;
+            if(!moduloLong(l.l, r.l, v))
+                return false;
+            res.setLong(v);
+            return true;
+        }
+        double v;
+        if(!moduloFloat(l.toDouble(), r.toDouble(), v))
+            return false;
+        res.setFloat(v);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool readProperty(const ObjectIdentifier &path, NativeValue &v) {
+    // Only properties whose Python object is a plain number or quantity
+    const Property *prop = path.getDirectProperty();
+    if(!prop)
+        return false;
+    if(prop->isDerivedFrom<PropertyQuantity>()) {
+        auto p = static_cast<const PropertyQuantity*>(prop);
+        v.setQuantity(Quantity(p->getValue(), p->getUnit()));
+    }
+    else if(prop->isDerivedFrom<PropertyFloat>())
+        v.setFloat(static_cast<const PropertyFloat*>(prop)->getValue());
+    else if(prop->isDerivedFrom<PropertyInteger>())
+        v.setLong(static_cast<const PropertyInteger*>(prop)->getValue());
+    else if(prop->isDerivedFrom<PropertyBool>())
+        v.setBool(static_cast<const PropertyBool*>(prop)->getValue());
+    else
+        return false;
+    return true;
+}
+
+} // anonymous namespace
+
+int ExpressionProgram::add(OpCode code, int arg, const Expression *expr,
+                           int count, const ObjectIdentifier *path)
+{
+    instructions.push_back({code, arg, count, expr, path});
+    if(code == Constant || code == Boolean || code == Variable)
+        ++stackSize;
+    return static_cast<int>(instructions.size()) - 1;
+}
+
+void ExpressionProgram::setJumpTarget(int index, int target)
+{
+    instructions[index].arg = target;
+}
+
+void ExpressionProgram::clear()
+{
+    instructions.clear();
+    stackSize = 0;
+}
+
+bool ExpressionProgram::run(App::any &value, bool keepBool) const
+{
+    std::vector<NativeValue> stack;
+    stack.reserve(stackSize);
+
+    try {
+        const int count = size();
+        for(int pc = 0; pc < count;) {
+            const Instruction &ins = instructions[pc++];
+            switch(ins.code) {
+            case Constant: {
+                // Same as pyFromQuantity()
+                const Quantity &q = static_cast<const UnitExpression*>(ins.expr)->getQuantity();
+                NativeValue v;
+                if(!q.getUnit().isEmpty())
+                    v.setQuantity(q);
+                else {
+                    long l;
+                    int i;
+                    switch(essentiallyInteger(q.getValue(), l, i)) {
+                    case 0:
+                        v.setFloat(q.getValue());
+                        break;
+                    case 1:
+                        v.setLong(l);
+                        break;
+                    default:
+                        return false;
+                    }
+                }
+                stack.push_back(v);
+                break;
+            }
+            case Boolean: {
+                NativeValue v;
+                v.setBool(ins.arg != 0);
+                stack.push_back(v);
+                break;
+            }
+            case Variable: {
+                NativeValue v;
+                if(!readProperty(*ins.path, v))
+                    return false;
+                stack.push_back(v);
+                break;
+            }
+            case Unary:
+                if(!unaryOperation(ins.arg, stack.back()))
+                    return false;
+                break;
+            case Binary: {
+                NativeValue res;
+                if(!binaryOperation(ins.arg, stack[stack.size()-2], stack.back(), res))
+                    return false;
+                stack.pop_back();
+                stack.back() = res;
+                break;
+            }
+            case Function: {
+                if(!ins.expr->getOwner())
+                    return false;
+                auto first = stack.end() - ins.count;
+                Quantity v1 = first->toQuantity();
+                Quantity v2 = ins.count > 1 ? first[1].toQuantity() : Quantity();
+                Quantity v3 = ins.count > 2 ? first[2].toQuantity() : Quantity();
+                NativeValue res;
+                res.setQuantity(FunctionExpression::evaluateQuantity(
+                            ins.expr, ins.arg, v1, v2, v3, ins.count));
+                stack.erase(first, stack.end());
+                stack.push_back(res);
+                break;
+            }
+            case Jump:
+                pc = ins.arg;
+                break;
+            case JumpIfFalse: {
+                bool condition = stack.back().isTrue();
+                stack.pop_back();
+                if(!condition)
+                    pc = ins.arg;
+                break;
+            }
+            }
+        }
+    }
+    catch(Base::Exception &) {
+        return false;
+    }
+    catch(std::exception &) {
+        return false;
+    }
+
+    if(stack.size() != 1)
+        return false;
+
+    // Same as pyObjectToAny(), where Python bool is a subclass of int
+    const NativeValue &res = stack.back();
+    switch(res.type) {
+    case NativeValue::TypeBool:
+        if(keepBool)
+            value = res.l != 0;
+        else
+            value = res.l;
+        break;
+    case NativeValue::TypeFloat:
+        value = res.d;
+        break;
+    case NativeValue::TypeQuantity:
+        value = res.q;
+        break;
+    default:
+        value = res.l;
+        break;
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 
 static Base::XMLReader *_Reader = nullptr;
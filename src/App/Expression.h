@@ -23,9 +23,12 @@
 #ifndef EXPRESSION_H
 #define EXPRESSION_H
 
+#include <atomic>
 #include <deque>
+#include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <App/PropertyLinks.h>
 #include <App/ObjectIdentifier.h>
@@ -43,6 +46,7 @@ namespace App  {
 
 class DocumentObject;
 class Expression;
+class ExpressionProgram;
 class Document;
 
 using ExpressionPtr = std::unique_ptr<Expression>;
@@ -188,6 +192,12 @@ public:
 
     Py::Object getPyValue() const;
 
+    bool getNativeValue(App::any &value, bool keepBool = false) const;
+
+    bool prepareNativeValue() const;
+
+    bool compile(ExpressionProgram &program) const;
+
     bool isSame(const Expression &other, bool checkComment=true) const;
 
     friend class ExpressionVisitor;
@@ -214,19 +224,74 @@ protected:
     virtual void _moveCells(const CellAddress &, int, int, ExpressionVisitor &) {}
     virtual void _offsetCells(int, int, ExpressionVisitor &) {}
     virtual Py::Object _getPyValue() const = 0;
+    virtual bool _compile(ExpressionProgram &) const {return false;}
     virtual void _visit(ExpressionVisitor &) {}
 
+    const ExpressionProgram &nativeProgram() const;
+
 protected:
     // clang-format off
     App::DocumentObject * owner; /**< The document object used to access unqualified variables (i.e local scope) */
 
     ComponentList components;
 
+    mutable std::atomic<ExpressionProgram*> program {nullptr}; /**< Lazily compiled native program, empty if not supported */
+
 public:
     std::string comment;
     // clang-format on
 };
 
+/**
+  * @brief Native byte code for the numeric subset of expressions.
+  * @ingroup ExpressionFramework
+  *
+  * @details Expression::compile() lowers an expression tree into a flat list
+  * of stack machine instructions, which run() evaluates without Python or the
+  * global interpreter lock. The instructions refer back to the expression
+  * nodes, so constants and property paths are read at evaluation time.
+  *
+  * The result has the same type the Python evaluation gives through
+  * pyObjectToAny(), i.e. long, double or Base::Quantity. Whenever the outcome
+  * could differ from Python, e.g. on errors, integer overflow or unsupported
+  * property types, run() returns false and the caller has to fall back to
+  * Expression::getPyValue().
+  */
+class AppExport ExpressionProgram {
+public:
+    enum OpCode {
+        Constant,       /**< Push the quantity of the UnitExpression expr */
+        Boolean,        /**< Push arg as boolean */
+        Variable,       /**< Push the value of the property referred to by path */
+        Unary,          /**< Apply OperatorExpression::Operator arg to the top value */
+        Binary,         /**< Apply OperatorExpression::Operator arg to the two top values */
+        Function,       /**< Apply FunctionExpression::Function arg to the count top values */
+        Jump,           /**< Continue at instruction arg */
+        JumpIfFalse,    /**< Pop a value and continue at instruction arg if it is false */
+    };
+
+    struct Instruction {
+        OpCode code;
+        int arg;
+        int count;
+        const Expression *expr;
+        const ObjectIdentifier *path;
+    };
+
+    int add(OpCode code, int arg = 0, const Expression *expr = nullptr,
+            int count = 0, const ObjectIdentifier *path = nullptr);
+    void setJumpTarget(int index, int target);
+    int size() const { return static_cast<int>(instructions.size()); }
+    bool empty() const { return instructions.empty(); }
+    void clear();
+
+    bool run(App::any &value, bool keepBool = false) const;
+
+private:
+    std::vector<Instruction> instructions;
+    int stackSize{0};
+};
+
 }
 
 #endif // EXPRESSION_H
@@ -118,6 +118,7 @@ protected:
     Expression* _copy() const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
 
 protected:
     mutable PyObject* cache = nullptr;
@@ -168,6 +169,7 @@ public:
 
 protected:
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Expression* _copy() const override;
 
@@ -237,6 +239,8 @@ protected:
 
     Py::Object _getPyValue() const override;
 
+    bool _compile(ExpressionProgram& program) const override;
+
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
 
     void _visit(ExpressionVisitor& v) override;
@@ -275,6 +279,7 @@ protected:
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
 
 protected:
     Expression* condition; /**< Condition */
@@ -393,6 +398,13 @@ public:
     static Py::Object
     evaluate(const Expression* owner, int type, const std::vector<Expression*>& args);
 
+    static Base::Quantity evaluateQuantity(const Expression* owner,
+                                           int type,
+                                           const Base::Quantity& v1,
+                                           const Base::Quantity& v2,
+                                           const Base::Quantity& v3,
+                                           std::size_t count);
+
     Function getFunction() const
     {
         return f;
@@ -421,6 +433,7 @@ protected:
                                              const Base::Matrix4D* transformationMatrix);
     static Py::Object translationMatrix(double x, double y, double z);
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
@@ -471,6 +484,7 @@ public:
 protected:
     Expression* _copy() const override;
     Py::Object _getPyValue() const override;
+    bool _compile(ExpressionProgram& program) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     bool _isIndexable() const override;
     void _getIdentifiers(std::map<App::ObjectIdentifier, bool>&) const override;
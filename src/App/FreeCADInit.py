@@ -74,6 +74,10 @@ FreeCAD._importFromFreeCAD = removeFromPath
 
 
 def InitApplications():
+    MetadataCache = FreeCAD.__ModuleMetadataCache__
+    Timer = FreeCAD.__StartupTimer__
+    Timer.begin('Searching for modules')
+
     # Checking on FreeCAD module path ++++++++++++++++++++++++++++++++++++++++++
     ModDir = FreeCAD.getHomePath()+'Mod'
     ModDir = os.path.realpath(ModDir)
@@ -176,6 +180,8 @@ def InitApplications():
     if os.path.isdir(additional_packages_path):
         sys.path.append(additional_packages_path)
 
+    Timer.end()
+
     def RunInitPy(Dir):
         InstallFile = os.path.join(Dir,"Init.py")
         if (os.path.exists(InstallFile)):
@@ -195,7 +201,7 @@ def InitApplications():
             Log('Init:      Initializing ' + Dir + '(Init.py not found)... ignore\n')
 
     def processMetadataFile(MetadataFile):
-        meta = FreeCAD.Metadata(MetadataFile)
+        meta = MetadataCache.get(MetadataFile)
         if not meta.supportsCurrentFreeCAD():
             Msg(f'NOTICE: {meta.Name} does not support this version of FreeCAD, so is being skipped\n')
             return None
@@ -248,13 +254,15 @@ def InitApplications():
             sys.path.insert(0,Dir)
             PathExtension.append(Dir)
             MetadataFile = os.path.join(Dir, "package.xml")
-            if os.path.exists(MetadataFile):
-                tryProcessMetadataFile(MetadataFile)
-            else:
-                RunInitPy(Dir)
+            with Timer.phase('Init ' + Dir):
+                if os.path.exists(MetadataFile):
+                    tryProcessMetadataFile(MetadataFile)
+                else:
+                    RunInitPy(Dir)
 
     extension_modules = []
 
+    Timer.begin('Init freecad.* extension modules')
     try:
         import pkgutil
         import importlib
@@ -272,7 +280,7 @@ def InitApplications():
                     # Make sure that package.xml (if present) does not exclude this version of FreeCAD
                     MetadataFile = os.path.join(FreeCAD.getUserAppDataDir(), "Mod", freecad_module_name[8:], "package.xml")
                     if os.path.exists(MetadataFile):
-                        meta = FreeCAD.Metadata(MetadataFile)
+                        meta = MetadataCache.get(MetadataFile)
                         if not meta.supportsCurrentFreeCAD():
                             Msg(f'NOTICE: Addon "{freecad_module_name}" does not support this version of FreeCAD, so is being skipped\n')
                             continue
@@ -295,6 +303,11 @@ def InitApplications():
                     Log('-'*80+'\n')
     except ImportError as inst:
         Err('During initialization the error "' + str(inst) + '" occurred\n')
+    Timer.end()
+
+    MetadataCache.save()
+    Log('Init: module metadata cache: %d reused, %d parsed\n' % (MetadataCache.hits, MetadataCache.misses))
+    Timer.report('Application module initialization')
 
     Log("Using "+ModDir+" as module path!\n")
     # In certain cases the PathExtension list can contain invalid strings. We concatenate them to a single string
@@ -702,6 +715,172 @@ class FCADLogger(object):
 
 FreeCAD.Logger = FCADLogger
 
+class ModuleMetadataCache(object):
+    '''On-disk cache of the package.xml content needed to start up.
+
+       Parsing package.xml goes through the XML reader of FreeCAD.Metadata,
+       which for a large number of installed addons is a noticeable part of
+       the start up time. This class keeps the few fields used by the init
+       scripts in a marshal file in the user cache directory. An entry is
+       reused as long as the size and modification time of its package.xml are
+       unchanged, or when the content still has the same hash. The whole cache
+       is discarded when the FreeCAD version changes, because the version
+       checks are stored with it.
+
+       Set BaseApp/Preferences/General/UseModuleMetadataCache to False to
+       always parse package.xml.
+    '''
+
+    FormatVersion = 1
+
+    class Workbench(object):
+        '''Duck typed replacement for the FreeCAD.Metadata of a workbench'''
+        def __init__(self, name, subdirectory, classname, icon, supported):
+            self.Name = name
+            self.Subdirectory = subdirectory
+            self.Classname = classname
+            self.Icon = icon
+            self._supported = supported
+
+        def supportsCurrentFreeCAD(self):
+            return self._supported
+
+    class Package(object):
+        '''Duck typed replacement for FreeCAD.Metadata with the fields used at start up'''
+        def __init__(self, name, supported, workbenches):
+            self.Name = name
+            self._supported = supported
+            self.Content = {}
+            if workbenches:
+                self.Content["workbench"] = \
+                        [ModuleMetadataCache.Workbench(*w) for w in workbenches]
+
+        def supportsCurrentFreeCAD(self):
+            return self._supported
+
+    def __init__(self):
+        import marshal
+        self.fileName = os.path.join(FreeCAD.getUserCachePath(), "ModuleMetadata.cache")
+        self.enabled = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/General")\
+                .GetBool("UseModuleMetadataCache", True)
+        self.key = (self.FormatVersion, tuple(FreeCAD.Version()[:4]))
+        self.entries = {}
+        self.used = set()
+        self.dirty = False
+        self.hits = 0
+        self.misses = 0
+        if not self.enabled:
+            return
+        try:
+            with open(self.fileName, 'rb') as f:
+                key, entries = marshal.load(f)
+            if key == self.key:
+                self.entries = entries
+        except Exception:
+            # missing, stale or corrupted cache, start from scratch
+            pass
+
+    def get(self, MetadataFile):
+        '''Return the metadata of MetadataFile, parsing it only when it has changed'''
+        if not self.enabled:
+            return FreeCAD.Metadata(MetadataFile)
+        import hashlib
+        st = os.stat(MetadataFile)
+        stamp = (st.st_mtime_ns, st.st_size)
+        self.used.add(MetadataFile)
+        entry = self.entries.get(MetadataFile)
+        if entry and entry[0] == stamp:
+            self.hits += 1
+            return self.Package(*entry[2])
+        with open(MetadataFile, 'rb') as f:
+            digest = hashlib.sha1(f.read()).hexdigest()
+        self.dirty = True
+        if entry and entry[1] == digest:
+            # touched but not modified, e.g. by a checkout
+            self.hits += 1
+            self.entries[MetadataFile] = (stamp, digest, entry[2])
+            return self.Package(*entry[2])
+        self.misses += 1
+        meta = FreeCAD.Metadata(MetadataFile)
+        workbenches = []
+        for workbench in meta.Content.get("workbench", []):
+            workbenches.append((workbench.Name, workbench.Subdirectory,
+                                workbench.Classname, workbench.Icon,
+                                workbench.supportsCurrentFreeCAD()))
+        data = (meta.Name, meta.supportsCurrentFreeCAD(), workbenches)
+        self.entries[MetadataFile] = (stamp, digest, data)
+        return self.Package(*data)
+
+    def save(self):
+        '''Write the cache back if anything changed, dropping unused entries'''
+        if not self.enabled:
+            return
+        stale = [name for name in self.entries if name not in self.used]
+        if not self.dirty and not stale:
+            return
+        for name in stale:
+            del self.entries[name]
+        import marshal
+        tmpName = self.fileName + '.tmp'
+        try:
+            with open(tmpName, 'wb') as f:
+                marshal.dump((self.key, self.entries), f)
+            os.replace(tmpName, self.fileName)
+            self.dirty = False
+        except Exception as e:
+            Log('Init: failed to write module metadata cache: ' + str(e) + '\n')
+
+class StartupTimer(object):
+    '''Collects the duration of the start up phases for a timing report.
+
+       Example usage:
+           >>> with FreeCAD.__StartupTimer__.phase('Init MyModule'):
+           ...     initMyModule()
+           >>> FreeCAD.__StartupTimer__.report('Module initialization')
+    '''
+
+    class Phase(object):
+        def __init__(self, timer, name):
+            self.timer = timer
+            self.name = name
+
+        def __enter__(self):
+            self.timer.begin(self.name)
+            return self
+
+        def __exit__(self, *args):
+            self.timer.end()
+            return False
+
+    def __init__(self):
+        import time
+        self.clock = time.perf_counter
+        self.phases = []
+        self.current = None
+
+    def phase(self, name):
+        '''Return a context manager timing its block as phase name'''
+        return StartupTimer.Phase(self, name)
+
+    def begin(self, name):
+        self.current = (name, self.clock())
+
+    def end(self):
+        name, start = self.current
+        self.phases.append((name, self.clock() - start))
+        self.current = None
+
+    def report(self, title):
+        '''Log the recorded phases, slowest first, and start over'''
+        total = sum(duration for _, duration in self.phases)
+        Log('Init: ' + title + ' took %.3f s\n' % total)
+        for name, duration in sorted(self.phases, key=lambda p: -p[1]):
+            Log('Init:    %8.3f s  %s\n' % (duration, name))
+        self.phases = []
+
+FreeCAD.__ModuleMetadataCache__ = ModuleMetadataCache()
+FreeCAD.__StartupTimer__ = StartupTimer()
+
 # init every application by importing Init.py
 try:
     InitApplications()
@@ -1416,6 +1416,25 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+/**
+ * @brief Get pointer to the property if this object identifier refers to the
+ * whole property value.
+ * @return Pointer to the property, or 0 if the identifier cannot be resolved,
+ * refers to a pseudo property, or continues into the property value (e.g.
+ * Placement.Base.x).
+ */
+
+Property* ObjectIdentifier::getDirectProperty() const
+{
+    ResolveResults result(*this);
+    if (result.propertyType != PseudoNone
+        || result.propertyIndex + 1 != static_cast<int>(components.size())
+        || (!subObjectName.getString().empty() && !result.resolvedSubObject)) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
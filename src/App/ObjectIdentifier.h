@@ -426,6 +426,8 @@ public:
 
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    App::Property* getDirectProperty() const;
+
     App::ObjectIdentifier canonicalPath() const;
 
     // Document-centric functions
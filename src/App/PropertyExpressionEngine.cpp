@@ -22,6 +22,10 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#endif
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
@@ -83,7 +87,71 @@ struct PropertyExpressionEngine::Private
     // defined in header, hence the private structure here.
     std::vector<boost::signals2::scoped_connection> conns;
     std::unordered_map<std::string, std::vector<ObjectIdentifier>> propMap;
+
+    // Properties read or written by a binding, as registered in _BindingSources
+    struct Binding
+    {
+        const Expression* expression = nullptr;
+        std::vector<const Property*> sources;
+        bool resolved = false;
+    };
+    std::map<ObjectIdentifier, Binding> bindings;
+    // Reverse map from a source property to the bindings using it
+    struct Source
+    {
+        Document* doc = nullptr;
+        std::vector<ObjectIdentifier> paths;
+    };
+    std::unordered_map<const Property*, Source> sourceMap;
+    // Bindings to be evaluated on next execute()
+    std::set<ObjectIdentifier> dirty;
+    // Bindings reported through expressionChanged since the last update
+    std::set<ObjectIdentifier> changed;
+    bool synced = false;
+    boost::signals2::scoped_connection connExpressionChanged;
+};
+
+/* Per document index of the properties used by expression bindings. It maps
+ * each property to the engines with a binding reading or writing it, so that
+ * a property change only marks the bindings actually depending on it. A
+ * property is registered under the document owning it. The index of a document
+ * holds the connections to the signals of that document, and is dropped
+ * together with them when the document is deleted. The property pointers are
+ * only used as keys and never dereferenced, which leaves a stale entry
+ * harmless, i.e. it can only cause an extra evaluation.
+ */
+using BindingSourceMap = std::unordered_map<const Property*, std::set<PropertyExpressionEngine*>>;
+struct BindingSourceIndex
+{
+    BindingSourceMap sources;
+    std::vector<boost::signals2::scoped_connection> conns;
 };
+static std::unordered_map<const Document*, BindingSourceIndex> _BindingSources;
+
+static Document* getBindingSourceDocument(const Property* prop)
+{
+    auto owner = freecad_cast<DocumentObject*>(prop->getContainer());
+    return owner ? owner->getDocument() : nullptr;
+}
+
+static void unregisterBindingSource(const Document* doc,
+                                    const Property* prop,
+                                    PropertyExpressionEngine* engine)
+{
+    auto itDoc = _BindingSources.find(doc);
+    if (itDoc == _BindingSources.end()) {
+        return;
+    }
+    auto& sources = itDoc->second.sources;
+    auto it = sources.find(prop);
+    if (it == sources.end()) {
+        return;
+    }
+    it->second.erase(engine);
+    if (it->second.empty()) {
+        sources.erase(it);
+    }
+}
 
 ///////////////////////////////////////////////////////////////////////////////////////
 
@@ -95,13 +163,23 @@ TYPESYSTEM_SOURCE(App::PropertyExpressionEngine, App::PropertyExpressionContaine
 
 PropertyExpressionEngine::PropertyExpressionEngine()
     : validator(0)
-{}
+    , pimpl(std::make_unique<Private>())
+{
+    pimpl->connExpressionChanged = expressionChanged.connect([this](const ObjectIdentifier& path) {
+        pimpl->changed.insert(path);
+    });
+}
 
 /**
  * @brief Destroy the PropertyExpressionEngine object.
  */
 
-PropertyExpressionEngine::~PropertyExpressionEngine() = default;
+PropertyExpressionEngine::~PropertyExpressionEngine()
+{
+    for (auto& v : pimpl->sourceMap) {
+        unregisterBindingSource(v.second.doc, v.first, this);
+    }
+}
 
 /**
  * @brief Estimate memory size of this property.
@@ -136,6 +214,10 @@ Property* PropertyExpressionEngine::Copy() const
 void PropertyExpressionEngine::hasSetValue()
 {
     App::DocumentObject* owner = dynamic_cast<App::DocumentObject*>(getContainer());
+    // Sources are collected lazily on next execute(). The old ones stay
+    // registered meanwhile to keep catching changes of unmodified bindings.
+    pimpl->synced = false;
+
     if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
         || testFlag(LinkDetached)) {
         PropertyExpressionContainer::hasSetValue();
@@ -159,10 +241,8 @@ void PropertyExpressionEngine::hasSetValue()
 
     updateDeps(std::move(deps));
 
-    if (pimpl) {
-        pimpl->conns.clear();
-        pimpl->propMap.clear();
-    }
+    pimpl->conns.clear();
+    pimpl->propMap.clear();
     // check if there is any hidden references
     bool hasHidden = false;
     for (auto& v : _Deps) {
@@ -172,9 +252,6 @@ void PropertyExpressionEngine::hasSetValue()
         }
     }
     if (hasHidden) {
-        if (!pimpl) {
-            pimpl = std::make_unique<Private>();
-        }
         for (auto& e : expressions) {
             auto expr = e.second.expression;
             if (!expr) {
@@ -221,9 +298,6 @@ void PropertyExpressionEngine::hasSetValue()
 
 void PropertyExpressionEngine::updateHiddenReference(const std::string& key)
 {
-    if (!pimpl) {
-        return;
-    }
     auto it = pimpl->propMap.find(key);
     if (it == pimpl->propMap.end()) {
         return;
@@ -274,6 +348,277 @@ void PropertyExpressionEngine::slotChangedProperty(const App::DocumentObject&,
     updateHiddenReference(prop.getFullName());
 }
 
+/**
+ * @brief Update the properties registered as sources of the bindings.
+ * @param unresolvedOnly Only collect the bindings with unresolved inputs.
+ *
+ * Any binding whose expression or sources changed is marked for evaluation.
+ */
+
+void PropertyExpressionEngine::updateBindingSources(bool unresolvedOnly)
+{
+    auto owner = freecad_cast<DocumentObject*>(getContainer());
+    if (!owner || !owner->isAttachedToDocument() || testFlag(LinkDetached)) {
+        return;
+    }
+
+    if (!unresolvedOnly) {
+        for (auto it = pimpl->bindings.begin(); it != pimpl->bindings.end();) {
+            if (expressions.count(it->first)) {
+                ++it;
+                continue;
+            }
+            ObjectIdentifier path(it->first);
+            removeBindingSources(path);
+            pimpl->dirty.erase(path);
+            it = pimpl->bindings.erase(it);
+        }
+    }
+
+    for (auto& e : expressions) {
+        auto it = pimpl->bindings.find(e.first);
+        if (unresolvedOnly && it != pimpl->bindings.end() && it->second.resolved) {
+            continue;
+        }
+        collectBindingSources(e.first, e.second.expression, pimpl->changed.count(e.first) > 0);
+    }
+
+    if (!unresolvedOnly) {
+        pimpl->changed.clear();
+        pimpl->synced = true;
+    }
+}
+
+void PropertyExpressionEngine::collectBindingSources(const ObjectIdentifier& path,
+                                                     const std::shared_ptr<Expression>& expression,
+                                                     bool force)
+{
+    std::vector<const Property*> sources;
+    bool resolved = true;
+
+    // The bound property itself, to catch the value being overridden
+    if (auto prop = path.getProperty()) {
+        sources.push_back(prop);
+    }
+    else {
+        resolved = false;
+    }
+
+    if (expression) {
+        for (auto& v : expression->getIdentifiers()) {
+            auto deps = v.first.getDep(true);
+            if (deps.empty()) {
+                resolved = false;
+            }
+            for (auto& dep : deps) {
+                if (dep.second.empty()) {
+                    resolved = false;
+                }
+                for (auto& propName : dep.second) {
+                    auto prop = dep.first->getPropertyByName(propName.c_str());
+                    if (prop) {
+                        sources.push_back(prop);
+                    }
+                    else {
+                        resolved = false;
+                    }
+                }
+            }
+        }
+    }
+    std::sort(sources.begin(), sources.end());
+    sources.erase(std::unique(sources.begin(), sources.end()), sources.end());
+
+    auto& binding = pimpl->bindings[path];
+    if (force || !resolved || !binding.resolved || binding.expression != expression.get()
+        || binding.sources != sources) {
+        pimpl->dirty.insert(path);
+    }
+    if (binding.sources != sources) {
+        removeBindingSources(path);
+        for (auto prop : sources) {
+            auto& source = pimpl->sourceMap[prop];
+            if (source.paths.empty()) {
+                source.doc = getBindingSourceDocument(prop);
+                registerBindingSource(source.doc, prop);
+            }
+            source.paths.push_back(path);
+        }
+        binding.sources = std::move(sources);
+    }
+    binding.expression = expression.get();
+    binding.resolved = resolved;
+}
+
+void PropertyExpressionEngine::removeBindingSources(const ObjectIdentifier& path)
+{
+    auto it = pimpl->bindings.find(path);
+    if (it == pimpl->bindings.end()) {
+        return;
+    }
+    for (auto prop : it->second.sources) {
+        auto itSource = pimpl->sourceMap.find(prop);
+        if (itSource == pimpl->sourceMap.end()) {
+            continue;
+        }
+        auto& paths = itSource->second.paths;
+        paths.erase(std::remove(paths.begin(), paths.end(), path), paths.end());
+        if (!paths.empty()) {
+            continue;
+        }
+        unregisterBindingSource(itSource->second.doc, prop, this);
+        pimpl->sourceMap.erase(itSource);
+    }
+    it->second.sources.clear();
+}
+
+/**
+ * @brief Register a property used by the bindings in the index of its document.
+ *
+ * The first registration in a document connects the index to the signals
+ * of that document.
+ */
+
+void PropertyExpressionEngine::registerBindingSource(Document* doc, const Property* prop)
+{
+    auto res = _BindingSources.try_emplace(doc);
+    auto& index = res.first->second;
+    if (res.second) {
+        auto& app = GetApplication();
+        // Names used by the bindings may resolve to other objects or properties
+        // after a property is removed or any document is relabeled
+        index.conns.emplace_back(app.signalRemoveDynamicProperty.connect([doc](const Property& p) {
+            if (getBindingSourceDocument(&p) == doc) {
+                slotBindingSourceRemoved(p);
+            }
+        }));
+        index.conns.emplace_back(app.signalRelabelDocument.connect([doc](const Document&) {
+            auto it = _BindingSources.find(doc);
+            if (it != _BindingSources.end()) {
+                invalidateBindingSources(it->second.sources);
+            }
+        }));
+        if (doc) {
+            index.conns.emplace_back(doc->signalChangedObject.connect(
+                &PropertyExpressionEngine::slotBindingSourceChanged));
+            index.conns.emplace_back(doc->signalDeletedObject.connect(
+                &PropertyExpressionEngine::slotBindingObjectDeleted));
+            index.conns.emplace_back(app.signalDeleteDocument.connect([doc](const Document& d) {
+                if (&d == doc) {
+                    slotBindingDocumentDeleted(d);
+                }
+            }));
+        }
+    }
+    index.sources[prop].insert(this);
+}
+
+void PropertyExpressionEngine::onBindingSourceChanged(const Property& prop, bool removed)
+{
+    auto it = pimpl->sourceMap.find(&prop);
+    if (it == pimpl->sourceMap.end()) {
+        return;
+    }
+    for (auto& path : it->second.paths) {
+        pimpl->dirty.insert(path);
+        if (removed) {
+            // Force collecting again, the property may be restored by undo
+            auto itBinding = pimpl->bindings.find(path);
+            if (itBinding != pimpl->bindings.end()) {
+                auto& sources = itBinding->second.sources;
+                sources.erase(std::remove(sources.begin(), sources.end(), &prop), sources.end());
+                itBinding->second.resolved = false;
+            }
+        }
+    }
+    if (removed) {
+        pimpl->sourceMap.erase(it);
+    }
+}
+
+/**
+ * @brief Force collecting the sources again for all engines using the given index.
+ *
+ * Used when a change may redirect the references of a binding to other
+ * properties, e.g. a relabel or a link change, without touching the ones used.
+ */
+
+void PropertyExpressionEngine::invalidateBindingSources(const BindingSourceMap& sources)
+{
+    for (auto& v : sources) {
+        for (auto engine : v.second) {
+            engine->pimpl->synced = false;
+        }
+    }
+}
+
+void PropertyExpressionEngine::slotBindingSourceChanged(const App::DocumentObject& obj,
+                                                        const App::Property& prop)
+{
+    auto itDoc = _BindingSources.find(obj.getDocument());
+    if (itDoc == _BindingSources.end()) {
+        return;
+    }
+    auto& sources = itDoc->second.sources;
+    if (&prop == &obj.Label
+        || (prop.isDerivedFrom<PropertyLinkBase>()
+            && !prop.isDerivedFrom<PropertyExpressionEngine>())) {
+        invalidateBindingSources(sources);
+    }
+    auto it = sources.find(&prop);
+    if (it == sources.end()) {
+        return;
+    }
+    for (auto engine : it->second) {
+        engine->onBindingSourceChanged(prop, false);
+    }
+}
+
+void PropertyExpressionEngine::slotBindingSourceRemoved(const App::Property& prop)
+{
+    auto itDoc = _BindingSources.find(getBindingSourceDocument(&prop));
+    if (itDoc == _BindingSources.end()) {
+        return;
+    }
+    auto& sources = itDoc->second.sources;
+    // Names used by the bindings may now resolve to other objects or properties
+    invalidateBindingSources(sources);
+    auto it = sources.find(&prop);
+    if (it == sources.end()) {
+        return;
+    }
+    auto engines = std::move(it->second);
+    sources.erase(it);
+    for (auto engine : engines) {
+        engine->onBindingSourceChanged(prop, true);
+    }
+}
+
+void PropertyExpressionEngine::slotBindingObjectDeleted(const App::DocumentObject& obj)
+{
+    std::vector<Property*> props;
+    obj.getPropertyList(props);
+    for (auto prop : props) {
+        slotBindingSourceRemoved(*prop);
+    }
+}
+
+void PropertyExpressionEngine::slotBindingDocumentDeleted(const App::Document& doc)
+{
+    auto itDoc = _BindingSources.find(&doc);
+    if (itDoc == _BindingSources.end()) {
+        return;
+    }
+    // Also disconnects the index from the signals of the document
+    auto index = std::move(itDoc->second);
+    _BindingSources.erase(itDoc);
+    for (auto& v : index.sources) {
+        for (auto engine : v.second) {
+            engine->onBindingSourceChanged(*v.first, true);
+        }
+    }
+}
+
 void PropertyExpressionEngine::Paste(const Property& from)
 {
     const PropertyExpressionEngine& fromee = dynamic_cast<const PropertyExpressionEngine&>(from);
@@ -719,6 +1064,12 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
         bool& _b;
     };
 
+    // Only evaluate the bindings whose inputs changed since last time
+    updateBindingSources(pimpl->synced);
+    if (pimpl->dirty.empty()) {
+        return DocumentObject::StdReturn;
+    }
+
     resetter r(running);
 
     // Compute evaluation order
@@ -746,12 +1097,19 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
             throw Base::RuntimeError("Invalid property owner.");
         }
 
+        if (!pimpl->dirty.count(*it)) {
+            continue;
+        }
+
         /* Set value of property */
         App::any value;
         try {
             // Evaluate expression
             std::shared_ptr<App::Expression> expression = expressions[*it].expression;
-            if (expression) {
+            if (!expression) {
+                pimpl->dirty.erase(*it);
+            }
+            else {
                 value = expression->getValueAsAny();
 
                 // Enable value comparison for all expression bindings to reduce
@@ -768,6 +1126,7 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                 // if (option == ExecuteOnRestore && prop->testStatus(Property::EvalOnRestore))
                 {
                     if (isAnyEqual(value, prop->getPathValue(*it))) {
+                        pimpl->dirty.erase(*it);
                         continue;
                     }
                     if (touched) {
@@ -775,6 +1134,8 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                     }
                 }
                 prop->setPathValue(*it, value);
+                // Erase after setting, which marks the binding through its target
+                pimpl->dirty.erase(*it);
             }
         }
         catch (Base::Exception& e) {
@@ -845,6 +1206,20 @@ bool PropertyExpressionEngine::depsAreTouched() const
     return false;
 }
 
+bool PropertyExpressionEngine::hasPendingBindings() const
+{
+    if (expressions.empty()) {
+        return false;
+    }
+    if (!pimpl->synced || !pimpl->dirty.empty()) {
+        return true;
+    }
+    // Unresolved bindings are evaluated on every execute()
+    return std::any_of(pimpl->bindings.begin(), pimpl->bindings.end(), [](const auto& v) {
+        return !v.second.resolved;
+    });
+}
+
 /**
  * @brief Validate the given path and expression.
  * @param path Object Identifier for expression.
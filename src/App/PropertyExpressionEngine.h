@@ -155,6 +155,14 @@ public:
 
     bool depsAreTouched() const;
 
+    /** Check whether any binding has to be evaluated on the next execute()
+     *
+     * A binding is pending if it is new or modified, if any property it reads
+     * or writes has changed since its last evaluation, or if some of its
+     * inputs can not be resolved to a property.
+     */
+    bool hasPendingBindings() const;
+
     /* Expression validator */
     void setValidator(ValidatorFunc f)
     {
@@ -218,6 +226,22 @@ private:
     void slotChangedProperty(const App::DocumentObject& obj, const App::Property& prop);
     void updateHiddenReference(const std::string& key);
 
+    void updateBindingSources(bool unresolvedOnly = false);
+    void collectBindingSources(const App::ObjectIdentifier& path,
+                               const std::shared_ptr<Expression>& expression,
+                               bool force);
+    void removeBindingSources(const App::ObjectIdentifier& path);
+    void registerBindingSource(App::Document* doc, const App::Property* prop);
+    void onBindingSourceChanged(const App::Property& prop, bool removed);
+    static void slotBindingSourceChanged(const App::DocumentObject& obj,
+                                         const App::Property& prop);
+    static void slotBindingSourceRemoved(const App::Property& prop);
+    static void slotBindingObjectDeleted(const App::DocumentObject& obj);
+    static void slotBindingDocumentDeleted(const App::Document& doc);
+    static void invalidateBindingSources(
+        const std::unordered_map<const App::Property*, std::set<PropertyExpressionEngine*>>&
+            sources);
+
     bool running = false; /**< Boolean used to avoid loops */
     bool restoring = false;
 
@@ -25,6 +25,9 @@
 #include <QCryptographicHash>
 #include <QHash>
 #include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -83,8 +86,36 @@ class StringHasher::HashMap: public HashMapBase
 public:
     bool SaveAll = false;
     int Threshold = 0;
+    /// Lookups share the lock, so that several threads can map names
+    /// concurrently. Only adding or removing entries is exclusive.
+    mutable std::shared_mutex Mutex;
 };
 
+namespace
+{
+void writeBytes(Base::OutputStream& out, const QByteArray& bytes)
+{
+    out << static_cast<uint32_t>(bytes.size());
+    out.write(bytes.constData(), static_cast<int>(bytes.size()));
+}
+
+QByteArray readBytes(Base::InputStream& in, std::istream& stream)
+{
+    constexpr uint32_t maxSize {1 << 30};
+    uint32_t size = 0;
+    in >> size;
+    if (!stream || size > maxSize) {
+        FC_THROWM(Base::RuntimeError, "Invalid string table");
+    }
+    QByteArray bytes(static_cast<int>(size), Qt::Uninitialized);
+    in.read(bytes.data(), static_cast<int>(size));
+    if (!stream) {
+        FC_THROWM(Base::RuntimeError, "Invalid string table");
+    }
+    return bytes;
+}
+}  // namespace
+
 ///////////////////////////////////////////////////////////
 
 TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
@@ -196,6 +227,8 @@ void StringHasher::compact()
         return;
     }
 
+    std::unique_lock lock(_hashes->Mutex);
+
     // Make a list of all the table entries that have only a single reference and are not marked
     // "persistent"
     std::deque<StringIDRef> pendings;
@@ -244,6 +277,7 @@ int StringHasher::getThreshold() const
 
 long StringHasher::lastID() const
 {
+    // Note: the caller must hold the lock
     if (_hashes->right.empty()) {
         return 0;
     }
@@ -278,9 +312,12 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    {
+        std::shared_lock lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&dataID);
+        if (it != _hashes->left.end()) {
+            return {it->first};
+        }
     }
 
     if (!hashed && !nocopy) {
@@ -295,8 +332,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
-    return {insert(sid)};
+    StringIDRef sid(new StringID(0, dataID._data, flags));
+    return insertNew(sid);
 }
 
 StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<StringIDRef>& sids)
@@ -322,13 +359,16 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
-        if (indexed) {
-            res._index = indexed.getIndex();
+    {
+        std::shared_lock lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&tempID);
+        if (it != _hashes->left.end()) {
+            auto res = StringIDRef(it->first);
+            if (indexed) {
+                res._index = indexed.getIndex();
+            }
+            return res;
         }
-        return res;
     }
 
     if (!indexed && name.isRaw()) {
@@ -350,7 +390,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -430,7 +470,9 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         }
     }
 
-    return {insert(newStringIDRef), indexed.getIndex()};
+    auto res = insertNew(newStringIDRef);
+    res._index = indexed.getIndex();
+    return res;
 }
 
 StringIDRef StringHasher::getID(long id, int index) const
@@ -438,6 +480,7 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
+    std::shared_lock lock(_hashes->Mutex);
     auto it = _hashes->right.find(id);
     if (it == _hashes->right.end()) {
         return {};
@@ -491,6 +534,11 @@ void StringHasher::Save(Base::Writer& writer) const
 void StringHasher::SaveDocFile(Base::Writer& writer) const
 {
     std::size_t count = _hashes->SaveAll ? this->size() : this->count();
+    if (writer.getMode("BinaryElementMap")) {
+        writer.Stream() << "StringTableStart v2 " << count << '\n';
+        saveStreamBinary(writer.Stream());
+        return;
+    }
     writer.Stream() << "StringTableStart v1 " << count << '\n';
     saveStream(writer.Stream());
 }
@@ -506,6 +554,8 @@ void StringHasher::saveStream(std::ostream& stream) const
     long lastID = 0;
     bool relative = false;
 
+    std::shared_lock lock(_hashes->Mutex);
+
     for (auto& hasher : _hashes->right) {
         auto& d = *hasher.second;
         long id = d._id;
@@ -601,6 +651,12 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
     _hashes->clear();
     if (marker == "StringTableStart") {
         reader >> ver >> count;
+        if (ver == "v2") {
+            // skip the line end in front of the binary data
+            reader.get();
+            restoreStreamBinary(reader, count);
+            return;
+        }
         if (ver != "v1") {
             FC_WARN("Unknown string table format");
         }
@@ -680,54 +736,149 @@ void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
             d._sids.push_back(sid);
         }
 
-        if (!d.isPostfixed()) {
+        restoreData(d, [&](bool text) -> QByteArray {
+            if (!text) {
+                stream >> content;
+                return content.c_str();
+            }
             asciiStream >> content;
             if (d.isHashed() || d.isBinary()) {
-                d._data = QByteArray::fromBase64(content.c_str());
-            }
-            else {
-                d._data = content.c_str();
+                return QByteArray::fromBase64(content.c_str());
             }
+            return content.c_str();
+        });
+
+        last = insert(sid);
+    }
+}
+
+void StringHasher::restoreData(StringID& d, const std::function<QByteArray(bool)>& read) const
+{
+    if (!d.isPostfixed()) {
+        d._data = read(true);
+        return;
+    }
+    int offset = 0;
+    if (d.isPostfixEncoded()) {
+        offset = 1;
+        if (d._sids.empty()) {
+            FC_THROWM(Base::RuntimeError, "Missing string postfix");
         }
-        else {
-            int offset = 0;
-            if (d.isPostfixEncoded()) {
-                offset = 1;
-                if (d._sids.empty()) {
-                    FC_THROWM(Base::RuntimeError, "Missing string postfix");
-                }
-                d._postfix = d._sids[0]._sid->_data;
-            }
-            if (d.isIndexed()) {
-                if (d._sids.size() <= offset) {
-                    FC_THROWM(Base::RuntimeError, "Missing string prefix");
-                }
-                d._data = d._sids[offset]._sid->_data;
-            }
-            else if (d.isPrefixID() || d.isPrefixIDIndex()) {
-                if (d._sids.size() <= offset) {
-                    FC_THROWM(Base::RuntimeError, "Missing string prefix id");
-                }
-                d._data = d._sids[offset]._sid->toString(0).c_str();
-                if (d.isPrefixIDIndex()) {
-                    d._data += ":";
-                }
-            }
-            else {
-                stream >> content;
-                d._data = content.c_str();
-            }
-            if (!d.isPostfixEncoded()) {
-                stream >> content;
-                d._postfix = content.c_str();
+        d._postfix = d._sids[0]._sid->_data;
+    }
+    if (d.isIndexed()) {
+        if (d._sids.size() <= offset) {
+            FC_THROWM(Base::RuntimeError, "Missing string prefix");
+        }
+        d._data = d._sids[offset]._sid->_data;
+    }
+    else if (d.isPrefixID() || d.isPrefixIDIndex()) {
+        if (d._sids.size() <= offset) {
+            FC_THROWM(Base::RuntimeError, "Missing string prefix id");
+        }
+        d._data = d._sids[offset]._sid->toString(0).c_str();
+        if (d.isPrefixIDIndex()) {
+            d._data += ":";
+        }
+    }
+    else {
+        d._data = read(false);
+    }
+    if (!d.isPostfixEncoded()) {
+        d._postfix = read(false);
+    }
+}
+
+void StringHasher::saveStreamBinary(std::ostream& stream) const
+{
+    Base::OutputStream out(stream);
+    long lastID = 0;
+
+    std::shared_lock lock(_hashes->Mutex);
+
+    for (auto& hasher : _hashes->right) {
+        auto& d = *hasher.second;
+        if (!_hashes->SaveAll && !d.isMarked() && !d.isPersistent()) {
+            continue;
+        }
+
+        // The ids are ascending, and the related ids are always older ones.
+        // So both are stored relative to the current id.
+        auto flags = d._flags;
+        flags.setFlag(StringID::Flag::Marked, false);
+        out << static_cast<uint32_t>(d._id - lastID)
+            << static_cast<uint32_t>(flags.toUnderlyingType())
+            << static_cast<uint32_t>(d._sids.size());
+        for (const auto& sid : d._sids) {
+            out << static_cast<int32_t>(d._id - sid.value());
+        }
+        lastID = d._id;
+
+        if (!d.isPostfixed() || (!d.isPrefixIDIndex() && !d.isIndexed() && !d.isPrefixID())) {
+            writeBytes(out, d._data);
+        }
+        if (d.isPostfixed() && !d.isPostfixEncoded()) {
+            writeBytes(out, d._postfix);
+        }
+    }
+}
+
+void StringHasher::restoreStreamBinary(std::istream& stream, std::size_t count)
+{
+    Base::InputStream in(stream);
+    _hashes->clear();
+    long id = 0;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        uint32_t delta = 0;
+        uint32_t flags = 0;
+        uint32_t sidCount = 0;
+        in >> delta >> flags >> sidCount;
+        if (!stream || sidCount > count) {
+            FC_THROWM(Base::RuntimeError, "Invalid string table");
+        }
+        id += delta;
+
+        StringIDRef sid(new StringID(id, QByteArray(), static_cast<StringID::Flag>(flags)));
+        StringID& d = *sid._sid;
+        d._sids.reserve(static_cast<int>(sidCount));
+        for (uint32_t j = 0; j < sidCount; ++j) {
+            int32_t offset = 0;
+            in >> offset;
+            StringIDRef related = getID(id - offset);
+            if (!related) {
+                FC_THROWM(Base::RuntimeError, "Invalid string id reference");
             }
+            d._sids.push_back(related);
         }
 
-        last = insert(sid);
+        restoreData(d, [&](bool) {
+            return readBytes(in, stream);
+        });
+
+        insert(sid);
     }
 }
 
 StringID* StringHasher::insert(const StringIDRef& sid)
+{
+    std::unique_lock lock(_hashes->Mutex);
+    return insertNoLock(sid);
+}
+
+StringIDRef StringHasher::insertNew(const StringIDRef& sid)
+{
+    std::unique_lock lock(_hashes->Mutex);
+    // Another thread may have added the same string after our lookup
+    auto it = _hashes->left.find(sid._sid);
+    if (it != _hashes->left.end()) {
+        return {it->first};
+    }
+    sid._sid->_id = lastID() + 1;
+    return {insertNoLock(sid)};
+}
+
+StringID* StringHasher::insertNoLock(const StringIDRef& sid)
 {
     assert(sid && sid._sid->_hasher == nullptr);
     auto& hasher = *sid._sid;
@@ -763,6 +914,7 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 
 void StringHasher::clear()
 {
+    std::unique_lock lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_hasher = nullptr;
         hasher.second->unref();
@@ -772,12 +924,14 @@ void StringHasher::clear()
 
 size_t StringHasher::size() const
 {
+    std::shared_lock lock(_hashes->Mutex);
     return _hashes->size();
 }
 
 size_t StringHasher::count() const
 {
     size_t count = 0;
+    std::shared_lock lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         if (hasher.second->isMarked() || hasher.second->isPersistent()) {
             ++count;
@@ -855,6 +1009,7 @@ PyObject* StringHasher::getPyObject()
 std::map<long, StringIDRef> StringHasher::getIDMap() const
 {
     std::map<long, StringIDRef> ret;
+    std::shared_lock lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         ret.emplace_hint(ret.end(), hasher.first, StringIDRef(hasher.second));
     }
@@ -863,6 +1018,7 @@ std::map<long, StringIDRef> StringHasher::getIDMap() const
 
 void StringHasher::clearMarks() const
 {
+    std::unique_lock lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_flags.setFlag(StringID::Flag::Marked, false);
     }
@@ -26,6 +26,7 @@
 #include <FCConfig.h>
 
 #include <bitset>
+#include <functional>
 #include <memory>
 
 #include <QByteArray>
@@ -772,10 +773,25 @@ public:
 
 protected:
     StringID* insert(const StringIDRef& sid);
+    /// Assign the next free id to \a sid and insert it, unless an equal string exists already
+    StringIDRef insertNew(const StringIDRef& sid);
     long lastID() const;
     void saveStream(std::ostream& stream) const;
     void restoreStream(std::istream& stream, std::size_t count);
     void restoreStreamNew(std::istream& stream, std::size_t count);
+    /// Binary variant of saveStream(), selected by the "BinaryElementMap" writer mode
+    void saveStreamBinary(std::ostream& stream) const;
+    void restoreStreamBinary(std::istream& stream, std::size_t count);
+
+private:
+    StringID* insertNoLock(const StringIDRef& sid);
+    /** Restore the data and postfix of a StringID read back from a string table
+     *
+     * Whatever can be derived from the related string IDs is taken from there,
+     * the rest is obtained by calling \a read. Its argument tells whether the
+     * string is an arbitrary text, or a single word element name.
+     */
+    void restoreData(StringID& sid, const std::function<QByteArray(bool)>& read) const;
 
 private:
     std::unique_ptr<HashMap>
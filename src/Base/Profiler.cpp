@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2025 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <new>
+#include <ostream>
+#endif
+
+#include "Profiler.h"
+
+
+using namespace Base;
+
+namespace
+{
+
+// Upper bound of the recorded events, about 64 MB, so that a forgotten
+// profiling session cannot exhaust the memory
+constexpr std::size_t maxEvents {1 << 20};
+
+struct EventBuffer
+{
+    std::mutex mutex;
+    std::vector<Profiler::Event> events;
+    std::size_t dropped {};
+};
+
+EventBuffer& buffer()
+{
+    static EventBuffer instance;
+    return instance;
+}
+
+const std::chrono::steady_clock::time_point& startTime()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return start;
+}
+
+int currentThread()
+{
+    static std::atomic<int> counter;
+    thread_local const int thread = ++counter;
+    return thread;
+}
+
+thread_local int zoneDepth = 0;
+
+void writeJsonString(std::ostream& out, const char* str)
+{
+    out << '"';
+    for (; *str; ++str) {
+        auto ch = static_cast<unsigned char>(*str);
+        switch (ch) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (ch < 0x20) {  // NOLINT
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", ch);
+                    out << code;
+                }
+                else {
+                    out << *str;
+                }
+        }
+    }
+    out << '"';
+}
+
+}  // namespace
+
+std::atomic<bool> Profiler::enabled {false};
+
+void Profiler::setEnabled(bool enable)
+{
+    // make sure the time origin is set before any zone uses it
+    startTime();
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+void Profiler::clear()
+{
+    auto& buf = buffer();
+    std::lock_guard<std::mutex> lock(buf.mutex);
+    buf.events.clear();
+    buf.events.shrink_to_fit();
+    buf.dropped = 0;
+}
+
+std::vector<Profiler::Event> Profiler::getEvents()
+{
+    auto& buf = buffer();
+    std::lock_guard<std::mutex> lock(buf.mutex);
+    return buf.events;
+}
+
+std::size_t Profiler::droppedEvents()
+{
+    auto& buf = buffer();
+    std::lock_guard<std::mutex> lock(buf.mutex);
+    return buf.dropped;
+}
+
+std::int64_t Profiler::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                                                                - startTime())
+        .count();
+}
+
+void Profiler::record(Event&& event) noexcept
+{
+    // Called from the destructor of ProfileZone, so it must not throw
+    auto& buf = buffer();
+    try {
+        std::lock_guard<std::mutex> lock(buf.mutex);
+        if (buf.events.size() >= maxEvents) {
+            ++buf.dropped;
+            return;
+        }
+        try {
+            buf.events.push_back(std::move(event));
+        }
+        catch (const std::bad_alloc&) {
+            ++buf.dropped;
+        }
+    }
+    catch (...) {
+        // the mutex could not be locked, the event is lost
+    }
+}
+
+void Profiler::writeChromeTrace(std::ostream& out)
+{
+    auto events = getEvents();
+    constexpr double nsPerUs {1000.0};
+    char times[64];
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (auto& event : events) {
+        if (!first) {
+            out << ",\n";
+        }
+        first = false;
+        out << "{\"name\":";
+        writeJsonString(out, event.name);
+        // microseconds with a fixed precision, stream defaults would round large time stamps
+        std::snprintf(times,
+                      sizeof(times),
+                      ",\"ts\":%.3f,\"dur\":%.3f",
+                      static_cast<double>(event.start) / nsPerUs,
+                      static_cast<double>(event.duration) / nsPerUs);
+        out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread << times;
+        if (!event.detail.empty()) {
+            out << ",\"args\":{\"detail\":";
+            writeJsonString(out, event.detail.c_str());
+            out << '}';
+        }
+        out << '}';
+    }
+    out << "]}\n";
+}
+
+void ProfileZone::begin() noexcept
+{
+    _depth = zoneDepth++;
+    _start = Profiler::now();
+}
+
+void ProfileZone::end() noexcept
+{
+    std::int64_t stop = Profiler::now();
+    --zoneDepth;
+    Profiler::record(
+        {_name, std::move(_detail), _start, stop - _start, currentThread(), _depth});
+}
@@ -21,6 +21,18 @@
  *                                                                          *
  ***************************************************************************/
 
+#ifndef BASE_PROFILER_H
+#define BASE_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <FCGlobal.h>
+
 #ifdef TRACY_ENABLE
 #include <tracy/Tracy.hpp>
 #else
@@ -132,3 +144,124 @@
 #define TracyFiberEnterHint(x, y)
 #define TracyFiberLeave
 #endif
+
+namespace Base
+{
+
+/** Built-in hierarchical profiler
+ *
+ * Unlike the Tracy zones above, this one is always compiled in, so that
+ * profiles can be collected from regular builds. When disabled, a zone costs a
+ * single relaxed atomic load. When enabled, every finished zone is recorded
+ * with its start time, duration, thread and nesting depth, and the result can
+ * be written in the Chrome trace event format (chrome://tracing, Perfetto).
+ *
+ * Use FC_PROFILE_ZONE() to instrument a scope, which also opens a Tracy zone
+ * of the same name in Tracy enabled builds.
+ */
+class BaseExport Profiler
+{
+public:
+    struct Event
+    {
+        /// zone name, must be a string literal
+        const char* name;
+        /// optional runtime detail, e.g. the object being recomputed
+        std::string detail;
+        /// start time in nanoseconds since the process started
+        std::int64_t start;
+        /// duration in nanoseconds
+        std::int64_t duration;
+        int thread;
+        int depth;
+    };
+
+    static bool isEnabled() noexcept
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(bool enable);
+
+    /// Discard all recorded events
+    static void clear();
+    /// Return a copy of the recorded events, ordered by their end time
+    static std::vector<Event> getEvents();
+    /// Number of events dropped because the buffer limit was reached
+    static std::size_t droppedEvents();
+    /// Write the recorded events as Chrome trace event JSON
+    static void writeChromeTrace(std::ostream& out);
+
+    /// Return the current time in nanoseconds since the process started
+    static std::int64_t now() noexcept;
+    /// Store a finished event, it is counted as dropped if it cannot be stored
+    static void record(Event&& event) noexcept;
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+/// Scoped timer recording a Profiler event, use FC_PROFILE_ZONE() instead of this
+class BaseExport ProfileZone
+{
+public:
+    explicit ProfileZone(const char* name) noexcept
+        : _name(Profiler::isEnabled() ? name : nullptr)
+    {
+        if (_name) {
+            begin();
+        }
+    }
+    ~ProfileZone()
+    {
+        if (_name) {
+            end();
+        }
+    }
+
+    bool isActive() const noexcept
+    {
+        return _name != nullptr;
+    }
+    void setDetail(std::string detail)
+    {
+        _detail = std::move(detail);
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone(ProfileZone&&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+    ProfileZone& operator=(ProfileZone&&) = delete;
+
+private:
+    void begin() noexcept;
+    void end() noexcept;
+
+private:
+    const char* _name;
+    std::string _detail;
+    std::int64_t _start {};
+    int _depth {};
+};
+
+}  // namespace Base
+
+#define FC_PROFILE_CONCAT_(_a, _b) _a##_b
+#define FC_PROFILE_CONCAT(_a, _b) FC_PROFILE_CONCAT_(_a, _b)
+
+/** Profile the enclosing scope under the literal name \a _name */
+#define FC_PROFILE_ZONE(_name)                                                                     \
+    ZoneScopedN(_name);                                                                            \
+    ::Base::ProfileZone FC_PROFILE_CONCAT(_fcProfileZone, __LINE__)(_name)
+
+/** Profile the enclosing scope and attach a detail string to it
+ *
+ * \a _detail is only evaluated while the profiler is enabled.
+ */
+#define FC_PROFILE_ZONE_DETAIL(_name, _detail)                                                     \
+    FC_PROFILE_ZONE(_name);                                                                        \
+    if (FC_PROFILE_CONCAT(_fcProfileZone, __LINE__).isActive()) {                                  \
+        FC_PROFILE_CONCAT(_fcProfileZone, __LINE__).setDetail(_detail);                            \
+    }                                                                                              \
+    static_cast<void>(0)
+
+#endif  // BASE_PROFILER_H
@@ -136,6 +136,8 @@ def InitApplications():
     # Searching modules dirs +++++++++++++++++++++++++++++++++++++++++++++++++++
     # (additional module paths are already cached)
     ModDirs = FreeCAD.__ModDirs__
+    MetadataCache = FreeCAD.__ModuleMetadataCache__
+    Timer = FreeCAD.__StartupTimer__
     #print ModDirs
     Log('Init:   Searching modules...\n')
 
@@ -161,7 +163,7 @@ def InitApplications():
         return False
 
     def processMetadataFile(Dir, MetadataFile):
-        meta = FreeCAD.Metadata(MetadataFile)
+        meta = MetadataCache.get(MetadataFile)
         if not meta.supportsCurrentFreeCAD():
             return None
         content = meta.Content
@@ -224,12 +226,14 @@ def InitApplications():
             if checkIfAddonIsDisabled(Dir):
                 continue
             MetadataFile = os.path.join(Dir, "package.xml")
-            if os.path.exists(MetadataFile):
-                tryProcessMetadataFile(Dir, MetadataFile)
-            else:
-                RunInitGuiPy(Dir)
+            with Timer.phase('InitGui ' + Dir):
+                if os.path.exists(MetadataFile):
+                    tryProcessMetadataFile(Dir, MetadataFile)
+                else:
+                    RunInitGuiPy(Dir)
     Log("All modules with GUIs using InitGui.py are now initialized\n")
 
+    Timer.begin('InitGui freecad.* extension modules')
     try:
         import pkgutil
         import importlib
@@ -247,7 +251,7 @@ def InitApplications():
             MetadataFile = os.path.join(FreeCAD.getUserAppDataDir(), "Mod",
                                         freecad_module_name[8:], "package.xml")
             if os.path.exists(MetadataFile):
-                meta = FreeCAD.Metadata(MetadataFile)
+                meta = MetadataCache.get(MetadataFile)
                 if not meta.supportsCurrentFreeCAD():
                     continue
 
@@ -274,10 +278,13 @@ def InitApplications():
                     Log('-'*80+'\n')
     except ImportError as inst:
         Err('During initialization the error "' + str(inst) + '" occurred\n')
+    Timer.end()
 
     Log("All modules with GUIs initialized using pkgutil are now initialized\n")
+    MetadataCache.save()
+    Timer.report('GUI module initialization')
 
-def GeneratePackageIcon(dir:str, subdirectory:str, workbench_metadata:FreeCAD.Metadata,
+def GeneratePackageIcon(dir:str, subdirectory:str, workbench_metadata,
                         wb_handle:Workbench) -> None:
     relative_filename = workbench_metadata.Icon
     if not relative_filename:
@@ -364,7 +364,7 @@ private:
         PyObject* pShapes = nullptr;
         PyObject* start = nullptr;
         PyObject* return_end = Py_False;
-        static const std::array<const char*, 22> kwd_list {
+        static const std::array<const char*, 23> kwd_list {
             "shapes",
             "start",
             "return_end",
@@ -435,7 +435,7 @@ private:
         PARAM_PY_DECLARE_INIT(PARAM_FARG, AREA_PARAMS_SORT)
         PyObject* pShapes = nullptr;
         PyObject* start = nullptr;
-        static const std::array<const char*, 12> kwd_list {
+        static const std::array<const char*, 13> kwd_list {
             "shapes",
             "start",
             PARAM_FIELD_STRINGS(ARG, AREA_PARAMS_ARC_PLANE),
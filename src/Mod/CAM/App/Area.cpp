@@ -2862,6 +2862,7 @@ struct RGetter
     }
 };
 using RTree = bgi::rtree<RValue, RParameters, RGetter>;
+using ShapeBox = bg::model::box<gp_Pnt>;
 
 struct ShapeParams
 {
@@ -2894,11 +2895,11 @@ using RResults = std::map<Wires::iterator, size_t>;
 struct GetWires
 {
     Wires& wires;
-    RTree& rtree;
+    std::vector<RValue>& values;
     ShapeParams& params;
-    GetWires(std::list<WireInfo>& ws, RTree& rt, ShapeParams& rp)
+    GetWires(std::list<WireInfo>& ws, std::vector<RValue>& vs, ShapeParams& rp)
         : wires(ws)
-        , rtree(rt)
+        , values(vs)
         , params(rp)
     {}
     void operator()(const TopoDS_Shape& shape, int type)
@@ -2992,7 +2993,7 @@ struct GetWires
         auto it = wires.end();
         --it;
         for (size_t i = 0, count = it->points.size(); i < count; ++i) {
-            rtree.insert(RValue(it, i));
+            values.emplace_back(it, i);
         }
         FC_DURATION_PLUS(params.bd, t);
     }
@@ -3003,6 +3004,7 @@ struct ShapeInfo
     gp_Pln myPln;
     Wires myWires;
     RTree myRTree;
+    ShapeBox myBox;
     TopoDS_Shape myShape;
     gp_Pnt myBestPt;
     gp_Pnt myStartPt;
@@ -3042,7 +3044,13 @@ struct ShapeInfo
         myStartPt = pt;
 
         if (myWires.empty()) {
-            foreachSubshape(myShape, GetWires(myWires, myRTree, myParams), TopAbs_WIRE);
+            std::vector<RValue> values;
+            foreachSubshape(myShape, GetWires(myWires, values, myParams), TopAbs_WIRE);
+            // Bulk loading (packing) is much faster than inserting the sampled
+            // points one by one, and gives a better balanced tree for queries.
+            FC_TIME_INIT(t);
+            myRTree = RTree(values.begin(), values.end());
+            FC_DURATION_PLUS(myParams.bd, t);
         }
 
         // Now find the true nearest point among the wires returned. Currently
@@ -3497,6 +3505,210 @@ struct WireOrienter
     }
 };
 
+struct ShapeBoxGetter
+{
+    using result_type = const ShapeBox&;
+    result_type operator()(std::list<ShapeInfo>::iterator it) const
+    {
+        return it->myBox;
+    }
+};
+using ShapeRTree = bgi::rtree<std::list<ShapeInfo>::iterator, RParameters, ShapeBoxGetter>;
+
+// Improves the visiting order of wires already sorted by nearest neighbour
+// using 2-opt moves, i.e. reversing the order of a run of wires whenever that
+// shortens the total travel distance starting from pstart. Closed wires start
+// and end at the same point, so they can be freely reordered. Open wires must
+// be reversed along with the run, which is only allowed if no path direction
+// is enforced. Candidate moves are limited to the nearest wire ends found
+// through an rtree, so that each pass stays O(n log n) instead of O(n^2).
+class WireTwoOpt
+{
+public:
+    WireTwoOpt(std::list<TopoDS_Shape>& wires, short direction, double max_dist)
+        : myWires(wires)
+        , myMaxDist(max_dist)
+    {
+        myNodes.reserve(wires.size());
+        for (auto& wire : wires) {
+            myNodes.emplace_back();
+            Node& node = myNodes.back();
+            node.wire = wire;
+            node.closed = BRep_Tool::IsClosed(wire);
+            node.locked = !node.closed && direction != Area::DirectionNone;
+            getEndPoints(TopoDS::Wire(wire), node.pts[0], node.pts[1]);
+        }
+        std::vector<PointValue> values;
+        values.reserve(myNodes.size() * 2);
+        myOrder.resize(myNodes.size());
+        myPos.resize(myNodes.size());
+        myLocked.resize(myNodes.size() + 1);
+        myLocked[0] = 0;
+        for (size_t i = 0; i < myNodes.size(); ++i) {
+            myOrder[i] = i;
+            myPos[i] = i;
+            myLocked[i + 1] = myLocked[i] + (myNodes[i].locked ? 1 : 0);
+            values.emplace_back(i, 0);
+            if (!myNodes[i].closed) {
+                values.emplace_back(i, 1);
+            }
+        }
+        myRTree = PointTree(values.begin(), values.end(), RParameters(), PointGetter(myNodes));
+    }
+
+    // Returns true if the wire order has been changed
+    bool perform(const gp_Pnt& pstart, int passes, gp_Pnt& pentry, gp_Pnt& pend)
+    {
+        if (myNodes.size() < 2) {
+            return false;
+        }
+        myStart = pstart;
+        bool changed = false;
+        for (int pass = 0; pass < passes; ++pass) {
+            bool improved = false;
+            for (size_t i = 0; i < myOrder.size(); ++i) {
+                // Try to bring a wire end near to the end of the previous wire
+                const gp_Pnt& pt = prevEnd(i);
+                for (auto it = myRTree.qbegin(bgi::nearest(pt, NeighbourCount));
+                     it != myRTree.qend();
+                     ++it) {
+                    size_t j = myPos[it->first];
+                    if (j >= i && tryReverse(i, j)) {
+                        improved = true;
+                        break;
+                    }
+                }
+                // Try to bring a wire start near to the start of the next wire
+                if (i + 1 < myOrder.size()) {
+                    const gp_Pnt& pt = startPoint(i + 1);
+                    for (auto it = myRTree.qbegin(bgi::nearest(pt, NeighbourCount));
+                         it != myRTree.qend();
+                         ++it) {
+                        size_t j = myPos[it->first];
+                        if (j <= i && tryReverse(j, i)) {
+                            improved = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (!improved) {
+                break;
+            }
+            changed = true;
+        }
+        if (!changed) {
+            return false;
+        }
+
+        myWires.clear();
+        for (size_t idx : myOrder) {
+            const Node& node = myNodes[idx];
+            myWires.push_back(node.reversed ? node.wire.Reversed() : node.wire);
+        }
+        pentry = startPoint(0);
+        pend = endPoint(myOrder.size() - 1);
+        return true;
+    }
+
+private:
+    static constexpr unsigned NeighbourCount = 8;
+
+    struct Node
+    {
+        TopoDS_Shape wire;
+        gp_Pnt pts[2];
+        bool closed = false;
+        bool locked = false;
+        bool reversed = false;
+    };
+
+    // rtree value of (node index, end point index)
+    using PointValue = std::pair<size_t, int>;
+    struct PointGetter
+    {
+        using result_type = const gp_Pnt&;
+        explicit PointGetter(const std::vector<Node>& nodes)
+            : nodes(&nodes)
+        {}
+        result_type operator()(const PointValue& v) const
+        {
+            return (*nodes)[v.first].pts[v.second];
+        }
+        const std::vector<Node>* nodes;
+    };
+    using PointTree = bgi::rtree<PointValue, RParameters, PointGetter>;
+
+    const gp_Pnt& startPoint(size_t pos) const
+    {
+        const Node& node = myNodes[myOrder[pos]];
+        return node.pts[node.reversed ? 1 : 0];
+    }
+
+    const gp_Pnt& endPoint(size_t pos) const
+    {
+        const Node& node = myNodes[myOrder[pos]];
+        return node.pts[node.reversed ? 0 : 1];
+    }
+
+    const gp_Pnt& prevEnd(size_t pos) const
+    {
+        return pos ? endPoint(pos - 1) : myStart;
+    }
+
+    bool acceptJump(const gp_Pnt& p1, const gp_Pnt& p2) const
+    {
+        return myMaxDist <= 0 || p1.SquareDistance(p2) <= myMaxDist;
+    }
+
+    // Reverses the wires from position i to j (inclusive) if that shortens
+    // the travel distance
+    bool tryReverse(size_t i, size_t j)
+    {
+        if (myLocked[j + 1] != myLocked[i]) {
+            return false;
+        }
+        // Do not change the layer entry in greedy mode, because the jump
+        // into the layer is not bounded by the threshold.
+        if (i == 0 && myMaxDist > 0) {
+            return false;
+        }
+        const gp_Pnt& prev = prevEnd(i);
+        double before = prev.Distance(startPoint(i));
+        double after = prev.Distance(endPoint(j));
+        bool hasNext = j + 1 < myOrder.size();
+        if (hasNext) {
+            const gp_Pnt& next = startPoint(j + 1);
+            before += endPoint(j).Distance(next);
+            after += startPoint(i).Distance(next);
+            if (!acceptJump(startPoint(i), next)) {
+                return false;
+            }
+        }
+        if (after >= before - Precision::Confusion() || !acceptJump(prev, endPoint(j))) {
+            return false;
+        }
+        std::reverse(myOrder.begin() + i, myOrder.begin() + j + 1);
+        for (size_t k = i; k <= j; ++k) {
+            Node& node = myNodes[myOrder[k]];
+            if (!node.closed) {
+                node.reversed = !node.reversed;
+            }
+            myPos[myOrder[k]] = k;
+        }
+        return true;
+    }
+
+    std::list<TopoDS_Shape>& myWires;
+    std::vector<Node> myNodes;
+    std::vector<size_t> myOrder;
+    std::vector<size_t> myPos;
+    std::vector<size_t> myLocked;
+    PointTree myRTree {RParameters(), PointGetter(myNodes)};
+    gp_Pnt myStart;
+    double myMaxDist;
+};
+
 typedef Standard_Real (gp_Pnt::*AxisGetter)() const;
 typedef void (gp_Pnt::*AxisSetter)(Standard_Real);
 
@@ -3662,6 +3874,30 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
         FC_TIME_LOG(t, "plane merging");
     }
 
+    // Index the shapes by their bounding boxes. The box distance is a lower
+    // bound of the nearest wire distance, so that the nearest shape search
+    // below can stop early instead of querying every remaining shape.
+    std::vector<std::list<ShapeInfo>::iterator> shape_its, planar_its;
+    shape_its.reserve(shape_list.size());
+    for (auto it = shape_list.begin(); it != shape_list.end(); ++it) {
+        if (it->myPlanar) {
+            planar_its.push_back(it);
+        }
+        Bnd_Box bound;
+        BRepBndLib::Add(it->myShape, bound, Standard_False);
+        if (!bound.IsVoid()) {
+            Standard_Real x0, y0, z0, x1, y1, z1;
+            bound.Get(x0, y0, z0, x1, y1, z1);
+            it->myBox = ShapeBox(gp_Pnt(x0, y0, z0), gp_Pnt(x1, y1, z1));
+        }
+        else {
+            it->myBox = ShapeBox(gp_Pnt(-1e20, -1e20, -1e20), gp_Pnt(1e20, 1e20, 1e20));
+        }
+        shape_its.push_back(it);
+    }
+    ShapeRTree shape_rtree(shape_its.begin(), shape_its.end());
+    FC_TIME_LOG(t, "shape indexing");
+
     bounds.SetGap(0.0);
     Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
     bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
@@ -3697,6 +3933,7 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
     }
 
 
+    FC_DURATION_DECL_INIT(two_opt_duration);
     gp_Pln pln;
     double hint = 0.0;
     bool hint_first = true;
@@ -3707,15 +3944,28 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
         AREA_TRACE("sorting " << shape_list.size() << ' ' << AREA_XYZ(pstart));
         double best_d = std::numeric_limits<double>::max();
         auto best_it = shape_list.begin();
-        for (auto it = best_it; it != shape_list.end(); ++it) {
-            double d;
-            gp_Pnt pt;
+        if (current_it == shape_list.end()) {
+            // Planar shapes are merged by plane above, so there are only a few
+            // of them to compare by plane distance.
+            for (auto it : planar_its) {
+                double d = it->myPln.SquareDistance(pstart);
+                if (d < best_d) {
+                    best_it = it;
+                    best_d = d;
+                }
+            }
+        }
+        for (auto vit = shape_rtree.qbegin(bgi::nearest(pstart, shape_rtree.size()));
+             vit != shape_rtree.qend();
+             ++vit) {
+            auto it = *vit;
             if (it->myPlanar && current_it == shape_list.end()) {
-                d = it->myPln.SquareDistance(pstart);
+                continue;
             }
-            else {
-                d = it->nearest(pstart);
+            if (bg::comparable_distance(pstart, it->myBox) >= best_d) {
+                break;
             }
+            double d = it->nearest(pstart);
             if (d < best_d) {
                 best_it = it;
                 best_d = d;
@@ -3739,7 +3989,13 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
             }
         }
 
-        wires.splice(wires.end(), best_it->sortWires(pstart, pend, min_dist, max_dist, &pentry));
+        auto layer = best_it->sortWires(pstart, pend, min_dist, max_dist, &pentry);
+        if (two_opt > 0 && layer.size() > 2) {
+            FC_TIME_INIT(t2);
+            WireTwoOpt(layer, direction, max_dist).perform(pstart, two_opt, pentry, pend);
+            FC_DURATION_PLUS(two_opt_duration, t2);
+        }
+        wires.splice(wires.end(), layer);
 
         if (use_bound && _pstart) {
             use_bound = false;
@@ -3780,6 +4036,10 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
             if (current_it == best_it) {
                 current_it = shape_list.end();
             }
+            shape_rtree.remove(best_it);
+            if (best_it->myPlanar) {
+                planar_its.erase(std::find(planar_its.begin(), planar_its.end(), best_it));
+            }
             shape_list.erase(best_it);
         }
     }
@@ -3793,6 +4053,7 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
     FC_DURATION_LOG(rparams.qd, "rtree query");
     FC_DURATION_LOG(rparams.rd, "rtree clean");
     FC_DURATION_LOG(rparams.xd, "BRepExtrema");
+    FC_DURATION_LOG(two_opt_duration, "2-opt");
     FC_TIME_LOG(t, "sortWires total");
     return wires;
 }
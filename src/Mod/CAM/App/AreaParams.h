@@ -396,7 +396,14 @@
              "If two wire's end points are separated within this threshold, they are consider\n"   \
              "as connected. You may want to set this to the tool diameter to keep the tool down.", \
              App::PropertyLength))(                                                                \
-            (enum, retract_axis, RetractAxis, 2, "Tool retraction axis", (X)(Y)(Z)))
+            (enum, retract_axis, RetractAxis, 2, "Tool retraction axis", (X)(Y)(Z)))(           \
+            (short,                                                                                \
+             two_opt,                                                                              \
+             SortTwoOpt,                                                                           \
+             0,                                                                                    \
+             "Maximum number of 2-opt passes used to improve the wire order within each layer.\n" \
+             "A pass reverses the visiting order of a run of wires whenever that shortens the\n"   \
+             "travel distance. Zero disables the improvement."))
 
 /** Area path generation parameters */
 #define AREA_PARAMS_PATH                                                                           \
@@ -0,0 +1,94 @@
+# -*- coding: utf-8 -*-
+# ***************************************************************************
+# *   Copyright (c) 2026 The FreeCAD Project Association                    *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import math
+import random
+
+import Part
+import Path
+import CAMTests.PathTestUtils as PathTestUtils
+
+from FreeCAD import Vector
+
+# sort_mode values of Path.sortWires
+SORT_2D5 = 1
+SORT_3D = 2
+
+
+def makeSquares(count, height):
+    """Returns count small squares at random positions, at random heights up to height."""
+    rng = random.Random(42)
+    squares = []
+    for _ in range(count):
+        x = rng.uniform(0, 100)
+        y = rng.uniform(0, 100)
+        z = rng.uniform(-height, 0)
+        corners = [(0, 0), (2, 0), (2, 2), (0, 2), (0, 0)]
+        squares.append(Part.makePolygon([Vector(x + dx, y + dy, z) for dx, dy in corners]))
+    return squares
+
+
+def wireKey(wire):
+    """Identifies a square by its center, which doesn't depend on its start point."""
+    center = wire.BoundBox.Center
+    return (round(center.x, 6), round(center.y, 6), round(center.z, 6))
+
+
+def horizontalLength(path):
+    """Returns the length of all moves of path projected onto the XY plane. The squares are cut
+    by straight moves, so for the same squares only the travel between them makes a difference."""
+    pos = Vector()
+    length = 0.0
+    for cmd in path.Commands:
+        params = cmd.Parameters
+        target = Vector(params.get("X", pos.x), params.get("Y", pos.y), params.get("Z", pos.z))
+        length += math.hypot(target.x - pos.x, target.y - pos.y)
+        pos = target
+    return length
+
+
+class TestPathSortWires(PathTestUtils.PathTestBase):
+    """Test the wire order of Path.sortWires and Path.fromShapes."""
+
+    def assertPermutation(self, wires, squares):
+        self.assertEqual(sorted(wireKey(w) for w in wires), sorted(wireKey(s) for s in squares))
+
+    def test00(self):
+        """Check that sorting returns every wire exactly once"""
+        for mode, height in ((SORT_2D5, 0), (SORT_3D, 5)):
+            squares = makeSquares(200, height)
+            for two_opt in (0, 3):
+                wires = Path.sortWires(squares, Vector(), sort_mode=mode, two_opt=two_opt)[0]
+                self.assertPermutation(wires, squares)
+
+    def test01(self):
+        """Check that the 2-opt pass doesn't increase the travel of the nearest neighbour order"""
+        for mode, height in ((SORT_2D5, 0), (SORT_3D, 5)):
+            squares = makeSquares(200, height)
+            greedy = horizontalLength(
+                Path.fromShapes(squares, start=Vector(), sort_mode=mode, two_opt=0)
+            )
+            improved = horizontalLength(
+                Path.fromShapes(squares, start=Vector(), sort_mode=mode, two_opt=3)
+            )
+            self.assertLessEqual(improved, greedy + 1e-6)
+
@@ -0,0 +1,85 @@
+# ***************************************************************************
+# *   Copyright (c) 2025 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of the FreeCAD CAx development system.              *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful,            *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with FreeCAD; if not, write to the Free Software        *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+"""Timing of the C++ DXF importer on a large generated file.
+
+This is not part of TestDraft. Run it by hand from a release build:
+
+    FreeCADCmd -t drafttests.benchmark_dxf
+"""
+
+## @package benchmark_dxf
+# \ingroup drafttests
+# \brief Timing of the C++ DXF importer on a large generated file.
+
+## \addtogroup drafttests
+# @{
+
+import os
+import tempfile
+import time
+
+import FreeCAD as App
+from drafttests import test_base
+from drafttests.test_dxf import _write_dxf
+from draftutils.messages import _msg
+
+
+class DraftDXFBenchmark(test_base.DraftTestCaseDoc):
+    """Time the import of a DXF file with 30000 entities."""
+
+    def test_read_dxf_large(self):
+        """Read a large generated DXF file with and without skipping the unused parts."""
+        import Import
+
+        count = 30000
+        in_file = os.path.join(tempfile.gettempdir(), "draft_benchmark_large.dxf")
+        _write_dxf(in_file, count)
+        _msg("  file={}".format(in_file))
+        _msg("  entities={}".format(count))
+
+        group = "User parameter:BaseApp/Preferences/Mod/Draft"
+        param = App.ParamGet(group + "/BenchmarkLargeDxf")
+        param.SetBool("groupLayers", True)
+        param.SetBool("dxfUseDraftVisGroups", True)
+        try:
+            for skip in (False, True):
+                self.doc.clearDocument()
+                param.SetBool("dxfSkipUnusedLayers", skip)
+                start = time.perf_counter()
+                Import.readDXF(in_file, self.doc.Name, True, group + "/BenchmarkLargeDxf")
+                elapsed = time.perf_counter() - start
+                _msg("  skipUnused={} time={:.2f} s".format(skip, elapsed))
+
+                edges = sum(
+                    len(obj.Shape.Edges)
+                    for obj in self.doc.Objects
+                    if obj.isDerivedFrom("Part::Feature")
+                )
+                self.assertGreaterEqual(edges, count)
+        finally:
+            App.ParamGet(group).RemGroup("BenchmarkLargeDxf")
+            os.remove(in_file)
+
+
+## @}
@@ -33,6 +33,7 @@
 # @{
 
 import os
+import tempfile
 
 import FreeCAD as App
 import Draft
@@ -73,4 +74,146 @@ class DraftDXF(test_base.DraftTestCaseDoc):
         obj = Draft.export_dxf(out_file)
         self.assertTrue(obj, "'{}' failed".format(operation))
 
+    def test_read_dxf_skip_unused(self):
+        """Read a generated DXF file with the C++ importer and check unused parts are skipped."""
+        operation = "Import.readDXF"
+        _msg("  Test '{}'".format(operation))
+        import Import
+
+        count = 300
+        in_file = os.path.join(tempfile.gettempdir(), "draft_test_skip_unused.dxf")
+        _write_dxf(in_file, count)
+        _msg("  file={}".format(in_file))
+        _msg("  entities={}".format(count))
+
+        group = "User parameter:BaseApp/Preferences/Mod/Draft"
+        param = App.ParamGet(group + "/TestSkipUnusedDxf")
+        param.SetBool("groupLayers", True)
+        param.SetBool("dxfUseDraftVisGroups", True)
+        param.SetBool("dxfSkipUnusedLayers", True)
+        try:
+            Import.readDXF(in_file, self.doc.Name, True, group + "/TestSkipUnusedDxf")
+        finally:
+            App.ParamGet(group).RemGroup("TestSkipUnusedDxf")
+            os.remove(in_file)
+
+        labels = [obj.Label for obj in self.doc.Objects]
+        self.assertIn("Used", labels, "'{}' failed".format(operation))
+        self.assertNotIn("Unused", labels, "'{}' skipped no unused layer".format(operation))
+        # The layers only referenced within the blocks are created when a block is read
+        self.assertIn("DoorOnly", labels, "'{}' skipped an inserted block".format(operation))
+        self.assertNotIn("WindowOnly", labels, "'{}' read an unused block".format(operation))
+        edges = sum(
+            len(obj.Shape.Edges) for obj in self.doc.Objects if obj.isDerivedFrom("Part::Feature")
+        )
+        # Every entity plus the one line of each of the two inserted blocks
+        self.assertEqual(edges, count + 2, "'{}' failed".format(operation))
+
+    def test_write_dxf_blocks(self):
+        """Export a pattern of equal squares and check it is written as one block and inserts."""
+        operation = "Import.writeDXFShape"
+        _msg("  Test '{}'".format(operation))
+        import Import
+        import Part
+
+        count = 10
+        square = Part.makePolygon(
+            [App.Vector(0, 0, 0), App.Vector(2, 0, 0), App.Vector(2, 2, 0), App.Vector(0, 2, 0),
+             App.Vector(0, 0, 0)]
+        )
+        squares = [square.translated(App.Vector(5 * i, 3, 0)) for i in range(count)]
+        out_file = os.path.join(tempfile.gettempdir(), "draft_test_blocks.dxf")
+        _msg("  file={}".format(out_file))
+
+        group = "User parameter:BaseApp/Preferences/Mod/Draft"
+        param = App.ParamGet(group + "/TestDxfBlocks")
+        param.SetBool("ExportBlocks", True)
+        try:
+            Import.writeDXFShape([Part.makeCompound(squares)], out_file, 14, False,
+                                 group + "/TestDxfBlocks")
+            with open(out_file) as dxf:
+                records = [line.strip() for line in dxf]
+        finally:
+            App.ParamGet(group).RemGroup("TestDxfBlocks")
+            if os.path.exists(out_file):
+                os.remove(out_file)
+
+        self.assertEqual(records.count("INSERT"), count, "'{}' failed".format(operation))
+        self.assertEqual(records.count("LINE"), 4, "'{}' failed".format(operation))
+        self.assertIn("Block1", records, "'{}' failed".format(operation))
+        # the lines inside the block are on layer 0, only the inserts are on the exported layer
+        pairs = list(zip(records[0::2], records[1::2]))
+        for index, pair in enumerate(pairs):
+            if pair == ("0", "LINE"):
+                layer = next(value for code, value in pairs[index + 1 :] if code == "8")
+                self.assertEqual(layer, "0", "'{}' failed".format(operation))
+
+    def test_write_dxf_circle_blocks(self):
+        """Export a pattern of equal circles and check it is written as one block and inserts."""
+        operation = "Import.writeDXFShape"
+        _msg("  Test '{}'".format(operation))
+        import Import
+        import Part
+
+        count = 6
+        circles = [Part.makeCircle(1.5, App.Vector(10 * i, 0, 0)) for i in range(count)]
+        out_file = os.path.join(tempfile.gettempdir(), "draft_test_circle_blocks.dxf")
+        _msg("  file={}".format(out_file))
+
+        group = "User parameter:BaseApp/Preferences/Mod/Draft"
+        param = App.ParamGet(group + "/TestDxfCircleBlocks")
+        param.SetBool("ExportBlocks", True)
+        try:
+            Import.writeDXFShape([Part.makeCompound(circles)], out_file, 14, False,
+                                 group + "/TestDxfCircleBlocks")
+            with open(out_file) as dxf:
+                records = [line.strip() for line in dxf]
+        finally:
+            App.ParamGet(group).RemGroup("TestDxfCircleBlocks")
+            if os.path.exists(out_file):
+                os.remove(out_file)
+
+        self.assertEqual(records.count("INSERT"), count, "'{}' failed".format(operation))
+        self.assertEqual(records.count("CIRCLE"), 1, "'{}' failed".format(operation))
+
+
+def _write_dxf(filename, count):
+    """Write a DXF file with count lines, arcs and circles on layer 'Used', a block that is
+    inserted twice, a block that is never inserted and a layer that nothing is placed on.
+    The line of each block is on a layer missing from the layer table, 'DoorOnly' and
+    'WindowOnly', which the importer creates when it reads the line."""
+
+    def records(*pairs):
+        return "".join("{}\n{}\n".format(code, value) for code, value in pairs)
+
+    with open(filename, "w", newline="\n") as dxf:
+        dxf.write(records((0, "SECTION"), (2, "HEADER"), (9, "$INSUNITS"), (70, 4)))
+        dxf.write(records((0, "ENDSEC"), (0, "SECTION"), (2, "TABLES"), (0, "TABLE"), (2, "LAYER")))
+        for layer in ("Used", "Unused"):
+            dxf.write(records((0, "LAYER"), (2, layer), (70, 0), (62, 7), (6, "CONTINUOUS")))
+        dxf.write(records((0, "ENDTAB"), (0, "ENDSEC"), (0, "SECTION"), (2, "BLOCKS")))
+        for block in ("Door", "Window"):
+            dxf.write(records((0, "BLOCK"), (8, "Used"), (2, block), (70, 0)))
+            dxf.write(records((10, 0.0), (20, 0.0), (30, 0.0)))
+            dxf.write(records((0, "LINE"), (8, block + "Only"), (10, 0.0), (20, 0.0), (11, 1.0),
+                              (21, 1.0)))
+            dxf.write(records((0, "ENDBLK"), (8, "Used")))
+        dxf.write(records((0, "ENDSEC"), (0, "SECTION"), (2, "ENTITIES")))
+        for i in range(count):
+            x = float(i % 200)
+            y = float(i // 200)
+            if i % 3 == 0:
+                dxf.write(records((0, "LINE"), (8, "Used"), (10, x), (20, y), (30, 0.0),
+                                  (11, x + 0.5), (21, y + 0.5), (31, 0.0)))
+            elif i % 3 == 1:
+                dxf.write(records((0, "ARC"), (8, "Used"), (10, x), (20, y), (30, 0.0),
+                                  (40, 0.25), (50, 0.0), (51, 90.0)))
+            else:
+                dxf.write(records((0, "CIRCLE"), (8, "Used"), (10, x), (20, y), (30, 0.0),
+                                  (40, 0.25)))
+        for x in (0.0, 10.0):
+            dxf.write(records((0, "INSERT"), (8, "Used"), (2, "Door"), (10, x), (20, -5.0),
+                              (30, 0.0)))
+        dxf.write(records((0, "ENDSEC"), (0, "EOF")))
+
 ## @}
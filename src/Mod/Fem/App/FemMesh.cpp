@@ -24,14 +24,24 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <limits>
 #include <memory>
+#include <unordered_map>
 
+#include <BRepAdaptor_Curve.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <GCPnts_TangentialDeflection.hxx>
+#include <Poly_Triangulation.hxx>
 #include <SMDS_MeshGroup.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
@@ -50,6 +60,8 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
@@ -57,6 +69,8 @@
 #include <gp_Pnt.hxx>
 
 #include <boost/assign/list_of.hpp>
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/tokenizer.hpp>  //to simplify parsing input files we use the boost lib
 #endif
 
@@ -141,6 +155,7 @@ FemMesh& FemMesh::operator=(const FemMesh& mesh)
 
 void FemMesh::copyMeshData(const FemMesh& mesh)
 {
+    invalidateDerivedData();
     _Mtrx = mesh._Mtrx;
 
     // 1. Get source mesh
@@ -273,9 +288,42 @@ const SMESH_Mesh* FemMesh::getSMesh() const
 
 SMESH_Mesh* FemMesh::getSMesh()
 {
+    // the caller may modify the mesh through the returned pointer
+    invalidateDerivedData();
     return myMesh;
 }
 
+FemMesh::DerivedDataKey FemMesh::getDerivedDataKey() const
+{
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    DerivedDataKey key;
+    key.numNodes = meshDS->NbNodes();
+    key.numElements = meshDS->GetMeshInfo().NbElements();
+    key.maxNodeID = meshDS->MaxNodeID();
+    key.maxElementID = meshDS->MaxElementID();
+    return key;
+}
+
+std::shared_ptr<FemMesh::DerivedData> FemMesh::getDerivedData() const
+{
+    // the mesh may have been modified through the SMESH objects
+    if (derivedData && derivedDataKey != getDerivedDataKey()) {
+        derivedData.reset();
+    }
+    return derivedData;
+}
+
+void FemMesh::setDerivedData(std::shared_ptr<DerivedData> data) const
+{
+    derivedData = std::move(data);
+    derivedDataKey = getDerivedDataKey();
+}
+
+void FemMesh::invalidateDerivedData()
+{
+    derivedData.reset();
+}
+
 SMESH_Gen* FemMesh::getGenerator()
 {
     if (!FemMesh::_mesh_gen) {
@@ -332,6 +380,7 @@ void FemMesh::setStandardHypotheses()
 
 void FemMesh::compute()
 {
+    invalidateDerivedData();
     getGenerator()->Compute(*myMesh, myMesh->GetShapeToMesh());
 }
 
@@ -341,68 +390,438 @@ std::set<long> FemMesh::getSurfaceNodes(long /*ElemId*/, short /*FaceId*/, float
     return result;
 }
 
+namespace
+{
+
+/*! Returns the IDs of all mesh nodes whose position, given in absolute
+ * coordinates, passes the predicate. The nodes are checked in parallel and
+ * each thread collects its hits into its own buffer, so that no
+ * synchronisation is needed per node.
+ */
+template<typename Predicate>
+std::set<int> findNodes(const SMESHDS_Mesh* meshDS, const Base::Matrix4D& mat, Predicate pred)
+{
+    std::vector<const SMDS_MeshNode*> nodes;
+    nodes.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+    while (aNodeIter->more()) {
+        nodes.push_back(aNodeIter->next());
+    }
+
+    std::vector<int> found;
+#pragma omp parallel
+    {
+        // every thread works on its own copy of the predicate
+        Predicate localPred(pred);
+        std::vector<int> local;
+#pragma omp for schedule(dynamic, 256) nowait
+        for (long i = 0; i < static_cast<long>(nodes.size()); ++i) {
+            const SMDS_MeshNode* aNode = nodes[i];
+            double xyz[3];
+            aNode->GetXYZ(xyz);
+            // Apply the matrix to hold the node in absolute space.
+            Base::Vector3d vec = mat * Base::Vector3d(xyz[0], xyz[1], xyz[2]);
+            if (localPred(vec)) {
+                local.push_back(aNode->GetID());
+            }
+        }
+#pragma omp critical
+        found.insert(found.end(), local.begin(), local.end());
+    }
+
+    return {found.begin(), found.end()};
+}
+
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+/*! Distance index over the tessellation of a shape.
+ *
+ * The triangles of the faces and the polylines of the edges of a tessellated
+ * copy of the shape are stored in an R-tree. A point is classified as
+ * certainly within or certainly beyond the tolerance if its distance to the
+ * tessellation differs from the tolerance by more than the deflection of the
+ * tessellation. Only the points in between need an exact computation.
+ */
+class ShapeDistanceIndex
+{
+public:
+    enum class State
+    {
+        Inside,
+        Outside,
+        Unknown
+    };
+
+    ShapeDistanceIndex(const TopoDS_Shape& shape, const Bnd_Box& box, double limit)
+        : limit(limit)
+    {
+        if (box.IsVoid()) {
+            return;
+        }
+
+        double deflection = std::sqrt(box.SquareExtent()) * 0.001;
+        if (deflection <= 0.0) {
+            return;
+        }
+        slack = 2.0 * deflection;
+
+        try {
+            // mesh a copy so that the triangulation of the original shape stays untouched
+            TopoDS_Shape copy = BRepBuilderAPI_Copy(shape, Standard_True, Standard_False).Shape();
+            BRepMesh_IncrementalMesh(copy, deflection, Standard_False, 0.5, Standard_False);
+            if (!addFaces(copy) || !addEdges(copy, deflection)) {
+                return;
+            }
+        }
+        catch (const Standard_Failure&) {
+            return;
+        }
+
+        std::vector<Value> values;
+        values.reserve(primitives.size());
+        for (std::size_t i = 0; i < primitives.size(); ++i) {
+            const Primitive& prim = primitives[i];
+            Point lower(std::min({prim.p1.X(), prim.p2.X(), prim.p3.X()}),
+                        std::min({prim.p1.Y(), prim.p2.Y(), prim.p3.Y()}),
+                        std::min({prim.p1.Z(), prim.p2.Z(), prim.p3.Z()}));
+            Point upper(std::max({prim.p1.X(), prim.p2.X(), prim.p3.X()}),
+                        std::max({prim.p1.Y(), prim.p2.Y(), prim.p3.Y()}),
+                        std::max({prim.p1.Z(), prim.p2.Z(), prim.p3.Z()}));
+            values.emplace_back(Box(lower, upper), i);
+        }
+
+        // the packing constructor bulk loads the tree
+        tree = RTree(values.begin(), values.end());
+        valid = true;
+    }
+
+    State classify(const gp_Pnt& pnt) const
+    {
+        if (!valid) {
+            return State::Unknown;
+        }
+
+        double radius = limit + slack;
+        Box query(Point(pnt.X() - radius, pnt.Y() - radius, pnt.Z() - radius),
+                  Point(pnt.X() + radius, pnt.Y() + radius, pnt.Z() + radius));
+
+        double minDist = std::numeric_limits<double>::max();
+        for (auto it = tree.qbegin(bgi::intersects(query)); it != tree.qend(); ++it) {
+            minDist = std::min(minDist, distance(primitives[it->second], pnt.XYZ()));
+        }
+
+        if (minDist > radius) {
+            return State::Outside;
+        }
+        if (minDist + slack < limit) {
+            return State::Inside;
+        }
+        return State::Unknown;
+    }
+
+private:
+    // A triangle or, with p3 equal to p2, a line segment
+    struct Primitive
+    {
+        gp_XYZ p1;
+        gp_XYZ p2;
+        gp_XYZ p3;
+    };
+
+    using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Value = std::pair<Box, std::size_t>;
+    using RTree = bgi::rtree<Value, bgi::quadratic<16>>;
+
+    bool addFaces(const TopoDS_Shape& shape)
+    {
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            TopLoc_Location loc;
+            const TopoDS_Face& face = TopoDS::Face(xp.Current());
+            Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+            if (mesh.IsNull()) {
+                return false;
+            }
+
+            gp_Trsf trsf = loc.Transformation();
+            for (int i = 1; i <= mesh->NbTriangles(); ++i) {
+                int n1 {}, n2 {}, n3 {};
+                mesh->Triangle(i).Get(n1, n2, n3);
+                primitives.push_back({mesh->Node(n1).Transformed(trsf).XYZ(),
+                                      mesh->Node(n2).Transformed(trsf).XYZ(),
+                                      mesh->Node(n3).Transformed(trsf).XYZ()});
+            }
+        }
+        return true;
+    }
+
+    bool addEdges(const TopoDS_Shape& shape, double deflection)
+    {
+        for (TopExp_Explorer xp(shape, TopAbs_EDGE); xp.More(); xp.Next()) {
+            const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+            if (BRep_Tool::Degenerated(edge)) {
+                continue;
+            }
+
+            BRepAdaptor_Curve curve(edge);
+            GCPnts_TangentialDeflection discretizer(curve, 0.5, deflection);
+            if (discretizer.NbPoints() < 1) {
+                return false;
+            }
+            for (int i = 1; i < discretizer.NbPoints(); ++i) {
+                gp_XYZ p1 = discretizer.Value(i).XYZ();
+                gp_XYZ p2 = discretizer.Value(i + 1).XYZ();
+                primitives.push_back({p1, p2, p2});
+            }
+            if (discretizer.NbPoints() == 1) {
+                gp_XYZ p1 = discretizer.Value(1).XYZ();
+                primitives.push_back({p1, p1, p1});
+            }
+        }
+        for (TopExp_Explorer xp(shape, TopAbs_VERTEX, TopAbs_EDGE); xp.More(); xp.Next()) {
+            gp_XYZ p1 = BRep_Tool::Pnt(TopoDS::Vertex(xp.Current())).XYZ();
+            primitives.push_back({p1, p1, p1});
+        }
+        return true;
+    }
+
+    static double distance(const gp_XYZ& p1, const gp_XYZ& p2, const gp_XYZ& pnt)
+    {
+        gp_XYZ dir = p2 - p1;
+        double len = dir.SquareModulus();
+        double t = len > 0.0 ? std::clamp((pnt - p1).Dot(dir) / len, 0.0, 1.0) : 0.0;
+        return (p1 + dir * t - pnt).Modulus();
+    }
+
+    static double distance(const Primitive& prim, const gp_XYZ& pnt)
+    {
+        gp_XYZ normal = (prim.p2 - prim.p1).Crossed(prim.p3 - prim.p1);
+        double area = normal.Modulus();
+        if (area > 0.0) {
+            normal /= area;
+            double height = (pnt - prim.p1).Dot(normal);
+            gp_XYZ proj = pnt - normal * height;
+            // the projection lies inside the triangle if it's on the inner side of all edges
+            auto inner = [&](const gp_XYZ& a, const gp_XYZ& b) {
+                return (b - a).Crossed(proj - a).Dot(normal) >= 0.0;
+            };
+            if (inner(prim.p1, prim.p2) && inner(prim.p2, prim.p3) && inner(prim.p3, prim.p1)) {
+                return std::fabs(height);
+            }
+        }
+
+        return std::min({distance(prim.p1, prim.p2, pnt),
+                         distance(prim.p2, prim.p3, pnt),
+                         distance(prim.p3, prim.p1, pnt)});
+    }
+
+private:
+    std::vector<Primitive> primitives;
+    RTree tree;
+    double limit;
+    double slack = 0.0;
+    bool valid = false;
+};
+
+/*! Node predicate for findNodes() that checks if the distance of a node to a
+ * shape is below the tolerance. The exact distance is only computed for nodes
+ * that the tessellation index can't decide. For solids the nodes far away
+ * from the boundary are classified as in or out of the solid.
+ */
+class ShapePredicate
+{
+public:
+    ShapePredicate(const TopoDS_Shape& shape, const Bnd_Box& box, double limit)
+        : shape(shape)
+        , box(box)
+        , limit(limit)
+        , index(std::make_shared<ShapeDistanceIndex>(shape, box, limit))
+    {}
+
+    // the solid classifier isn't shared between threads
+    ShapePredicate(const ShapePredicate& other)
+        : shape(other.shape)
+        , box(other.box)
+        , limit(other.limit)
+        , index(other.index)
+    {}
+
+    ShapePredicate& operator=(const ShapePredicate&) = delete;
+
+    bool operator()(const Base::Vector3d& vec)
+    {
+        gp_Pnt pnt(vec.x, vec.y, vec.z);
+        if (box.IsOut(pnt)) {
+            return false;
+        }
+
+        switch (index->classify(pnt)) {
+            case ShapeDistanceIndex::State::Inside:
+                return true;
+            case ShapeDistanceIndex::State::Outside:
+                if (shape.ShapeType() > TopAbs_SOLID) {
+                    return false;
+                }
+                // far from the boundary the distance to a solid is zero for inner points
+                if (!classifier) {
+                    classifier = std::make_unique<BRepClass3d_SolidClassifier>(shape);
+                }
+                classifier->Perform(pnt, limit);
+                return classifier->State() == TopAbs_IN;
+            default:
+                break;
+        }
+
+        // measure distance
+        BRepExtrema_DistShapeShape measure(shape, BRepBuilderAPI_MakeVertex(pnt).Vertex());
+        measure.Perform();
+        return measure.IsDone() && measure.NbSolution() > 0 && measure.Value() < limit;
+    }
+
+private:
+    const TopoDS_Shape& shape;
+    const Bnd_Box& box;
+    double limit;
+    std::shared_ptr<const ShapeDistanceIndex> index;
+    std::unique_ptr<BRepClass3d_SolidClassifier> classifier;
+};
+
+/*! Returns the IDs of all mesh nodes within the given tolerance of the shape. */
+std::set<int> findNodesOnShape(const SMESHDS_Mesh* meshDS,
+                               const Base::Matrix4D& mat,
+                               const TopoDS_Shape& shape,
+                               const Bnd_Box& box,
+                               double limit)
+{
+    return findNodes(meshDS, mat, ShapePredicate(shape, box, limit));
+}
+
+/*! Node lookup table indexed by node ID, used to test in constant time if
+ * all nodes of an element belong to a node set returned by getNodesByXXX().
+ */
+class NodeMask
+{
+public:
+    NodeMask(const SMESHDS_Mesh* meshDS, const std::set<int>& nodes)
+        : mask(meshDS->MaxNodeID() + 1, false)
+    {
+        for (int id : nodes) {
+            if (id >= 0 && id < static_cast<int>(mask.size())) {
+                mask[id] = true;
+            }
+        }
+    }
+
+    bool contains(int id) const
+    {
+        return id >= 0 && id < static_cast<int>(mask.size()) && mask[id];
+    }
+
+    bool containsAll(const SMDS_MeshElement* elem) const
+    {
+        for (int i = 0, count = elem->NbNodes(); i < count; ++i) {
+            if (!contains(elem->GetNode(i)->GetID())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<bool> mask;
+};
+
+template<typename Element, typename IteratorPtr>
+std::vector<const Element*> collectElements(IteratorPtr iter)
+{
+    std::vector<const Element*> elements;
+    while (iter && iter->more()) {
+        elements.push_back(static_cast<const Element*>(iter->next()));
+    }
+    return elements;
+}
+
+}  // namespace
+
 /*! That function returns map containing volume ID and face ID.
  */
 std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face) const
 {
-    std::list<std::pair<int, int>> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    NodeMask nodes_on_face(meshDS, getNodesByFace(face));
 
     // SMDS_MeshVolume::facesIterator() is broken with SMESH7 as it is impossible
     // to iterate volume faces
     // In SMESH9 this function has been removed
     //
-    std::map<int, std::set<int>> face_nodes;
-
-    // get faces that contribute to 'nodes_on_face' with all of its nodes
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
+    // get faces that contribute to 'nodes_on_face' with all of its nodes, and
+    // index them by their lowest node ID so that each volume only has to check
+    // the faces starting at one of its own nodes
+    std::vector<std::pair<int, std::vector<int>>> face_nodes;
+    std::unordered_multimap<int, std::size_t> faces_by_node;
+    SMDS_FaceIteratorPtr face_iter = meshDS->facesIterator();
     while (face_iter && face_iter->more()) {
         const SMDS_MeshFace* face = face_iter->next();
+        if (!nodes_on_face.containsAll(face)) {
+            continue;
+        }
+        std::vector<int> node_ids;
         SMDS_NodeIteratorPtr node_iter = face->nodeIterator();
-
-        // all nodes of the current face must be part of 'nodes_on_face'
-        std::set<int> node_ids;
         while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
+            node_ids.push_back(node_iter->next()->GetID());
         }
-
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              node_ids.begin(),
-                              node_ids.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
-
-        if (element_face_nodes.size() == node_ids.size()) {
-            face_nodes[face->GetID()] = node_ids;
+        if (node_ids.empty()) {
+            continue;
         }
+        std::sort(node_ids.begin(), node_ids.end());
+        node_ids.erase(std::unique(node_ids.begin(), node_ids.end()), node_ids.end());
+        faces_by_node.emplace(node_ids.front(), face_nodes.size());
+        face_nodes.emplace_back(face->GetID(), std::move(node_ids));
     }
 
-    // get all nodes of a volume and check which faces contribute to it with all of its nodes
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
-        SMDS_NodeIteratorPtr node_iter = vol->nodeIterator();
-        std::set<int> node_ids;
-        while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
-        }
+    std::list<std::pair<int, int>> result;
+    if (face_nodes.empty()) {
+        return result;
+    }
 
-        for (const auto& it : face_nodes) {
-            std::vector<int> element_face_nodes;
-            std::set_intersection(node_ids.begin(),
-                                  node_ids.end(),
-                                  it.second.begin(),
-                                  it.second.end(),
-                                  std::back_insert_iterator<std::vector<int>>(element_face_nodes));
+    // get all nodes of a volume and check which faces contribute to it with all of its nodes
+    auto volumes = collectElements<SMDS_MeshVolume>(meshDS->volumesIterator());
+#pragma omp parallel
+    {
+        std::vector<std::pair<int, int>> local;
+        std::vector<int> node_ids;
+#pragma omp for schedule(dynamic, 256) nowait
+        for (long i = 0; i < static_cast<long>(volumes.size()); ++i) {
+            const SMDS_MeshVolume* vol = volumes[i];
+            node_ids.clear();
+            SMDS_NodeIteratorPtr node_iter = vol->nodeIterator();
+            while (node_iter && node_iter->more()) {
+                node_ids.push_back(node_iter->next()->GetID());
+            }
+            std::sort(node_ids.begin(), node_ids.end());
+            node_ids.erase(std::unique(node_ids.begin(), node_ids.end()), node_ids.end());
 
-            // For curved faces it is possible that a volume contributes more than one face
-            if (element_face_nodes.size() == it.second.size()) {
-                result.emplace_back(vol->GetID(), it.first);
+            for (int id : node_ids) {
+                if (!nodes_on_face.contains(id)) {
+                    continue;
+                }
+                auto range = faces_by_node.equal_range(id);
+                for (auto it = range.first; it != range.second; ++it) {
+                    const auto& face = face_nodes[it->second];
+                    // For curved faces it is possible that a volume contributes more than one
+                    // face
+                    if (std::includes(node_ids.begin(),
+                                      node_ids.end(),
+                                      face.second.begin(),
+                                      face.second.end())) {
+                        local.emplace_back(vol->GetID(), face.first);
+                    }
+                }
             }
         }
+#pragma omp critical
+        result.insert(result.end(), local.begin(), local.end());
     }
     result.sort();
     return result;
@@ -413,28 +832,15 @@ std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face
 std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
 {
     // TODO: This function is broken with SMESH7 as it is impossible to iterate volume faces
-    std::list<int> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    NodeMask nodes_on_face(meshDS, getNodesByFace(face));
 
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
+    std::list<int> result;
+    SMDS_FaceIteratorPtr face_iter = meshDS->facesIterator();
     while (face_iter->more()) {
         const SMDS_MeshFace* face = static_cast<const SMDS_MeshFace*>(face_iter->next());
-        int numNodes = face->NbNodes();
-
-        std::set<int> face_nodes;
-        for (int i = 0; i < numNodes; i++) {
-            face_nodes.insert(face->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              face_nodes.begin(),
-                              face_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
-
         // For curved faces it is possible that a volume contributes more than one face
-        if (element_face_nodes.size() == static_cast<std::size_t>(numNodes)) {
+        if (nodes_on_face.containsAll(face)) {
             result.push_back(face->GetID());
         }
     }
@@ -445,27 +851,14 @@ std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
 
 std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge& edge) const
 {
-    std::list<int> result;
-    std::set<int> nodes_on_edge = getNodesByEdge(edge);
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    NodeMask nodes_on_edge(meshDS, getNodesByEdge(edge));
 
-    SMDS_EdgeIteratorPtr edge_iter = myMesh->GetMeshDS()->edgesIterator();
+    std::list<int> result;
+    SMDS_EdgeIteratorPtr edge_iter = meshDS->edgesIterator();
     while (edge_iter->more()) {
         const SMDS_MeshEdge* edge = static_cast<const SMDS_MeshEdge*>(edge_iter->next());
-        int numNodes = edge->NbNodes();
-
-        std::set<int> edge_nodes;
-        for (int i = 0; i < numNodes; i++) {
-            edge_nodes.insert(edge->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_edge_nodes;
-        std::set_intersection(nodes_on_edge.begin(),
-                              nodes_on_edge.end(),
-                              edge_nodes.begin(),
-                              edge_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_edge_nodes));
-
-        if (element_edge_nodes.size() == static_cast<std::size_t>(numNodes)) {
+        if (nodes_on_edge.containsAll(edge)) {
             result.push_back(edge->GetID());
         }
     }
@@ -563,8 +956,6 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
 
 std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(solid, box);
 
@@ -579,47 +970,11 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-    return result;
+    return findNodesOnShape(myMesh->GetMeshDS(), Mtrx, solid, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(
         face,
@@ -632,48 +987,11 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return findNodesOnShape(myMesh->GetMeshDS(), Mtrx, face, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
     // limit where the mesh node belongs to the edge:
@@ -683,48 +1001,11 @@ std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return findNodesOnShape(myMesh->GetMeshDS(), Mtrx, edge, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
 {
-    std::set<int> result;
-
     double limit = BRep_Tool::Tolerance(vertex);
     limit *= limit;  // use square to improve speed
     gp_Pnt pnt = BRep_Tool::Pnt(vertex);
@@ -733,29 +1014,9 @@ std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
-
-        if (Base::DistanceP2(node, vec) <= limit)
-#pragma omp critical
-        {
-            result.insert(aNode->GetID());
-        }
-    }
-
-    return result;
+    return findNodes(myMesh->GetMeshDS(), Mtrx, [&](const Base::Vector3d& vec) {
+        return Base::DistanceP2(node, vec) <= limit;
+    });
 }
 
 std::list<int> FemMesh::getElementNodes(int id) const
@@ -1605,6 +1866,7 @@ void FemMesh::read(const char* FileName)
 {
     Base::FileInfo File(FileName);
     _Mtrx = Base::Matrix4D();
+    invalidateDerivedData();
 
     // checking on the file
     if (!File.isReadable()) {
@@ -2340,6 +2602,7 @@ void FemMesh::Save(Base::Writer& writer) const
 
 void FemMesh::Restore(Base::XMLReader& reader)
 {
+    invalidateDerivedData();
     reader.readElement("FemMesh");
     std::string file(reader.getAttribute("file"));
 
@@ -2401,6 +2664,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     file.close();
 
     // read the shape from the temp file
+    invalidateDerivedData();
     myMesh->UNVToMesh(fi.filePath().c_str());
 
     // delete the temp file
@@ -2410,6 +2674,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
+    invalidateDerivedData();
     Base::Matrix4D clMatrix(rclTrf);
     SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
     Base::Vector3d current_node;
@@ -172,6 +172,26 @@ public:
     void transformGeometry(const Base::Matrix4D& rclMat) override;
     //@}
 
+    /** @name Derived data cache */
+    //@{
+    /// Base class of data derived from the mesh, e.g. its VTK representation
+    class DerivedData
+    {
+    public:
+        virtual ~DerivedData() = default;
+    };
+    /// Returns the data cached with the mesh, or null if the mesh changed since it was set
+    std::shared_ptr<DerivedData> getDerivedData() const;
+    /** Caches data derived from the current mesh. It is dropped by all modifying methods of
+     * FemMesh. The cache is also bound to the element and node counts and IDs so that changes
+     * done directly through the SMESH objects are detected. If only node positions are changed
+     * that way, invalidateDerivedData() must be called.
+     */
+    void setDerivedData(std::shared_ptr<DerivedData> data) const;
+    /// Drops the cached derived data, called whenever the mesh may have been modified
+    void invalidateDerivedData();
+    //@}
+
     /** @name Group management */
     //@{
     /// Adds group to mesh
@@ -214,6 +234,18 @@ public:
     void writeZ88(const std::string& FileName) const;
 
 private:
+    /// The state of the mesh data a cache entry was created for
+    struct DerivedDataKey
+    {
+        int numNodes = -1;
+        int numElements = -1;
+        int maxNodeID = -1;
+        int maxElementID = -1;
+
+        bool operator==(const DerivedDataKey&) const = default;
+    };
+    DerivedDataKey getDerivedDataKey() const;
+
     void copyMeshData(const FemMesh&);
     void readNastran(const std::string& Filename);
     void readNastran95(const std::string& Filename);
@@ -229,6 +261,8 @@ private:
 #endif
 
     std::list<SMESH_HypothesisPtr> hypoth;
+    mutable std::shared_ptr<DerivedData> derivedData;
+    mutable DerivedDataKey derivedDataKey;
     static SMESH_Gen* _mesh_gen;
 };
 
@@ -627,11 +627,11 @@ void FemPostPipeline::load(FemResultObject* res)
         return;
     }
 
-    // first copy the mesh over
+    // first share the mesh
     // ***************************
     const FemMesh& mesh = static_cast<FemMeshObject*>(res->Mesh.getValue())->FemMesh.getValue();
     vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-    FemVTKTools::exportVTKMesh(&mesh, grid);
+    grid->ShallowCopy(FemVTKTools::getVTKMesh(&mesh));
 
     // Now copy the point data over
     // ***************************
@@ -668,11 +668,11 @@ void FemPostPipeline::load(std::vector<FemResultObject*>& res,
             return;
         }
 
-        // first copy the mesh over
+        // first share the mesh, the frames usually use the same one
         const FemMesh& mesh =
             static_cast<FemMeshObject*>(res[i]->Mesh.getValue())->FemMesh.getValue();
         vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-        FemVTKTools::exportVTKMesh(&mesh, grid);
+        grid->ShallowCopy(FemVTKTools::getVTKMesh(&mesh));
 
         // Now copy the point data over
         FemVTKTools::exportFreeCADResult(res[i], grid);
@@ -25,11 +25,17 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
 #include <charconv>
 #include <cmath>
 #include <cstdlib>
+#include <exception>
 #include <map>
 #include <memory>
+#include <string_view>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -107,25 +113,47 @@ void writeVTKFile(const char* filename, vtkSmartPointer<vtkUnstructuredGrid> dat
 namespace
 {
 
-// Helper function to fill vtkCellArray from SMDS_Mesh using vtk cell order
-template<typename T, typename E>
-void fillVtkArray(vtkSmartPointer<vtkCellArray>& elemArray, std::vector<int>& types, const E* elem)
+// Cells of one element level collected from SMDS_Mesh using vtk cell order. The
+// cells are stored in plain buffers first, so that the element levels can be
+// collected concurrently and inserted into the vtkCellArray in one go.
+struct CellBuffer
 {
-    vtkSmartPointer<T> cell = vtkSmartPointer<T>::New();
-    const std::vector<int>& order = SMDS_MeshCell::toVtkOrder(elem->GetEntityType());
-    if (!order.empty()) {
-        for (int i = 0; i < elem->NbNodes(); ++i) {
-            cell->GetPointIds()->SetId(i, elem->GetNode(order[i])->GetID() - 1);
+    // number of points followed by the point IDs of each cell
+    std::vector<vtkIdType> ids;
+    std::vector<int> types;
+
+    template<typename E>
+    void add(const E* elem)
+    {
+        const int nbNodes = elem->NbNodes();
+        const std::vector<int>& order = SMDS_MeshCell::toVtkOrder(elem->GetEntityType());
+        ids.push_back(nbNodes);
+        if (!order.empty()) {
+            for (int i = 0; i < nbNodes; ++i) {
+                ids.push_back(elem->GetNode(order[i])->GetID() - 1);
+            }
+        }
+        else {
+            for (int i = 0; i < nbNodes; ++i) {
+                ids.push_back(elem->GetNode(i)->GetID() - 1);
+            }
         }
+        types.push_back(SMDS_MeshCell::toVtkType(elem->GetEntityType()));
     }
-    else {
-        for (int i = 0; i < elem->NbNodes(); ++i) {
-            cell->GetPointIds()->SetId(i, elem->GetNode(i)->GetID() - 1);
+
+    bool empty() const
+    {
+        return types.empty();
+    }
+
+    void insertInto(vtkCellArray* elemArray, std::vector<int>& allTypes) const
+    {
+        for (size_t pos = 0; pos < ids.size(); pos += ids[pos] + 1) {
+            elemArray->InsertNextCell(ids[pos], &ids[pos + 1]);
         }
+        allTypes.insert(allTypes.end(), types.begin(), types.end());
     }
-    elemArray->InsertNextCell(cell);
-    types.push_back(SMDS_MeshCell::toVtkType(elem->GetEntityType()));
-}
+};
 
 // Helper function to fill SMDS_Mesh elements ID from vtk cell
 void fillMeshElementIds(vtkCell* cell, std::vector<int>& ids)
@@ -344,103 +372,70 @@ FemMesh* FemVTKTools::readVTKMesh(const char* filename, FemMesh* mesh)
     return mesh;
 }
 
-void exportFemMeshEdges(vtkSmartPointer<vtkCellArray>& elemArray,
-                        std::vector<int>& types,
-                        const SMDS_EdgeIteratorPtr& aEdgeIter)
+void exportFemMeshEdges(CellBuffer& cells, const SMDS_EdgeIteratorPtr& aEdgeIter)
 {
-    Base::Console().Log("  Start: VTK mesh builder edges.\n");
-
     while (aEdgeIter->more()) {
         const SMDS_MeshEdge* aEdge = aEdgeIter->next();
-        // edge
-        if (aEdge->GetEntityType() == SMDSEntity_Edge) {
-            fillVtkArray<vtkLine>(elemArray, types, aEdge);
-        }
-        // quadratic edge
-        else if (aEdge->GetEntityType() == SMDSEntity_Quad_Edge) {
-            fillVtkArray<vtkQuadraticEdge>(elemArray, types, aEdge);
-        }
-        else {
-            throw Base::TypeError("Edge not yet supported by FreeCAD's VTK mesh builder\n");
+        switch (aEdge->GetEntityType()) {
+            case SMDSEntity_Edge:       // edge
+            case SMDSEntity_Quad_Edge:  // quadratic edge
+                cells.add(aEdge);
+                break;
+            default:
+                throw Base::TypeError("Edge not yet supported by FreeCAD's VTK mesh builder\n");
         }
     }
-
-    Base::Console().Log("  End: VTK mesh builder edges.\n");
 }
 
-void exportFemMeshFaces(vtkSmartPointer<vtkCellArray>& elemArray,
-                        std::vector<int>& types,
-                        const SMDS_FaceIteratorPtr& aFaceIter)
+void exportFemMeshFaces(CellBuffer& cells, const SMDS_FaceIteratorPtr& aFaceIter)
 {
-    Base::Console().Log("  Start: VTK mesh builder faces.\n");
-
     while (aFaceIter->more()) {
         const SMDS_MeshFace* aFace = aFaceIter->next();
-        // triangle
-        if (aFace->GetEntityType() == SMDSEntity_Triangle) {
-            fillVtkArray<vtkTriangle>(elemArray, types, aFace);
-        }
-        // quad
-        else if (aFace->GetEntityType() == SMDSEntity_Quadrangle) {
-            fillVtkArray<vtkQuad>(elemArray, types, aFace);
-        }
-        // quadratic triangle
-        else if (aFace->GetEntityType() == SMDSEntity_Quad_Triangle) {
-            fillVtkArray<vtkQuadraticTriangle>(elemArray, types, aFace);
-        }
-        // quadratic quad
-        else if (aFace->GetEntityType() == SMDSEntity_Quad_Quadrangle) {
-            fillVtkArray<vtkQuadraticQuad>(elemArray, types, aFace);
-        }
-        else {
-            throw Base::TypeError("Face not yet supported by FreeCAD's VTK mesh builder\n");
+        switch (aFace->GetEntityType()) {
+            case SMDSEntity_Triangle:        // triangle
+            case SMDSEntity_Quadrangle:      // quad
+            case SMDSEntity_Quad_Triangle:   // quadratic triangle
+            case SMDSEntity_Quad_Quadrangle: // quadratic quad
+                cells.add(aFace);
+                break;
+            default:
+                throw Base::TypeError("Face not yet supported by FreeCAD's VTK mesh builder\n");
         }
     }
-
-    Base::Console().Log("  End: VTK mesh builder faces.\n");
 }
 
-void exportFemMeshCells(vtkSmartPointer<vtkCellArray>& elemArray,
-                        std::vector<int>& types,
-                        const SMDS_VolumeIteratorPtr& aVolIter)
+void exportFemMeshCells(CellBuffer& cells, const SMDS_VolumeIteratorPtr& aVolIter)
 {
-    Base::Console().Log("  Start: VTK mesh builder volumes.\n");
-
     while (aVolIter->more()) {
         const SMDS_MeshVolume* aVol = aVolIter->next();
-
-        if (aVol->GetEntityType() == SMDSEntity_Tetra) {  // tetra4
-            fillVtkArray<vtkTetra>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Pyramid) {  // pyra5
-            fillVtkArray<vtkPyramid>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Penta) {  // penta6
-            fillVtkArray<vtkWedge>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Hexa) {  // hexa8
-            fillVtkArray<vtkHexahedron>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Tetra) {  // tetra10
-            fillVtkArray<vtkQuadraticTetra>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Pyramid) {  // pyra13
-            fillVtkArray<vtkQuadraticPyramid>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Penta) {  // penta15
-            fillVtkArray<vtkQuadraticWedge>(elemArray, types, aVol);
-        }
-        else if (aVol->GetEntityType() == SMDSEntity_Quad_Hexa) {  // hexa20
-            fillVtkArray<vtkQuadraticHexahedron>(elemArray, types, aVol);
-        }
-        else {
-            throw Base::TypeError("Volume not yet supported by FreeCAD's VTK mesh builder\n");
+        switch (aVol->GetEntityType()) {
+            case SMDSEntity_Tetra:         // tetra4
+            case SMDSEntity_Pyramid:       // pyra5
+            case SMDSEntity_Penta:         // penta6
+            case SMDSEntity_Hexa:          // hexa8
+            case SMDSEntity_Quad_Tetra:    // tetra10
+            case SMDSEntity_Quad_Pyramid:  // pyra13
+            case SMDSEntity_Quad_Penta:    // penta15
+            case SMDSEntity_Quad_Hexa:     // hexa20
+                cells.add(aVol);
+                break;
+            default:
+                throw Base::TypeError("Volume not yet supported by FreeCAD's VTK mesh builder\n");
         }
     }
-
-    Base::Console().Log("  End: VTK mesh builder volumes.\n");
 }
 
+namespace
+{
+// Cached VTK representation of a FemMesh
+class VTKMeshCache: public FemMesh::DerivedData
+{
+public:
+    // index 0: highest element level only, index 1: all element levels
+    vtkSmartPointer<vtkUnstructuredGrid> grids[2];
+};
+}  // namespace
+
 void FemVTKTools::exportVTKMesh(const FemMesh* mesh,
                                 vtkSmartPointer<vtkUnstructuredGrid> grid,
                                 bool highest,
@@ -454,21 +449,39 @@ void FemVTKTools::exportVTKMesh(const FemMesh* mesh,
     // nodes
     Base::Console().Log("  Start: VTK mesh builder nodes.\n");
 
-    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+    std::vector<const SMDS_MeshNode*> nodes;
+    nodes.reserve(meshDS->NbNodes());
     SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
-
     while (aNodeIter->more()) {
-        const SMDS_MeshNode* node = aNodeIter->next();  // why float, not double?
-        double coords[3] = {double(node->X() * scale),
-                            double(node->Y() * scale),
-                            double(node->Z() * scale)};
-        points->InsertPoint(node->GetID() - 1, coords);
-        // memory is allocated by VTK points size for max node id, not for point count
-        // if the SMESH mesh has gaps in node numbering, points without any element
-        // assignment will be inserted in these point gaps too
-        // this needs to be taken into account on node mapping when FreeCAD FEM results
-        // are exported to vtk
+        nodes.push_back(aNodeIter->next());
+    }
+
+    // memory is allocated by VTK points size for max node id, not for point count
+    // if the SMESH mesh has gaps in node numbering, points without any element
+    // assignment will be inserted in these point gaps too
+    // this needs to be taken into account on node mapping when FreeCAD FEM results
+    // are exported to vtk
+    vtkIdType maxId = 0;
+    for (const SMDS_MeshNode* node : nodes) {
+        maxId = std::max<vtkIdType>(maxId, node->GetID());
+    }
+    auto coords = vtkSmartPointer<vtkFloatArray>::New();
+    coords->SetNumberOfComponents(3);
+    coords->SetNumberOfTuples(maxId);
+    for (int i = 0; i < 3; ++i) {
+        coords->FillComponent(i, 0.0);
+    }
+    float* raw = coords->GetPointer(0);
+#pragma omp parallel for
+    for (long i = 0; i < static_cast<long>(nodes.size()); ++i) {
+        const SMDS_MeshNode* node = nodes[i];
+        float* xyz = raw + 3 * (node->GetID() - 1);
+        xyz[0] = float(node->X() * scale);
+        xyz[1] = float(node->Y() * scale);
+        xyz[2] = float(node->Z() * scale);
     }
+    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+    points->SetData(coords);
     grid->SetPoints(points);
     // nodes debugging
     const SMDS_MeshInfo& info = meshDS->GetMeshInfo();
@@ -477,37 +490,40 @@ void FemVTKTools::exportVTKMesh(const FemMesh* mesh,
     Base::Console().Log("    Size of nodes in VTK grid: %i.\n", nNodes);
     Base::Console().Log("  End: VTK mesh builder nodes.\n");
 
-    vtkSmartPointer<vtkCellArray> elemArray = vtkSmartPointer<vtkCellArray>::New();
-    std::vector<int> types;
-
+    Base::Console().Log("  Start: VTK mesh builder elements.\n");
+    std::vector<CellBuffer> levels;
     if (highest) {
+        levels.resize(1);
+        CellBuffer& cells = levels.front();
         // try volumes
-        SMDS_VolumeIteratorPtr aVolIter = meshDS->volumesIterator();
-        exportFemMeshCells(elemArray, types, aVolIter);
+        exportFemMeshCells(cells, meshDS->volumesIterator());
         // try faces
-        if (elemArray->GetNumberOfCells() == 0) {
-            SMDS_FaceIteratorPtr aFaceIter = meshDS->facesIterator();
-            exportFemMeshFaces(elemArray, types, aFaceIter);
+        if (cells.empty()) {
+            exportFemMeshFaces(cells, meshDS->facesIterator());
         }
         // try edges
-        if (elemArray->GetNumberOfCells() == 0) {
-            SMDS_EdgeIteratorPtr aEdgeIter = meshDS->edgesIterator();
-            exportFemMeshEdges(elemArray, types, aEdgeIter);
+        if (cells.empty()) {
+            exportFemMeshEdges(cells, meshDS->edgesIterator());
         }
     }
     else {
         // export all elements
+        levels.resize(3);
         // edges
-        SMDS_EdgeIteratorPtr aEdgeIter = meshDS->edgesIterator();
-        exportFemMeshEdges(elemArray, types, aEdgeIter);
+        exportFemMeshEdges(levels[0], meshDS->edgesIterator());
         // faces
-        SMDS_FaceIteratorPtr aFaceIter = meshDS->facesIterator();
-        exportFemMeshFaces(elemArray, types, aFaceIter);
+        exportFemMeshFaces(levels[1], meshDS->facesIterator());
         // volumes
-        SMDS_VolumeIteratorPtr aVolIter = meshDS->volumesIterator();
-        exportFemMeshCells(elemArray, types, aVolIter);
+        exportFemMeshCells(levels[2], meshDS->volumesIterator());
     }
 
+    vtkSmartPointer<vtkCellArray> elemArray = vtkSmartPointer<vtkCellArray>::New();
+    std::vector<int> types;
+    for (const auto& cells : levels) {
+        cells.insertInto(elemArray, types);
+    }
+    Base::Console().Log("  End: VTK mesh builder elements.\n");
+
     if (elemArray->GetNumberOfCells() > 0) {
         grid->SetCells(types.data(), elemArray);
     }
@@ -515,6 +531,22 @@ void FemVTKTools::exportVTKMesh(const FemMesh* mesh,
     Base::Console().Log("End: VTK mesh builder ======================\n");
 }
 
+vtkSmartPointer<vtkUnstructuredGrid> FemVTKTools::getVTKMesh(const FemMesh* mesh, bool highest)
+{
+    auto cache = std::dynamic_pointer_cast<VTKMeshCache>(mesh->getDerivedData());
+    if (!cache) {
+        cache = std::make_shared<VTKMeshCache>();
+        mesh->setDerivedData(cache);
+    }
+    auto& grid = cache->grids[highest ? 0 : 1];
+    if (!grid) {
+        auto newGrid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+        exportVTKMesh(mesh, newGrid, highest);
+        grid = newGrid;
+    }
+    return grid;
+}
+
 void FemVTKTools::writeVTKMesh(const char* filename, const FemMesh* mesh, bool highest)
 {
 
@@ -522,8 +554,7 @@ void FemVTKTools::writeVTKMesh(const char* filename, const FemMesh* mesh, bool h
     Base::Console().Log("Start: write FemMesh from VTK unstructuredGrid ======================\n");
     Base::FileInfo f(filename);
 
-    vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-    exportVTKMesh(mesh, grid, highest);
+    vtkSmartPointer<vtkUnstructuredGrid> grid = getVTKMesh(mesh, highest);
     Base::Console().Log("Start: writing mesh data ======================\n");
     if (f.hasExtension("vtu")) {
         writeVTKFile<vtkXMLUnstructuredGridWriter>(filename, grid);
@@ -669,13 +700,13 @@ void FemVTKTools::writeResult(const char* filename, const App::DocumentObject* r
     Base::Console().Log("Start: write FemResult to VTK unstructuredGrid dataset =======\n");
     Base::FileInfo f(filename);
 
-    // mesh
+    // mesh, shallow copy the shared grid to add the result data to it
     vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
     App::DocumentObject* mesh =
         static_cast<App::PropertyLink*>(res->getPropertyByName("Mesh"))->getValue();
     const FemMesh& fmesh =
         static_cast<PropertyFemMesh*>(mesh->getPropertyByName("FemMesh"))->getValue();
-    FemVTKTools::exportVTKMesh(&fmesh, grid);
+    grid->ShallowCopy(FemVTKTools::getVTKMesh(&fmesh));
 
     Base::Console().Log("    %f: vtk mesh builder finished\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
@@ -1110,37 +1141,78 @@ std::map<int, std::vector<int>> mapCcxToVtk = {
     {VTK_WEDGE, {0, 1, 2, 3, 4, 5}},
     {VTK_QUADRATIC_WEDGE, {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 13, 14, 9, 10, 11}}};
 
-// give position of first non-blank character of string_view
-size_t getFirstNotBlankPos(const std::string_view& view)
+// sequential line access to a FRD file held in memory
+class LineReader
 {
-    size_t pos = view.find_first_not_of(" ");
-    if (pos == std::string_view::npos) {
-        pos = 0;
+public:
+    explicit LineReader(std::string_view data, size_t pos = 0)
+        : data(data)
+        , pos(pos)
+    {}
+
+    bool getline(std::string_view& line)
+    {
+        if (pos >= data.size()) {
+            return false;
+        }
+        size_t end = data.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = data.size();
+        }
+        line = data.substr(pos, end - pos);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        pos = end + 1;
+        return true;
     }
 
-    return pos;
+    size_t position() const
+    {
+        return pos;
+    }
+
+private:
+    std::string_view data;
+    size_t pos;
+};
+
+bool startsWith(std::string_view line, std::string_view key)
+{
+    return line.substr(0, key.size()) == key;
 }
 
-// get n-digits value from string_view
-// not used until libc++ std::from_chars supports double values
-// template<typename T>
-// void valueFromLine(const std::string_view::const_iterator& it, int digits, T& value)
-//{
-//    std::string_view sub(it, digits);
-//    auto pos = getFirstNotBlankPos(sub);
-//    std::from_chars(sub.data() + pos, sub.data() + digits, value, 10);
-//}
+// get value of the fixed width field starting at pos, fields are parsed within
+// their bounds only since lines are not null terminated
 template<typename T>
-void valueFromLine(const std::string_view::iterator& it, int digits, T& value)
+void valueFromLine(std::string_view line, size_t pos, size_t digits, T& value)
 {
-    std::string_view sub(&*it, digits);
-    value = std::strtol(sub.data(), nullptr, 10);
+    value = 0;
+    if (pos >= line.size()) {
+        return;
+    }
+    std::string_view sub = line.substr(pos, digits);
+    size_t first = sub.find_first_not_of(' ');
+    if (first == std::string_view::npos) {
+        return;
+    }
+    sub.remove_prefix(first);
+    std::from_chars(sub.data(), sub.data() + sub.size(), value, 10);
 }
+// not using std::from_chars until libc++ supports double values
 template<>
-void valueFromLine<double>(const std::string_view::iterator& it, int digits, double& value)
+void valueFromLine<double>(std::string_view line, size_t pos, size_t digits, double& value)
 {
-    std::string_view sub(&*it, digits);
-    value = std::strtof(sub.data(), nullptr);
+    value = 0.0;
+    if (pos >= line.size()) {
+        return;
+    }
+    std::string_view sub = line.substr(pos, digits);
+    char buffer[32];
+    size_t len = std::min(sub.size(), sizeof(buffer) - 1);
+    std::copy_n(sub.data(), len, buffer);
+    buffer[len] = '\0';
+    value = std::strtof(buffer, nullptr);
 }
 
 // add cell from sorted nodes
@@ -1274,10 +1346,10 @@ std::vector<size_t> identifyScalarEntities(const std::vector<std::vector<int>> e
 
 // read nodes and fill vtkPoints object
 std::map<int, int>
-readNodes(std::ifstream& ifstr, const std::string& lines, vtkSmartPointer<vtkPoints>& points)
+readNodes(LineReader& reader, std::string_view lines, vtkSmartPointer<vtkPoints>& points)
 {
-    std::string keyCode = "    2C";
-    std::string keyCodeCoord = " -1";
+    std::string_view keyCode = "    2C";
+    std::string_view keyCodeCoord = " -1";
     long numNodes {0};
     int indicator {0};
     int node {0};
@@ -1287,34 +1359,30 @@ readNodes(std::ifstream& ifstr, const std::string& lines, vtkSmartPointer<vtkPoi
     // Use the map to identify them
     std::map<int, int> mapNodes;
 
-    std::string_view view {lines};
-    std::string_view sub = view.substr(keyCode.length() + 18);
-
-    valueFromLine(sub.begin(), 12, numNodes);
+    size_t pos = keyCode.length() + 18;
+    valueFromLine(lines, pos, 12, numNodes);
 
-    sub = sub.substr(12 + 37);
-    valueFromLine(sub.begin(), 1, indicator);
+    pos += 12 + 37;
+    valueFromLine(lines, pos, 1, indicator);
     int digits = getDigits(static_cast<Indicator>(indicator));
 
     points->SetNumberOfPoints(numNodes);
 
-    std::string line;
-    while (nodeID < numNodes && std::getline(ifstr, line)) {
-        std::vector<double> coords;
-        std::string_view view {line};
-        if (view.rfind(keyCodeCoord, 0) == 0) {
-            std::string_view v(line.data() + keyCodeCoord.length(), digits);
-            valueFromLine(v.begin(), digits, node);
-
-            std::string_view vi = view.substr(keyCodeCoord.length() + digits);
-            double value;
-            for (auto it = vi.begin(); it != vi.end(); it += 12) {
-                valueFromLine(it, 12, value);
-                coords.emplace_back(value);
-            }
+    std::string_view line;
+    while (nodeID < numNodes && reader.getline(line)) {
+        if (!startsWith(line, keyCodeCoord)) {
+            continue;
+        }
+        valueFromLine(line, keyCodeCoord.length(), digits, node);
+
+        double coords[3] = {0.0, 0.0, 0.0};
+        pos = keyCodeCoord.length() + digits;
+        for (double& value : coords) {
+            valueFromLine(line, pos, 12, value);
+            pos += 12;
         }
 
-        points->SetPoint(nodeID, coords.data());
+        points->SetPoint(nodeID, coords);
         mapNodes[node] = nodeID++;
     }
 
@@ -1322,51 +1390,45 @@ readNodes(std::ifstream& ifstr, const std::string& lines, vtkSmartPointer<vtkPoi
 }
 
 // fill elements and fill cell array
-std::vector<int> readElements(std::ifstream& ifstr,
-                              const std::string& lines,
+std::vector<int> readElements(LineReader& reader,
+                              std::string_view lines,
                               const std::map<int, int>& mapNodes,
                               vtkSmartPointer<vtkCellArray>& cellArray)
 {
-    std::string line;
-    std::string keyCode = "    3C";
-    std::string keyCodeType = " -1";
-    std::string keyCodeNodes = " -2";
+    std::string_view line;
+    std::string_view keyCode = "    3C";
+    std::string_view keyCodeType = " -1";
+    std::string_view keyCodeNodes = " -2";
     long numElem;
     int indicator;
     int elem;
     long elemID = 0;
     // element info: {type, group, material}
     std::vector<int> info(3);
-    std::map<int, int> mapElem;
     std::vector<int> topoElem;
     std::vector<int> vtkType;
 
-    std::string_view view {lines};
+    size_t pos = keyCode.length() + 18;
+    valueFromLine(lines, pos, 12, numElem);
 
-    std::string_view sub = view.substr(keyCode.length() + 18);
-    valueFromLine(sub.begin(), 12, numElem);
-
-    sub = sub.substr(12 + 37);
-    valueFromLine(sub.begin(), 1, indicator);
+    pos += 12 + 37;
+    valueFromLine(lines, pos, 1, indicator);
     int digits = getDigits(static_cast<Indicator>(indicator));
-    while (elemID < numElem && std::getline(ifstr, line)) {
-        std::string_view view {line};
-        if (view.rfind(keyCodeType, 0) == 0) {
-            std::string_view v(line.data() + keyCodeType.length());
-            valueFromLine(v.begin(), digits, elem);
-            v = v.substr(digits);
-            std::string_view::iterator it1;
-            std::vector<int>::iterator it2;
-            for (it1 = v.begin(), it2 = info.begin(); it1 != v.end() && it2 != info.end();
-                 it1 += 5, ++it2) {
-                valueFromLine(it1, 5, *it2);
+    vtkType.reserve(numElem);
+    while (elemID < numElem && reader.getline(line)) {
+        if (startsWith(line, keyCodeType)) {
+            pos = keyCodeType.length();
+            valueFromLine(line, pos, digits, elem);
+            pos += digits;
+            for (int& value : info) {
+                valueFromLine(line, pos, 5, value);
+                pos += 5;
             }
         }
-        if (view.rfind(keyCodeNodes, 0) == 0) {
-            std::string_view vi = view.substr(keyCodeNodes.length());
+        else if (startsWith(line, keyCodeNodes)) {
             int node;
-            for (auto it = vi.begin(); it != vi.end(); it += digits) {
-                valueFromLine(it, digits, node);
+            for (pos = keyCodeNodes.length(); pos < line.size(); pos += digits) {
+                valueFromLine(line, pos, digits, node);
                 topoElem.emplace_back(mapNodes.at(node));
             }
 
@@ -1374,94 +1436,74 @@ std::vector<int> readElements(std::ifstream& ifstr,
             if (topoElem.size() == mapCcxTypeNodes[static_cast<ElementType>(info[0])]) {
                 fillCell(cellArray, topoElem, vtkType, static_cast<ElementType>(info[0]));
                 topoElem.clear();
-                mapElem[elem] = elemID++;
+                ++elemID;
             }
         }
     }
     return vtkType;
 }
 
-// read parameter header (not used)
-void readParameter(std::ifstream& ifstr, const std::string& line)
-{
-    // do nothing
-    (void)ifstr;
-    (void)line;
-}
-
 // read first header from nodal result block
-void readResultInfo(std::ifstream& ifstr, const std::string& lines, FRDResultInfo& info)
+void readResultInfo(std::string_view lines, FRDResultInfo& info)
 {
-    (void)ifstr;
+    std::string_view keyCode = "  100C";
 
-    std::string keyCode = "  100C";
+    size_t pos = keyCode.length() + 6;
+    valueFromLine(lines, pos, 12, info.value);
 
-    std::string_view view {lines};
-    std::string_view sub = view.substr(keyCode.length() + 6);
-    valueFromLine(sub.begin(), 12, info.value);
+    pos += 12;
+    valueFromLine(lines, pos, 12, info.numNodes);
 
-    sub = sub.substr(12);
-    valueFromLine(sub.begin(), 12, info.numNodes);
-
-    sub = sub.substr(12 + 20);
+    pos += 12 + 20;
     int anType;
-    valueFromLine(sub.begin(), 2, anType);
+    valueFromLine(lines, pos, 2, anType);
     info.analysisType = static_cast<AnalysisType>(anType);
 
-    sub = sub.substr(2);
-    valueFromLine(sub.begin(), 5, info.step);
+    pos += 2;
+    valueFromLine(lines, pos, 5, info.step);
 
-    sub = sub.substr(5 + 10);
+    pos += 5 + 10;
     int ind;
-    valueFromLine(sub.begin(), 2, ind);
+    valueFromLine(lines, pos, 2, ind);
     info.indicator = static_cast<Indicator>(ind);
 }
 
-// read result from nodal result block and add result array to grid
-void readResults(std::ifstream& ifstr,
-                 const std::string& lines,
-                 const std::map<int, int>& mapNodes,
-                 const FRDResultInfo& info,
-                 vtkSmartPointer<vtkUnstructuredGrid>& grid)
+// read result from nodal result block, return the result arrays to add to the grid
+std::vector<vtkSmartPointer<vtkDoubleArray>>
+readResults(LineReader& reader, const std::map<int, int>& mapNodes, const FRDResultInfo& info)
 {
     int digits = getDigits(info.indicator);
-    (void)lines;
 
     // get dataset info, start with " -4"
-    std::string line;
-    std::string keyDataSet = " -4";
+    std::string_view line;
+    std::string_view keyDataSet = " -4";
     unsigned int numComps;
-    std::getline(ifstr, line);
-    std::string_view view = line;
-    std::string_view sub = view.substr(keyDataSet.length() + 2);
-    std::string dataSetName {sub.substr(0, 8)};
+    reader.getline(line);
+    size_t pos = keyDataSet.length() + 2;
+    std::string dataSetName {line.substr(std::min(pos, line.size()), 8)};
     // remove trailing spaces
     dataSetName.erase(dataSetName.find_last_not_of(" ") + 1);
-    sub = sub.substr(8);
-    valueFromLine(sub.begin(), 5, numComps);
+    valueFromLine(line, pos + 8, 5, numComps);
 
     // get entity info
-    std::string keyEntity = " -5";
+    std::string_view keyEntity = " -5";
     std::vector<std::string> entityNames;
     // type: 1: scalar; 2: vector; 4: matrix; 12: vector (3 amp - 3 phase); 14: tensor (6 amp - 6
     // phase) {type, row, col, exist}
     std::vector<std::vector<int>> entityTypes;
     unsigned int countComp = 0;
-    while (countComp < numComps && std::getline(ifstr, line)) {
-        std::string_view view {line};
-        if (view.rfind(keyEntity, 0) == 0) {
-            sub = view.substr(keyEntity.length() + 2);
-            std::string en {sub.substr(0, 8)};
+    while (countComp < numComps && reader.getline(line)) {
+        if (startsWith(line, keyEntity)) {
+            pos = keyEntity.length() + 2;
+            std::string en {line.substr(std::min(pos, line.size()), 8)};
             // remove trailing spaces
             en.erase(en.find_last_not_of(" ") + 1);
             std::vector<int> et = {0, 0, 0, 0};
             // fill entityType, ignore MENU: "    1"
-            sub = sub.substr(8 + 5, 4 * 5);
-            std::string_view::iterator it1;
-            std::vector<int>::iterator it2;
-            for (it1 = sub.begin(), it2 = et.begin(); it1 != sub.end() && it2 != et.end();
-                 (it1 += 5), ++it2) {
-                valueFromLine(it1, digits, *it2);
+            pos += 8 + 5;
+            for (int& value : et) {
+                valueFromLine(line, pos, 5, value);
+                pos += 5;
             }
 
             if (et[3] == 0) {
@@ -1477,18 +1519,31 @@ void readResults(std::ifstream& ifstr,
     numComps = entityNames.size();
 
     // enter in node values block
-    std::string code1 = " -1";
-    std::string code2 = " -2";
+    std::string_view code1 = " -1";
+    std::string_view code2 = " -2";
     int node {-1};
+    bool validNode {false};
     double value {0.0};
     std::vector<double> vecValues;
     std::vector<double> scaValues;
-    std::vector<int> nodes;
     int countNodes = 0;
     size_t countScaPos {0};
     // result block could have both vector/matrix and scalar components
     // save each scalars entity in his own array
     auto scalarPos = identifyScalarEntities(entityTypes);
+    std::vector<bool> isScalar(numComps, false);
+    for (size_t i : scalarPos) {
+        isScalar[i] = true;
+    }
+    auto addValue = [&](double value) {
+        if (countScaPos < isScalar.size() && isScalar[countScaPos]) {
+            scaValues.emplace_back(value);
+        }
+        else {
+            vecValues.emplace_back(value);
+        }
+        ++countScaPos;
+    };
     // array for vector entities (if needed)
     vtkSmartPointer<vtkDoubleArray> vecArray = vtkSmartPointer<vtkDoubleArray>::New();
     // arrays for scalar entities (if needed)
@@ -1504,64 +1559,43 @@ void readResults(std::ifstream& ifstr,
     for (int i = 0; i < vecArray->GetNumberOfComponents(); ++i) {
         vecArray->FillComponent(i, 0.0);
     }
-    //    vecArray->Fill(0.0);
     for (size_t i = 0; i < scaArrays.size(); ++i) {
         scaArrays[i]->SetNumberOfComponents(1);
         scaArrays[i]->SetNumberOfTuples(mapNodes.size());
         std::string name = entityNames[scalarPos[i]];
         scaArrays[i]->SetName(name.c_str());
-        //        scaArrays[i]->Fill(0.0);
         for (int j = 0; j < scaArrays[i]->GetNumberOfComponents(); ++j) {
             scaArrays[i]->FillComponent(j, 0.0);
         }
     }
 
-    while (countNodes < info.numNodes && std::getline(ifstr, line)) {
-        std::string_view view {line};
-        if (view.rfind(code1, 0) == 0) {
-            sub = view.substr(code1.length());
-            valueFromLine(sub.begin(), digits, node);
+    while (countNodes < info.numNodes && reader.getline(line)) {
+        if (startsWith(line, code1)) {
+            valueFromLine(line, code1.length(), digits, node);
             // clear values vector for each node result block
             vecValues.clear();
             scaValues.clear();
             countScaPos = 0;
-            try {
-                // result nodes could not exist in .frd file due to element expansion
-                // so mapNodes.at() could throw an exception
-                nodes.emplace_back(mapNodes.at(node));
-                sub = sub.substr(digits);
-                for (auto it = sub.begin(); it != sub.end(); it += 12, ++countScaPos) {
-                    valueFromLine(it, 12, value);
-                    // search if value is scalar or vector/matrix component
-                    auto pos = std::ranges::find(scalarPos, countScaPos);
-                    if (pos == scalarPos.end()) {
-                        vecValues.emplace_back(value);
-                    }
-                    else {
-                        scaValues.emplace_back(value);
-                    }
+            // result nodes could not exist in .frd file due to element expansion
+            validNode = mapNodes.find(node) != mapNodes.end();
+            if (validNode) {
+                for (pos = code1.length() + digits; pos < line.size(); pos += 12) {
+                    valueFromLine(line, pos, 12, value);
+                    addValue(value);
                 }
             }
-            catch (const std::out_of_range&) {
+            else {
                 Base::Console().Warning("Invalid node: %d\n", node);
             }
             ++countNodes;
         }
-        else if (view.rfind(code2, 0) == 0) {
-            sub = view.substr(code2.length() + digits);
-            for (auto it = sub.begin(); it != sub.end(); it += 12) {
-                valueFromLine(it, 12, value);
-                // search if value is scalar or vector/matrix component
-                auto pos = std::ranges::find(scalarPos, countScaPos);
-                if (pos == scalarPos.end()) {
-                    vecValues.emplace_back(value);
-                }
-                else {
-                    scaValues.emplace_back(value);
-                }
+        else if (startsWith(line, code2) && validNode) {
+            for (pos = code2.length() + digits; pos < line.size(); pos += 12) {
+                valueFromLine(line, pos, 12, value);
+                addValue(value);
             }
         }
-        if ((vecValues.size() + scaValues.size()) == numComps) {
+        if (validNode && (vecValues.size() + scaValues.size()) == numComps) {
             if (!vecValues.empty()) {
                 if (node == -1) {
                     throw Base::FileException("File to load not readable");
@@ -1583,13 +1617,13 @@ void readResults(std::ifstream& ifstr,
         }
     }
 
+    std::vector<vtkSmartPointer<vtkDoubleArray>> arrays;
     // add vecArray only if not all scalars
     if (numComps != scalarPos.size()) {
-        grid->GetPointData()->AddArray(vecArray);
-    }
-    for (auto& s : scaArrays) {
-        grid->GetPointData()->AddArray(s);
+        arrays.push_back(vecArray);
     }
+    arrays.insert(arrays.end(), scaArrays.begin(), scaArrays.end());
+    return arrays;
 }
 vtkSmartPointer<vtkStringArray> createTimeInfo(const std::string& type)
 {
@@ -1611,7 +1645,54 @@ vtkSmartPointer<vtkFloatArray> createTimeValue(const double& value)
     return stepValue;
 }
 
-vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::ifstream& ifstr)
+// position of a data block in the FRD file
+struct FRDBlock
+{
+    enum class Type
+    {
+        Nodes,
+        Elements,
+        Results
+    };
+    Type type;
+    // header line of the block
+    std::string_view header;
+    // offset of the first line after the header
+    size_t offset;
+};
+
+// scan the file once for the block headers, the blocks themselves are parsed later
+std::vector<FRDBlock> indexFRD(std::string_view data)
+{
+    std::vector<FRDBlock> blocks;
+    LineReader reader(data);
+    std::string_view line;
+    while (reader.getline(line)) {
+        if (startsWith(line, "    2C")) {
+            blocks.push_back({FRDBlock::Type::Nodes, line, reader.position()});
+        }
+        else if (startsWith(line, "    3C")) {
+            blocks.push_back({FRDBlock::Type::Elements, line, reader.position()});
+        }
+        else if (startsWith(line, "  100C")) {
+            blocks.push_back({FRDBlock::Type::Results, line, reader.position()});
+        }
+    }
+    return blocks;
+}
+
+// nodal result block waiting to be parsed
+struct FRDResultTask
+{
+    FRDResultInfo info;
+    size_t offset;
+    std::shared_ptr<const std::map<int, int>> mapNodes;
+    vtkSmartPointer<vtkUnstructuredGrid> grid;
+    std::vector<vtkSmartPointer<vtkDoubleArray>> arrays;
+    std::exception_ptr error;
+};
+
+vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::string_view data)
 {
     auto points = vtkSmartPointer<vtkPoints>::New();
     auto cells = vtkSmartPointer<vtkCellArray>::New();
@@ -1620,69 +1701,90 @@ vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::ifstream& ifstr)
     vtkSmartPointer<vtkMultiBlockDataSet> block;
     std::map<FRDResultInfo, vtkSmartPointer<vtkUnstructuredGrid>> grids;
     std::map<AnalysisType, vtkSmartPointer<vtkMultiBlockDataSet>> blocks;
-    std::string line;
-    std::map<int, int> mapNodes;
+    std::shared_ptr<const std::map<int, int>> mapNodes = std::make_shared<std::map<int, int>>();
     std::vector<int> cellTypes;
+    std::vector<FRDResultTask> tasks;
+
+    // Nodes and elements are read in file order as the result blocks depend on
+    // them, while the result blocks are only indexed here and parsed afterwards.
+    for (const auto& frdBlock : indexFRD(data)) {
+        LineReader reader(data, frdBlock.offset);
+        switch (frdBlock.type) {
+            case FRDBlock::Type::Nodes:
+                // read nodes block
+                mapNodes = std::make_shared<std::map<int, int>>(
+                    readNodes(reader, frdBlock.header, points));
+                break;
+            case FRDBlock::Type::Elements:
+                // read elements block
+                cellTypes = readElements(reader, frdBlock.header, *mapNodes, cells);
+                break;
+            case FRDBlock::Type::Results: {
+                // read result info block
+                FRDResultInfo info;
+                readResultInfo(frdBlock.header, info);
+                auto it = grids.find(info);
+                if (it == grids.end()) {
+                    // create TimeInfo metadata
+                    auto timeInfo = createTimeInfo(mapAnalysisTypeToStr[info.analysisType]);
+                    // search analysis type block and create it if necessary
+                    auto it2 = blocks.find(info.analysisType);
+                    if (it2 == blocks.end()) {
+                        block = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+                        block->GetFieldData()->AddArray(timeInfo);
+                        blocks[info.analysisType] = block;
+                    }
+                    else {
+                        block = it2->second;
+                    }
+                    // create unstructured grid
+                    grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+                    grid->SetPoints(points);
+                    grid->SetCells(cellTypes.data(), cells);
 
-    while (std::getline(ifstr, line)) {
-        std::string keyCode = "    2C";
-        std::string_view view = line;
+                    // create TimeValue metadata
+                    auto stepValue = createTimeValue(info.value);
 
-        if (view.rfind(keyCode, 0) == 0) {
-            // read nodes block
-            mapNodes = readNodes(ifstr, line, points);
-        }
-        keyCode = "    3C";
-        if (view.rfind(keyCode, 0) == 0) {
-            // read elements block
-            cellTypes = readElements(ifstr, line, mapNodes, cells);
-        }
-        keyCode = "    1P";
-        if (view.rfind(keyCode, 0) == 0) {
-            // read parameter
-            readParameter(ifstr, line);
-        }
-        keyCode = "  100C";
-        if (view.rfind(keyCode, 0) == 0) {
-            // read result info block
-            FRDResultInfo info;
-            readResultInfo(ifstr, line, info);
-            auto it = grids.find(info);
-            if (it == grids.end()) {
-                // create TimeInfo metadata
-                auto timeInfo = createTimeInfo(mapAnalysisTypeToStr[info.analysisType]);
-                // search analysis type block and create it if necessary
-                auto it2 = blocks.find(info.analysisType);
-                if (it2 == blocks.end()) {
-                    block = vtkSmartPointer<vtkMultiBlockDataSet>::New();
-                    block->GetFieldData()->AddArray(timeInfo);
-                    blocks[info.analysisType] = block;
+                    grid->GetFieldData()->AddArray(stepValue);
+                    grid->GetFieldData()->AddArray(timeInfo);
+
+                    grids[info] = grid;
+                    unsigned int nb = block->GetNumberOfBlocks();
+                    block->SetBlock(nb, grid);
                 }
                 else {
-                    block = it2->second;
+                    grid = (*it).second;
                 }
-                // create unstructured grid
-                grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-                grid->SetPoints(points);
-                grid->SetCells(cellTypes.data(), cells);
-
-                // create TimeValue metadata
-                auto stepValue = createTimeValue(info.value);
+                tasks.push_back({info, frdBlock.offset, mapNodes, grid, {}, nullptr});
+                break;
+            }
+        }
+    }
 
-                grid->GetFieldData()->AddArray(stepValue);
-                grid->GetFieldData()->AddArray(timeInfo);
+    // The result blocks are independent of each other, so read their entries
+    // and node results in parallel
+#pragma omp parallel for schedule(dynamic)
+    for (long i = 0; i < static_cast<long>(tasks.size()); ++i) {
+        FRDResultTask& task = tasks[i];
+        try {
+            LineReader reader(data, task.offset);
+            task.arrays = readResults(reader, *task.mapNodes, task.info);
+        }
+        catch (...) {
+            task.error = std::current_exception();
+        }
+    }
 
-                grids[info] = grid;
-                unsigned int nb = block->GetNumberOfBlocks();
-                block->SetBlock(nb, grid);
-            }
-            else {
-                grid = (*it).second;
-            }
-            // read result entries and node results
-            readResults(ifstr, line, mapNodes, info, grid);
+    // add the result arrays to the grids in file order
+    for (auto& task : tasks) {
+        if (task.error) {
+            std::rethrow_exception(task.error);
+        }
+        for (auto& array : task.arrays) {
+            task.grid->GetPointData()->AddArray(array);
         }
     }
+
     int i = 0;
 
     for (const auto& b : blocks) {
@@ -1719,9 +1821,25 @@ void FemVTKTools::frdToVTK(const char* filename, bool binary)
         throw Base::FileException("File to load not existing or not readable", filename);
     }
 
-    std::ifstream ifstr(filename, std::ios::in | std::ios::binary);
-
-    vtkSmartPointer<vtkMultiBlockDataSet> multiBlock = FRDReader::readFRD(ifstr);
+    vtkSmartPointer<vtkMultiBlockDataSet> multiBlock;
+    if (fi.size() == 0) {
+        multiBlock = FRDReader::readFRD(std::string_view());
+    }
+    else {
+        // Map the file into memory instead of streaming it line by line, so that
+        // the result blocks can be parsed in place and in parallel.
+        namespace bip = boost::interprocess;
+        try {
+            bip::file_mapping file(filename, bip::read_only);
+            bip::mapped_region region(file, bip::read_only);
+            std::string_view data(static_cast<const char*>(region.get_address()),
+                                  region.get_size());
+            multiBlock = FRDReader::readFRD(data);
+        }
+        catch (const bip::interprocess_exception& e) {
+            throw Base::FileException(e.what(), filename);
+        }
+    }
 
     std::string dir = fi.dirPath();
 
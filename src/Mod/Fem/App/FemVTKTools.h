@@ -49,6 +49,12 @@ public:
                               bool highest = true,
                               float scale = 1.0);
 
+    // get the VTK representation of a FreeCAD FEM mesh. The grid is built once, cached with the
+    // mesh until it changes and shared by all callers, so it must not be modified. Use a shallow
+    // copy to add data to it.
+    static vtkSmartPointer<vtkUnstructuredGrid> getVTKMesh(const FemMesh* mesh,
+                                                           bool highest = true);
+
     // extract data from vtkUnstructuredGrid object and fill a FreeCAD FEM result object with that
     // data (needed by readResult)
     static void importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
@@ -72,6 +78,9 @@ public:
     // write FemResult (activeObject if res= NULL) to vtkUnstructuredGrid dataset file
     static void writeResult(const char* filename, const App::DocumentObject* res = nullptr);
 
+    // convert a CalculiX .frd result file to one .vtm file per analysis type. All time steps are
+    // parsed and held in memory until they are written; FemPostPipeline then loads the whole
+    // .vtm file, there is no loading of single steps.
     static void frdToVTK(const char* filename, bool binary = true);
 };
 }  // namespace Fem
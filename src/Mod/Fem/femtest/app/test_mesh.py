@@ -193,6 +193,58 @@ class TestMeshCommon(unittest.TestCase):
         )
 
 
+    # ********************************************************************************************
+    def test_vtk_mesh_cache(self):
+        # the VTK grid of a mesh is cached with the mesh, it has to follow changes of the mesh
+        if "BUILD_FEM_VTK" not in FreeCAD.__cmake__:
+            fcc_print("FEM_VTK post processing is disabled.")
+            return
+
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_elements
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_nodes
+
+        fm = Fem.FemMesh()
+        create_nodes(fm)
+        create_elements(fm)
+        vtu_file = join(testtools.get_fem_test_tmp_dir("mesh_common_vtk_cache"), "mesh.vtu")
+
+        def check_written(mesh):
+            written = Fem.read(vtu_file)
+            self.assertEqual(written.NodeCount, mesh.NodeCount)
+            self.assertEqual(written.VolumeCount, mesh.VolumeCount)
+            return written
+
+        fm.write(vtu_file)
+        check_written(fm)
+        # writing again uses the cached grid
+        fm.write(vtu_file)
+        check_written(fm)
+
+        # new elements and nodes have to invalidate the cached grid
+        node = fm.addNode(0.0, 0.0, -100.0)
+        fm.addFace([1, 2, node])
+        fm.addEdge([1, node])
+        fm.write(vtu_file)
+        written = check_written(fm)
+        # the highest level is volumes, faces and edges are not written
+        self.assertEqual(written.FaceCount, 0)
+        self.assertEqual(written.EdgeCount, 0)
+
+        # export of all levels
+        mesh_obj = self.document.addObject("Fem::FemMeshObject", "Mesh")
+        mesh_obj.FemMesh = fm
+        prefs = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Fem/InOutVtk")
+        level = prefs.GetString("MeshExportLevel", "Highest")
+        prefs.SetString("MeshExportLevel", "All")
+        try:
+            Fem.export([mesh_obj], vtu_file)
+        finally:
+            prefs.SetString("MeshExportLevel", level)
+        written = check_written(fm)
+        self.assertEqual(written.FaceCount, fm.FaceCount)
+        self.assertEqual(written.EdgeCount, fm.EdgeCount)
+
+
 # ************************************************************************************************
 # ************************************************************************************************
 class TestMeshEleTetra10(unittest.TestCase):
@@ -607,3 +659,105 @@ class TestMeshGroups(unittest.TestCase):
                 )
             ),
         )
+
+
+# ************************************************************************************************
+def nodes_within(femmesh, shape, limit):
+    # the node search as it was done before the shape index, one distance computation per node
+    import Part
+
+    result = set()
+    for node_id, node in femmesh.Nodes.items():
+        if shape.distToShape(Part.Vertex(node))[0] < limit:
+            result.add(node_id)
+    return result
+
+
+class TestMeshNodeQueries(unittest.TestCase):
+    fcc_print("import TestMeshNodeQueries")
+
+    # ********************************************************************************************
+    def setUp(self):
+        # setUp is executed before every test
+
+        # new document
+        self.document = FreeCAD.newDocument(self.__class__.__name__)
+
+    # ********************************************************************************************
+    def tearDown(self):
+        # tearDown is executed after every test
+        FreeCAD.closeDocument(self.document.Name)
+
+    # ********************************************************************************************
+    def test_00print(self):
+        # since method name starts with 00 this will be run first
+        # this test just prints a line with stars
+
+        fcc_print(
+            "\n{0}\n{1} run FEM TestMeshNodeQueries tests {2}\n{0}".format(
+                100 * "*", 10 * "*", 52 * "*"
+            )
+        )
+
+    # ********************************************************************************************
+    def compare_nodes(self, femmesh, shape):
+        for solid in shape.Solids:
+            self.assertEqual(
+                set(femmesh.getNodesBySolid(solid)),
+                nodes_within(femmesh, solid, solid.getTolerance(1)),
+            )
+        for face in shape.Faces:
+            self.assertEqual(
+                set(femmesh.getNodesByFace(face)),
+                nodes_within(femmesh, face, face.Tolerance),
+            )
+        for edge in shape.Edges:
+            self.assertEqual(
+                set(femmesh.getNodesByEdge(edge)),
+                nodes_within(femmesh, edge, edge.Tolerance),
+            )
+
+    # ********************************************************************************************
+    def test_nodes_on_box(self):
+        """
+        Query the nodes of the cantilever mesh on the faces, edges and the solid of a box that
+        covers half of the mesh and compare them with the nodes found by the distance to the
+        exact shape.
+        """
+
+        import Part
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_nodes
+
+        fm = Fem.FemMesh()
+        create_nodes(fm)
+        box = Part.makeBox(4000, 1000, 1000)
+        self.compare_nodes(fm, box)
+        self.assertTrue(fm.getNodesByFace(box.Faces[0]))
+
+    # ********************************************************************************************
+    def test_nodes_on_cylinder(self):
+        """
+        Query the nodes of a regular grid and of points on and close to the lateral face of a
+        cylinder. The curved faces are where the tessellation differs from the exact shape.
+        """
+
+        import math
+        import Part
+
+        fm = Fem.FemMesh()
+        node_id = 0
+        for i in range(13):
+            for j in range(13):
+                for k in range(13):
+                    node_id += 1
+                    fm.addNode(-15.0 + 2.5 * i, -15.0 + 2.5 * j, -5.0 + 2.5 * k, node_id)
+        for i in range(36):
+            angle = math.radians(10 * i + 3)
+            for radius in (10.0, 10.0 + 1e-9, 10.0 + 1e-4, 10.0 - 1e-4):
+                node_id += 1
+                fm.addNode(radius * math.cos(angle), radius * math.sin(angle), 7.0, node_id)
+
+        cylinder = Part.makeCylinder(10, 20)
+        self.compare_nodes(fm, cylinder)
+        # 72 of the points close to the lateral face and 36 grid nodes at x or y = +-10
+        self.assertEqual(len(fm.getNodesByFace(cylinder.Faces[0])), 108)
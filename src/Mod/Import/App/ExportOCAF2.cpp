@@ -25,6 +25,8 @@
 #define WNT  // avoid conflict with GUID
 #endif
 #ifndef _PreComp_
+#include <cstdlib>
+#include <OSD_Parallel.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -32,6 +34,8 @@
 #include <TDF_Label.hxx>
 #include <TDF_LabelSequence.hxx>
 #include <TDataStd_Name.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_GraphNode.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
@@ -96,6 +100,10 @@ ExportOCAFOptions ExportOCAF2::customExportOptions()
         handle->GetUnsigned("DefaultShapeColor", defaultOptions.defaultColor.getPackedValue()));
     defaultOptions.defaultColor.a = 1;
 
+    handle = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Import");
+    defaultOptions.parallel = handle->GetBool("ExportParallel", defaultOptions.parallel);
+
     return defaultOptions;
 }
 
@@ -308,33 +316,102 @@ void ExportOCAF2::setupObject(TDF_Label label,
                 // continue;
             }
 
+            if (options.parallel) {
+                subShapeColors.push_back({nodeLabel, shape.getShape(), vv.first, color, colorType});
+                continue;
+            }
+
             auto subShape = shape.getSubShape(vv.first.c_str(), true);
             if (subShape.IsNull()) {
                 FC_WARN("Failed to get subshape " << vv.first);
                 continue;
             }
-
-            // The following code is copied from OCCT 7.3 and is a work around
-            // a bug in previous versions
-            Handle(XCAFDoc_ShapeMapTool) A;
-            if (!nodeLabel.FindAttribute(XCAFDoc_ShapeMapTool::GetID(), A)) {
-                TopoDS_Shape aShape = aShapeTool->GetShape(nodeLabel);
-                if (!aShape.IsNull()) {
-                    A = XCAFDoc_ShapeMapTool::Set(nodeLabel);
-                    A->SetShape(aShape);
-                }
-            }
-
-            TDF_Label subLabel = aShapeTool->AddSubShape(nodeLabel, subShape);
-            if (subLabel.IsNull()) {
+            if (!setSubShapeColor(nodeLabel, subShape, color, colorType)) {
                 FC_WARN("Failed to add subshape " << vv.first);
-                continue;
             }
-            aColorTool->SetColor(subLabel, color, colorType);
         }
     }
 }
 
+bool ExportOCAF2::setSubShapeColor(TDF_Label label,
+                                   const TopoDS_Shape& subShape,
+                                   const Quantity_ColorRGBA& color,
+                                   XCAFDoc_ColorType colorType)
+{
+    // The following code is copied from OCCT 7.3 and is a work around
+    // a bug in previous versions
+    Handle(XCAFDoc_ShapeMapTool) A;
+    if (!label.FindAttribute(XCAFDoc_ShapeMapTool::GetID(), A)) {
+        TopoDS_Shape aShape = aShapeTool->GetShape(label);
+        if (!aShape.IsNull()) {
+            A = XCAFDoc_ShapeMapTool::Set(label);
+            A->SetShape(aShape);
+        }
+    }
+
+    TDF_Label subLabel = aShapeTool->AddSubShape(label, subShape);
+    if (subLabel.IsNull()) {
+        return false;
+    }
+    aColorTool->SetColor(subLabel, color, colorType);
+    return true;
+}
+
+void ExportOCAF2::applySubShapeColors()
+{
+    if (subShapeColors.empty()) {
+        return;
+    }
+
+    // Index the faces and edges of every distinct shape concurrently, instead of searching the
+    // shape for each colored element.
+    std::unordered_map<TopoDS_Shape, std::size_t, ShapeHasher> shapeIndex;
+    std::vector<TopoDS_Shape> shapes;
+    for (const auto& it : subShapeColors) {
+        if (shapeIndex.emplace(it.shape, shapes.size()).second) {
+            shapes.push_back(it.shape);
+        }
+    }
+    std::vector<TopTools_IndexedMapOfShape> faces(shapes.size());
+    std::vector<TopTools_IndexedMapOfShape> edges(shapes.size());
+    OSD_Parallel::For(0, static_cast<int>(shapes.size()), [&](int index) {
+        TopExp::MapShapes(shapes[index], TopAbs_FACE, faces[index]);
+        TopExp::MapShapes(shapes[index], TopAbs_EDGE, edges[index]);
+    });
+
+    for (const auto& it : subShapeColors) {
+        std::size_t index = shapeIndex[it.shape];
+        const TopTools_IndexedMapOfShape* elements = nullptr;
+        const char* number = nullptr;
+        if (boost::starts_with(it.element, "Face")) {
+            elements = &faces[index];
+            number = it.element.c_str() + 4;
+        }
+        else if (boost::starts_with(it.element, "Edge")) {
+            elements = &edges[index];
+            number = it.element.c_str() + 4;
+        }
+
+        TopoDS_Shape subShape;
+        char* end = nullptr;
+        long element = number ? std::strtol(number, &end, 10) : 0;
+        if (elements && *end == '\0' && element > 0 && element <= elements->Extent()) {
+            subShape = elements->FindKey(static_cast<int>(element));
+        }
+        else {
+            subShape = Part::TopoShape(it.shape).getSubShape(it.element.c_str(), true);
+        }
+        if (subShape.IsNull()) {
+            FC_WARN("Failed to get subshape " << it.element);
+            continue;
+        }
+        if (!setSubShapeColor(it.label, subShape, it.color, it.colorType)) {
+            FC_WARN("Failed to add subshape " << it.element);
+        }
+    }
+    subShapeColors.clear();
+}
+
 void ExportOCAF2::exportObjects(std::vector<App::DocumentObject*>& objs, const char* name)
 {
     if (objs.empty()) {
@@ -343,6 +420,9 @@ void ExportOCAF2::exportObjects(std::vector<App::DocumentObject*>& objs, const c
     myObjects.clear();
     myNames.clear();
     mySetups.clear();
+    subShapeColors.clear();
+
+    FC_TIME_INIT(t);
     if (objs.size() == 1) {
         exportObject(objs.front(), nullptr, TDF_Label());
     }
@@ -365,6 +445,10 @@ void ExportOCAF2::exportObjects(std::vector<App::DocumentObject*>& objs, const c
         }
         setName(label, nullptr, name);
     }
+    FC_TIME_LOG(t, "OCAF labels");
+
+    applySubShapeColors();
+    FC_TIME_LOG(t, "OCAF element colors");
 
     if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
         Tools::dumpLabels(pDoc->Main(), aShapeTool, aColorTool);
@@ -373,6 +457,7 @@ void ExportOCAF2::exportObjects(std::vector<App::DocumentObject*>& objs, const c
     // Update is not performed automatically anymore:
     // https://tracker.dev.opencascade.org/view.php?id=28055
     aShapeTool->UpdateAssemblies();
+    FC_TIME_LOG(t, "OCAF assemblies");
 }
 
 TDF_Label ExportOCAF2::exportObject(App::DocumentObject* parentObj,
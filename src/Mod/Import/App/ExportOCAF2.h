@@ -54,6 +54,7 @@ struct ImportExport ExportOCAFOptions
     Base::Color defaultColor;
     bool exportHidden = true;
     bool keepPlacement = false;
+    bool parallel = false;
 };
 
 class ImportExport ExportOCAF2
@@ -77,6 +78,10 @@ public:
     {
         options.keepPlacement = enable;
     }
+    void setParallel(bool enable)
+    {
+        options.parallel = enable;
+    }
     void exportObjects(std::vector<App::DocumentObject*>& objs, const char* name = nullptr);
     bool canFallback(std::vector<App::DocumentObject*> objs);
 
@@ -93,8 +98,24 @@ private:
                      bool force = false);
     void setName(TDF_Label label, App::DocumentObject* obj, const char* name = nullptr);
     TDF_Label findComponent(const char* subname, TDF_Label label, TDF_LabelSequence& labels);
+    bool setSubShapeColor(TDF_Label label,
+                          const TopoDS_Shape& subShape,
+                          const Quantity_ColorRGBA& color,
+                          XCAFDoc_ColorType colorType);
+    void applySubShapeColors();
 
 private:
+    // Color of an element of a shape, which is looked up and assigned after the label tree is
+    // built in parallel mode.
+    struct SubShapeColor
+    {
+        TDF_Label label;
+        TopoDS_Shape shape;
+        std::string element;
+        Quantity_ColorRGBA color;
+        XCAFDoc_ColorType colorType;
+    };
+
     Handle(TDocStd_Document) pDoc;
     Handle(XCAFDoc_ShapeTool) aShapeTool;
     Handle(XCAFDoc_ColorTool) aColorTool;
@@ -107,6 +128,8 @@ private:
 
     std::vector<App::DocumentObject*> groupLinks;
 
+    std::vector<SubShapeColor> subShapeColors;
+
     GetShapeColorsFunc getShapeColors;
 
     ExportOCAFOptions options;
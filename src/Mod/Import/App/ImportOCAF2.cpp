@@ -25,7 +25,13 @@
 #define WNT  // avoid conflict with GUID
 #endif
 #ifndef _PreComp_
+#include <iomanip>
+#include <BRepBndLib.hxx>
+#include <BRepGProp.hxx>
+#include <Bnd_Box.hxx>
+#include <GProp_GProps.hxx>
 #include <Interface_Static.hxx>
+#include <OSD_Parallel.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -51,6 +57,7 @@
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 #include <Mod/Part/App/FeatureCompound.h>
 #include <Mod/Part/App/Interface.h>
 #include <Mod/Part/App/OCAF/ImportExportSettings.h>
@@ -104,6 +111,7 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.reduceObjects = settings.getReduceObjects();
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
+    defaultOptions.mergeDuplicates = settings.getMergeDuplicates();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
 
     auto hGrp =
@@ -165,18 +173,27 @@ std::string ImportOCAF2::getLabelName(TDF_Label label)
         return name;
     }
     if (!XCAFDoc_ShapeTool::IsReference(label)) {
-        return Tools::labelName(label);
+        return labelName(label);
     }
     if (!options.useBaseName) {
-        name = Tools::labelName(label);
+        name = labelName(label);
     }
     TDF_Label ref;
     if (name.empty() && XCAFDoc_ShapeTool::GetReferredShape(label, ref)) {
-        name = Tools::labelName(ref);
+        name = labelName(ref);
     }
     return name;
 }
 
+std::string ImportOCAF2::labelName(TDF_Label label) const
+{
+    auto it = myLabelNames.find(label);
+    if (it != myLabelNames.end()) {
+        return it->second;
+    }
+    return Tools::labelName(label);
+}
+
 void ImportOCAF2::setObjectName(Info& info, TDF_Label label)
 {
     if (!info.obj) {
@@ -276,41 +293,94 @@ ImportOCAF2::expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape
     return info.obj;
 }
 
-bool ImportOCAF2::createObject(App::Document* doc,
-                               TDF_Label label,
-                               const TopoDS_Shape& shape,
-                               Info& info,
-                               bool newDoc)
+void ImportOCAF2::prepareShapes(const TDF_LabelSequence& labels)
 {
-    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
-        FC_WARN(Tools::labelName(label) << " has empty shape");
-        return false;
+    FC_PROFILE_ZONE("ImportOCAF2::prepareShapes");
+
+    myLabelNames.clear();
+    myLabelData.clear();
+    myDuplicates.clear();
+
+    // Collect part definitions for color extraction, and definitions plus
+    // their components for name extraction.
+    std::vector<TDF_Label> shapeLabels;
+    std::vector<TDF_Label> nameLabels;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        auto label = labels.Value(i);
+        nameLabels.push_back(label);
+        if (!XCAFDoc_ShapeTool::IsAssembly(label)) {
+            shapeLabels.push_back(label);
+            continue;
+        }
+        TDF_LabelSequence components;
+        XCAFDoc_ShapeTool::GetComponents(label, components);
+        for (Standard_Integer j = 1; j <= components.Length(); j++) {
+            nameLabels.push_back(components.Value(j));
+        }
     }
 
-    getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
+    // The functors below only read from the OCAF document, so they can run
+    // concurrently. The results are merged into the lookup tables afterwards.
+    std::vector<std::string> names(nameLabels.size());
+    OSD_Parallel::For(0, static_cast<int>(nameLabels.size()), [&](int i) {
+        names[i] = Tools::labelName(nameLabels[i]);
+    });
+
+    std::vector<LabelData> data(shapeLabels.size());
+    OSD_Parallel::For(0, static_cast<int>(shapeLabels.size()), [&](int i) {
+        auto shape = XCAFDoc_ShapeTool::GetShape(shapeLabels[i]);
+        if (shape.IsNull()) {
+            return;
+        }
+        shape.Location(TopLoc_Location());
+        collectLabelData(shapeLabels[i], shape, data[i]);
+        if (options.mergeDuplicates) {
+            data[i].signature = shapeSignature(shapeLabels[i], shape, data[i]);
+        }
+    });
 
-    Part::TopoShape tshape(shape);
-    std::vector<Base::Color> faceColors;
-    std::vector<Base::Color> edgeColors;
+    for (std::size_t i = 0; i < nameLabels.size(); ++i) {
+        myLabelNames.emplace(nameLabels[i], std::move(names[i]));
+    }
 
-    TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
+    std::unordered_map<std::string, TDF_Label> signatures;
+    for (std::size_t i = 0; i < shapeLabels.size(); ++i) {
+        if (!data[i].signature.empty()) {
+            auto res = signatures.emplace(data[i].signature, shapeLabels[i]);
+            if (!res.second) {
+                myDuplicates.emplace(shapeLabels[i], res.first->second);
+            }
+        }
+        myLabelData.emplace(shapeLabels[i], std::move(data[i]));
+    }
+    if (!myDuplicates.empty()) {
+        FC_LOG("repeated part definitions: " << myDuplicates.size());
+    }
+}
+
+void ImportOCAF2::collectLabelData(TDF_Label label,
+                                   const TopoDS_Shape& shape,
+                                   LabelData& data) const
+{
+    data.shape = shape;
 
+    TDF_LabelSequence seq;
+    if (!label.IsNull() && XCAFDoc_ShapeTool::GetSubShapes(label, seq)) {
         TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
+        TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+        TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+        data.hasSubShapes = true;
+        data.faceCount = faceMap.Extent();
+        data.edgeCount = edgeMap.Extent();
 
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
         // Two passes to get sub shape colors. First pass, look for solid, and
         // second pass look for face and edges. This allows lower level
         // subshape to override color of higher level ones.
         for (int j = 0; j < 2; ++j) {
             for (int i = 1; i <= seq.Length(); ++i) {
                 TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
+                TopoDS_Shape subShape = XCAFDoc_ShapeTool::GetShape(l);
                 if (subShape.IsNull()) {
                     continue;
                 }
@@ -334,7 +404,7 @@ bool ImportOCAF2::createObject(App::Document* doc,
                 if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
                     edgeColor = Tools::convertColor(aColor);
                     foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
+                    if (j == 0 && foundFaceColor && data.faceCount > 0 && edgeColor == faceColor) {
                         // Do not set edge the same color as face
                         foundEdgeColor = false;
                     }
@@ -343,26 +413,119 @@ bool ImportOCAF2::createObject(App::Document* doc,
                 if (foundFaceColor) {
                     for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
                         int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
+                        if (idx >= 0 && idx < data.faceCount) {
+                            data.faceColors.emplace_back(idx, faceColor);
                         }
                     }
                 }
                 if (foundEdgeColor) {
                     for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
                         int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
+                        if (idx >= 0 && idx < data.edgeCount) {
+                            data.edgeColors.emplace_back(idx, edgeColor);
                         }
                     }
                 }
             }
         }
     }
+}
+
+std::string ImportOCAF2::shapeSignature(TDF_Label label,
+                                        const TopoDS_Shape& shape,
+                                        const LabelData& data) const
+{
+    // Suppliers often define the same part several times as independent
+    // products. Two definitions are considered equal if name, topology,
+    // extent, mass properties and colors all match.
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds, Standard_False);
+    if (bounds.IsVoid()) {
+        return {};
+    }
+    bounds.SetGap(0.0);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+
+    GProp_GProps surfaceProps, volumeProps;
+    BRepGProp::SurfaceProperties(shape, surfaceProps);
+    BRepGProp::VolumeProperties(shape, volumeProps);
+
+    std::ostringstream ss;
+    ss << std::setprecision(12) << Tools::labelName(label) << '|' << shape.ShapeType();
+    for (auto type : {TopAbs_SOLID, TopAbs_SHELL, TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX}) {
+        TopTools_IndexedMapOfShape map;
+        TopExp::MapShapes(shape, type, map);
+        ss << '|' << map.Extent();
+    }
+    ss << '|' << xMin << ',' << yMin << ',' << zMin << ',' << xMax << ',' << yMax << ',' << zMax
+       << '|' << surfaceProps.Mass() << '|' << volumeProps.Mass();
+
+    Quantity_ColorRGBA aColor;
+    for (auto type : {XCAFDoc_ColorGen, XCAFDoc_ColorSurf, XCAFDoc_ColorCurv}) {
+        ss << '|';
+        if (aColorTool->GetColor(label, type, aColor)) {
+            ss << Tools::convertColor(aColor).getPackedValue();
+        }
+    }
+    for (const auto& [idx, color] : data.faceColors) {
+        ss << "|f" << idx << ':' << color.getPackedValue();
+    }
+    for (const auto& [idx, color] : data.edgeColors) {
+        ss << "|e" << idx << ':' << color.getPackedValue();
+    }
+    return ss.str();
+}
+
+const ImportOCAF2::LabelData* ImportOCAF2::findLabelData(TDF_Label label,
+                                                         const TopoDS_Shape& shape) const
+{
+    auto it = myLabelData.find(label);
+    if (it == myLabelData.end() || !it->second.shape.IsEqual(shape)) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+bool ImportOCAF2::createObject(App::Document* doc,
+                               TDF_Label label,
+                               const TopoDS_Shape& shape,
+                               Info& info,
+                               bool newDoc)
+{
+    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
+        FC_WARN(Tools::labelName(label) << " has empty shape");
+        return false;
+    }
+
+    getColor(shape, info);
+    bool hasFaceColors = false;
+    bool hasEdgeColors = false;
+
+    Part::TopoShape tshape(shape);
+    std::vector<Base::Color> faceColors;
+    std::vector<Base::Color> edgeColors;
+
+    LabelData localData;
+    const LabelData* data = findLabelData(label, shape);
+    if (!data) {
+        collectLabelData(label, shape, localData);
+        data = &localData;
+    }
+    if (data->hasSubShapes) {
+        faceColors.assign(data->faceCount, info.faceColor);
+        edgeColors.assign(data->edgeCount, info.edgeColor);
+        for (const auto& [idx, color] : data->faceColors) {
+            faceColors[idx] = color;
+            hasFaceColors = true;
+            info.hasFaceColor = true;
+        }
+        for (const auto& [idx, color] : data->edgeColors) {
+            edgeColors[idx] = color;
+            hasEdgeColors = true;
+            info.hasEdgeColor = true;
+        }
+    }
 
     Part::Feature* feature;
 
@@ -510,12 +673,16 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         Tools::dumpLabels(pDoc->Main(), aShapeTool, aColorTool);
     }
 
+    FC_TIME_INIT(t);
     TDF_LabelSequence labels;
     aShapeTool->GetShapes(labels);
     Base::SequencerLauncher seq("Importing...", labels.Length());
     FC_LOG("free shape count " << labels.Length());
     sequencer = options.showProgress ? &seq : nullptr;
 
+    prepareShapes(labels);
+    FC_TIME_LOG(t, "prepare shapes");
+
     labels.Clear();
     myShapes.clear();
     myNames.clear();
@@ -543,6 +710,8 @@ App::DocumentObject* ImportOCAF2::loadShapes()
             vis.push_back(aColorTool->IsVisible(label));
         }
     }
+    FC_TIME_LOG(t, "create objects");
+
     App::DocumentObject* ret = nullptr;
     if (objs.size() == 1) {
         ret = objs.front();
@@ -574,6 +743,11 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret = feature;
         ret->recomputeFeature(true);
     }
+    FC_TIME_LOG(t, "recompute");
+
+    myLabelNames.clear();
+    myLabelData.clear();
+    myDuplicates.clear();
     sequencer = nullptr;
     return ret;
 }
@@ -662,17 +836,30 @@ App::DocumentObject* ImportOCAF2::loadShape(App::Document* doc,
         if (sequencer && !baseLabel.IsNull() && aShapeTool->IsTopLevel(baseLabel)) {
             sequencer->next(true);
         }
-        bool res;
-        if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
-            res = createObject(doc, baseLabel, baseShape, info, newDoc);
+        auto dup = myDuplicates.find(baseLabel);
+        if (dup != myDuplicates.end()) {
+            // Repeated definition of a part seen before, let the instances
+            // link to the object created for the first definition.
+            auto firstShape = aShapeTool->GetShape(dup->second).Located(TopLoc_Location());
+            if (!loadShape(doc, dup->second, firstShape, true, newDoc)) {
+                return nullptr;
+            }
+            info = myShapes.at(firstShape);
+            info.free = false;
         }
         else {
-            res = createAssembly(doc, baseLabel, baseShape, info, newDoc);
-        }
-        if (!res) {
-            return nullptr;
+            bool res;
+            if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
+                res = createObject(doc, baseLabel, baseShape, info, newDoc);
+            }
+            else {
+                res = createAssembly(doc, baseLabel, baseShape, info, newDoc);
+            }
+            if (!res) {
+                return nullptr;
+            }
+            setObjectName(info, baseLabel);
         }
-        setObjectName(info, baseLabel);
         it = myShapes.emplace(baseShape, info).first;
     }
     if (baseOnly) {
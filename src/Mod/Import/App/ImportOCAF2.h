@@ -70,6 +70,7 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool mergeDuplicates = false;
     int mode = 0;
 };
 
@@ -107,6 +108,10 @@ public:
     {
         options.expandCompound = enable;
     }
+    void setMergeDuplicates(bool enable)
+    {
+        options.mergeDuplicates = enable;
+    }
 
     enum ImportMode
     {
@@ -136,6 +141,28 @@ private:
         int free = true;
     };
 
+    // Data of a part definition label that can be gathered without touching
+    // the FreeCAD document, and therefore in parallel for all labels
+    struct LabelData
+    {
+        TopoDS_Shape shape;
+        bool hasSubShapes = false;
+        int faceCount = 0;
+        int edgeCount = 0;
+        // sub-shape colors as (index, color), later entries override earlier ones
+        std::vector<std::pair<int, Base::Color>> faceColors;
+        std::vector<std::pair<int, Base::Color>> edgeColors;
+        // geometric fingerprint used to find repeated part definitions
+        std::string signature;
+    };
+
+    void prepareShapes(const TDF_LabelSequence& labels);
+    void collectLabelData(TDF_Label label, const TopoDS_Shape& shape, LabelData& data) const;
+    std::string
+    shapeSignature(TDF_Label label, const TopoDS_Shape& shape, const LabelData& data) const;
+    const LabelData* findLabelData(TDF_Label label, const TopoDS_Shape& shape) const;
+    std::string labelName(TDF_Label label) const;
+
     App::DocumentObject* loadShape(App::Document* doc,
                                    TDF_Label label,
                                    const TopoDS_Shape& shape,
@@ -207,6 +234,9 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TDF_Label, std::string, LabelHasher> myLabelNames;
+    std::unordered_map<TDF_Label, LabelData, LabelHasher> myLabelData;
+    std::unordered_map<TDF_Label, TDF_Label, LabelHasher> myDuplicates;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
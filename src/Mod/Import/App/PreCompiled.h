@@ -57,6 +57,7 @@
 // OpenCasCade =====================================================================================
 // Base
 #include <Mod/Part/App/OpenCascadeAll.h>
+#include <OSD_Parallel.hxx>
 
 #endif  //_PreComp_
 
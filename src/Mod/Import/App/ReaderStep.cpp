@@ -32,9 +32,13 @@
 #endif
 
 #include "ReaderStep.h"
+#include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/Profiler.h>
 #include <Mod/Part/App/encodeFilename.h>
 
+FC_LOG_LEVEL_INIT("Import", true, true)
+
 using namespace Import;
 
 ReaderStep::ReaderStep(const Base::FileInfo& file)  // NOLINT
@@ -54,16 +58,29 @@ void ReaderStep::read(Handle(TDocStd_Document) hDoc)  // NOLINT
     aReader.SetNameMode(true);
     aReader.SetLayerMode(true);
     aReader.SetSHUOMode(true);
+
+    FC_TIME_INIT(t);
+    {
+        FC_PROFILE_ZONE_DETAIL("ReaderStep::parse", utf8Name.c_str());
 #if OCC_VERSION_HEX < 0x070800
-    if (aReader.ReadFile(name8bit.c_str()) != IFSelect_RetDone) {
+        if (aReader.ReadFile(name8bit.c_str()) != IFSelect_RetDone) {
 #else
-    Handle(StepData_StepModel) aStepModel = new StepData_StepModel;
-    aStepModel->InternalParameters.InitFromStatic();
-    aStepModel->SetSourceCodePage(codePage);
-    if (aReader.ReadFile(name8bit.c_str(), aStepModel->InternalParameters) != IFSelect_RetDone) {
+        Handle(StepData_StepModel) aStepModel = new StepData_StepModel;
+        aStepModel->InternalParameters.InitFromStatic();
+        aStepModel->SetSourceCodePage(codePage);
+        if (aReader.ReadFile(name8bit.c_str(), aStepModel->InternalParameters)
+            != IFSelect_RetDone) {
 #endif
-        throw Base::FileException("Cannot read STEP file", file);
+            throw Base::FileException("Cannot read STEP file", file);
+        }
     }
+    FC_TIME_LOG(t, "STEP parse");
 
-    aReader.Transfer(hDoc);
+    // The transfer also runs the shape healing of the STEP translator. It
+    // stays serial because all roots share one transient process.
+    {
+        FC_PROFILE_ZONE("ReaderStep::transfer");
+        aReader.Transfer(hDoc);
+    }
+    FC_TIME_LOG(t, "STEP transfer");
 }
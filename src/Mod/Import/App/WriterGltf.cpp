@@ -24,36 +24,154 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
-#include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <vector>
 #include <Standard_Version.hxx>
-#include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <IMeshTools_Parameters.hxx>
 #include <Message_ProgressRange.hxx>
+#include <OSD_Parallel.hxx>
 #include <RWGltf_CafWriter.hxx>
+#include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#if OCC_VERSION_HEX >= 0x070700
+#include <RWGltf_DracoParameters.hxx>
+#endif
 #endif
 
 #include "WriterGltf.h"
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
 
+namespace
+{
+bool isTessellated(const TopoDS_Shape& shape)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        if (BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Uses the deflection of the 3D view of a Part feature, relative to the size of the shape
+double meshDeflection(const TopoDS_Shape& shape, double deviation)
+{
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    bounds.SetGap(0.0);
+    Standard_Real xMin {}, yMin {}, zMin {}, xMax {}, yMax {}, zMax {};
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    double size = (xMax - xMin) + (yMax - yMin) + (zMax - zMin);
+    double deflection = size / 300.0 * deviation;  // NOLINT
+    return std::max(deflection, Precision::Confusion());
+}
+}  // namespace
+
 WriterGltf::WriterGltf(const Base::FileInfo& file)  // NOLINT
     : file {file}
 {}
 
+void WriterGltf::tessellate(Handle(TDocStd_Document) hDoc) const  // NOLINT
+{
+    // The instances of a part only refer to its label. So, meshing the shapes of the labels
+    // that are no assemblies tessellates every part once, no matter how often it's placed.
+    Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    TDF_LabelSequence labels;
+    shapeTool->GetShapes(labels);
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part");
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);  // NOLINT
+    IMeshTools_Parameters params;
+    params.Relative = Standard_False;
+    params.Angle = Base::toRadians(hGrp->GetFloat("MeshAngularDeflection", 28.65));  // NOLINT
+    params.AllowQualityDecrease = Standard_True;
+
+    // Parts that don't share any edge with another part can be meshed concurrently. The
+    // others are meshed one after the other, each of them using parallel face meshing.
+    std::vector<TopoDS_Shape> independent;
+    std::vector<TopoDS_Shape> dependent;
+    TopTools_MapOfShape usedEdges;
+    for (const TDF_Label& label : labels) {
+        if (XCAFDoc_ShapeTool::IsAssembly(label)) {
+            continue;
+        }
+        TopoDS_Shape shape = XCAFDoc_ShapeTool::GetShape(label).Located(TopLoc_Location());
+        if (shape.IsNull() || isTessellated(shape)) {
+            continue;
+        }
+
+        bool shared = false;
+        TopTools_IndexedMapOfShape edges;
+        TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+        for (int i = 1; i <= edges.Extent(); i++) {
+            if (!usedEdges.Add(edges(i).Located(TopLoc_Location()))) {
+                shared = true;
+            }
+        }
+        (shared ? dependent : independent).push_back(shape);
+    }
+
+    OSD_Parallel::For(0, static_cast<int>(independent.size()), [&](int index) {
+        IMeshTools_Parameters partParams = params;
+        partParams.Deflection = meshDeflection(independent[index], deviation);
+        partParams.InParallel = Standard_False;
+        BRepMesh_IncrementalMesh(independent[index], partParams);
+    });
+    for (const TopoDS_Shape& shape : dependent) {
+        IMeshTools_Parameters partParams = params;
+        partParams.Deflection = meshDeflection(shape, deviation);
+        partParams.InParallel = Standard_True;
+        BRepMesh_IncrementalMesh(shape, partParams);
+    }
+}
+
 void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 {
     std::string utf8Name = file.filePath();
     std::string name8bit = Part::encodeFilename(utf8Name);
 
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                             .GetUserParameter()
+                                             .GetGroup("BaseApp")
+                                             ->GetGroup("Preferences")
+                                             ->GetGroup("Mod/Import")
+                                             ->GetGroup("glTF");
+    tessellate(hDoc);
+
     TColStd_IndexedDataMapOfStringString aMetadata;
     RWGltf_CafWriter aWriter(name8bit.c_str(), file.hasExtension("glb"));
     aWriter.SetTransformationFormat(RWGltf_WriterTrsfFormat_Compact);
     // https://github.com/KhronosGroup/glTF/blob/master/specification/2.0/README.md#coordinate-system-and-units
     aWriter.ChangeCoordinateSystemConverter().SetInputLengthUnit(0.001);  // NOLINT
     aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem(RWMesh_CoordinateSystem_Zup);
+#if OCC_VERSION_HEX >= 0x070600
+    // Faces with the same style become a single primitive of the part's mesh
+    aWriter.SetMergeFaces(hGrp->GetBool("MergeFaces", true));
+#endif
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
+    // Quantized and Draco compressed buffers, OCCT must have been built with Draco
+    RWGltf_DracoParameters draco;
+    draco.DracoCompression = hGrp->GetBool("DracoCompression", false);
+    aWriter.SetCompressionParameters(draco);
 #endif
     Standard_Boolean ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
     if (!ret) {
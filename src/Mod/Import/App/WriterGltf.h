@@ -38,6 +38,9 @@ public:
 
     void write(Handle(TDocStd_Document) hDoc) const;
 
+private:
+    void tessellate(Handle(TDocStd_Document) hDoc) const;
+
 private:
     Base::FileInfo file;
 };
@@ -23,6 +23,10 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <array>
+#include <cmath>
+#include <map>
+#include <numeric>
 #include <Standard_Version.hxx>
 #if OCC_VERSION_HEX < 0x070600
 #include <BRepAdaptor_HCurve.hxx>
@@ -37,7 +41,10 @@
 #include <GeomAPI_Interpolate.hxx>
 #include <GeomAPI_PointsToBSpline.hxx>
 #include <Geom_BSplineCurve.hxx>
+#include <Geom_BezierCurve.hxx>
+#include <OSD_Parallel.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
@@ -50,6 +57,8 @@
 #include <gp_Dir.hxx>
 #include <gp_Elips.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_XYZ.hxx>
 #include <gp_Vec.hxx>
 #endif
 
@@ -94,7 +103,7 @@ bool ImpExpDxfRead::ReadEntitiesSection()
         std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>> ShapesToCombine;
         {
             ShapeSavingEntityCollector savingCollector(*this, ShapesToCombine);
-            if (!CDxfRead::ReadEntitiesSection()) {
+            if (!ReadBatchedEntities()) {
                 return false;
             }
         }
@@ -110,7 +119,7 @@ bool ImpExpDxfRead::ReadEntitiesSection()
         }
     }
     else {
-        if (!CDxfRead::ReadEntitiesSection()) {
+        if (!ReadBatchedEntities()) {
             return false;
         }
     }
@@ -122,6 +131,117 @@ bool ImpExpDxfRead::ReadEntitiesSection()
     return true;
 }
 
+bool ImpExpDxfRead::ReadBatchedEntities()
+{
+    BatchCollector = Collector;
+    PendingShapes.reserve(std::min(EntityCount(), ShapeBatchSize));
+    bool result = false;
+    try {
+        result = CDxfRead::ReadEntitiesSection();
+    }
+    catch (...) {
+        PendingShapes.clear();
+        BatchCollector = nullptr;
+        throw;
+    }
+    FlushShapes();
+    BatchCollector = nullptr;
+    return result;
+}
+
+void ImpExpDxfRead::PendingShape::Build()
+{
+    try {
+        switch (type) {
+            case Line:
+                if (!start.IsEqual(end, 0.00000001)) {
+                    // TODO: Really?? What about the people designing integrated circuits?
+                    shape = BRepBuilderAPI_MakeEdge(start, end).Edge();
+                }
+                break;
+            case Arc:
+            case Circle: {
+                gp_Dir up(0, 0, 1);
+                if (!dir) {
+                    up = -up;
+                }
+                gp_Circ circle(gp_Ax2(center, up), start.Distance(center));
+                if (circle.Radius() > 0) {
+                    shape = type == Arc ? BRepBuilderAPI_MakeEdge(circle, start, end).Edge()
+                                        : BRepBuilderAPI_MakeEdge(circle).Edge();
+                }
+                break;
+            }
+            case Point:
+                shape = BRepBuilderAPI_MakeVertex(start).Vertex();
+                break;
+        }
+    }
+    catch (const Standard_Failure&) {
+        shape.Nullify();
+    }
+}
+
+const char* ImpExpDxfRead::PendingShape::NameBase() const
+{
+    switch (type) {
+        case Line:
+            return "Line";
+        case Arc:
+            return "Arc";
+        case Circle:
+            return "Circle";
+        case Point:
+            return "Point";
+    }
+    return "Shape";
+}
+
+void ImpExpDxfRead::AddShape(PendingShape&& pending)
+{
+    if (BatchCollector != nullptr && Collector == BatchCollector) {
+        pending.attributes = m_entityAttributes;
+        PendingShapes.push_back(std::move(pending));
+        if (PendingShapes.size() >= ShapeBatchSize) {
+            FlushShapes();
+        }
+        return;
+    }
+    pending.Build();
+    DeliverShape(pending);
+}
+
+void ImpExpDxfRead::DeliverShape(const PendingShape& pending)
+{
+    if (!pending.shape.IsNull()) {
+        Collector->AddObject(pending.shape, pending.NameBase());
+    }
+    else if (pending.type == PendingShape::Arc) {
+        Base::Console().Warning("ImpExpDxf - ignore degenerate arc of circle\n");
+    }
+    else if (pending.type == PendingShape::Circle) {
+        Base::Console().Warning("ImpExpDxf - ignore degenerate circle\n");
+    }
+}
+
+void ImpExpDxfRead::FlushShapes()
+{
+    if (PendingShapes.empty()) {
+        return;
+    }
+    OSD_Parallel::For(0, static_cast<int>(PendingShapes.size()), [this](int index) {
+        PendingShapes[index].Build();
+    });
+
+    CommonEntityAttributes currentAttributes = m_entityAttributes;
+    for (const PendingShape& pending : PendingShapes) {
+        m_entityAttributes = pending.attributes;
+        DeliverShape(pending);
+    }
+    m_entityAttributes = currentAttributes;
+    PendingShapes.clear();
+}
+
 void ImpExpDxfRead::CombineShapes(std::list<TopoDS_Shape>& shapes, const char* nameBase) const
 {
     BRep_Builder builder;
@@ -170,6 +290,7 @@ void ImpExpDxfRead::setOptions()
     m_importPoints = hGrp->GetBool("dxfImportPoints", true);
     m_importPaperSpaceEntities = hGrp->GetBool("dxflayout", false);
     m_importHiddenBlocks = hGrp->GetBool("dxfstarblocks", false);
+    m_skipUnusedLayers = hGrp->GetBool("dxfSkipUnusedLayers", false);
     // TODO: There is currently no option for this: m_importFrozenLayers =
     // hGrp->GetBool("dxffrozenLayers", false);
     // TODO: There is currently no option for this: m_importHiddenLayers =
@@ -189,6 +310,9 @@ bool ImpExpDxfRead::OnReadBlock(const std::string& name, int flags)
         // and don't want to be complaining about unhandled entity types.
         // Note that if it *is* for a hatch we could actually import it and use it to draw a hatch.
     }
+    else if (!IsBlockReferenced(name)) {
+        // No INSERT refers to this block so its contents would never be expanded.
+    }
     else if (Blocks.count(name) > 0) {
         ImportError("Duplicate block name '%s'\n", name);
     }
@@ -207,19 +331,18 @@ void ImpExpDxfRead::OnReadLine(const Base::Vector3d& start,
                                const Base::Vector3d& end,
                                bool /*hidden*/)
 {
-    gp_Pnt p0 = makePoint(start);
-    gp_Pnt p1 = makePoint(end);
-    if (p0.IsEqual(p1, 0.00000001)) {
-        // TODO: Really?? What about the people designing integrated circuits?
-        return;
-    }
-    Collector->AddObject(BRepBuilderAPI_MakeEdge(p0, p1).Edge(), "Line");
+    PendingShape pending(PendingShape::Line);
+    pending.start = makePoint(start);
+    pending.end = makePoint(end);
+    AddShape(std::move(pending));
 }
 
 
 void ImpExpDxfRead::OnReadPoint(const Base::Vector3d& start)
 {
-    Collector->AddObject(BRepBuilderAPI_MakeVertex(makePoint(start)).Vertex(), "Point");
+    PendingShape pending(PendingShape::Point);
+    pending.start = makePoint(start);
+    AddShape(std::move(pending));
 }
 
 
@@ -229,20 +352,12 @@ void ImpExpDxfRead::OnReadArc(const Base::Vector3d& start,
                               bool dir,
                               bool /*hidden*/)
 {
-    gp_Pnt p0 = makePoint(start);
-    gp_Pnt p1 = makePoint(end);
-    gp_Dir up(0, 0, 1);
-    if (!dir) {
-        up = -up;
-    }
-    gp_Pnt pc = makePoint(center);
-    gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
-    if (circle.Radius() > 0) {
-        Collector->AddObject(BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge(), "Arc");
-    }
-    else {
-        Base::Console().Warning("ImpExpDxf - ignore degenerate arc of circle\n");
-    }
+    PendingShape pending(PendingShape::Arc);
+    pending.start = makePoint(start);
+    pending.end = makePoint(end);
+    pending.center = makePoint(center);
+    pending.dir = dir;
+    AddShape(std::move(pending));
 }
 
 
@@ -251,19 +366,11 @@ void ImpExpDxfRead::OnReadCircle(const Base::Vector3d& start,
                                  bool dir,
                                  bool /*hidden*/)
 {
-    gp_Pnt p0 = makePoint(start);
-    gp_Dir up(0, 0, 1);
-    if (!dir) {
-        up = -up;
-    }
-    gp_Pnt pc = makePoint(center);
-    gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
-    if (circle.Radius() > 0) {
-        Collector->AddObject(BRepBuilderAPI_MakeEdge(circle).Edge(), "Circle");
-    }
-    else {
-        Base::Console().Warning("ImpExpDxf - ignore degenerate circle\n");
-    }
+    PendingShape pending(PendingShape::Circle);
+    pending.start = makePoint(start);
+    pending.center = makePoint(center);
+    pending.dir = dir;
+    AddShape(std::move(pending));
 }
 
 
@@ -359,6 +466,7 @@ Handle(Geom_BSplineCurve) getInterpolationSpline(struct SplineData& sd)
 
 void ImpExpDxfRead::OnReadSpline(struct SplineData& sd)
 {
+    FlushShapes();
     // https://documentation.help/AutoCAD-DXF/WS1a9193826455f5ff18cb41610ec0a2e719-79e1.htm
     // Flags:
     // 1: Closed, 2: Periodic, 4: Rational, 8: Planar, 16: Linear
@@ -393,6 +501,7 @@ void ImpExpDxfRead::OnReadEllipse(const Base::Vector3d& center,
                                   bool dir)
 // NOLINTEND(bugprone-easily-swappable-parameters)
 {
+    FlushShapes();
     gp_Dir up(0, 0, 1);
     if (!dir) {
         up = -up;
@@ -416,6 +525,7 @@ void ImpExpDxfRead::OnReadText(const Base::Vector3d& point,
 {
     // Note that our parameters do not contain all the information needed to properly orient the
     // text. As a result the text will always appear on the XY plane
+    FlushShapes();
     if (m_importAnnotations) {
         auto makeText = [this, rotation, point, text, height](
                             const Base::Matrix4D& transform) -> App::FeaturePython* {
@@ -454,6 +564,7 @@ void ImpExpDxfRead::OnReadInsert(const Base::Vector3d& point,
                                  const std::string& name,
                                  double rotation)
 {
+    FlushShapes();
     Collector->AddInsert(point, scale, name, rotation);
 }
 void ImpExpDxfRead::ExpandInsert(const std::string& name,
@@ -534,6 +645,7 @@ void ImpExpDxfRead::OnReadDimension(const Base::Vector3d& start,
                                     const Base::Vector3d& point,
                                     double /*rotation*/)
 {
+    FlushShapes();
     if (m_importAnnotations) {
         auto makeDimension =
             [this, start, end, point](const Base::Matrix4D& transform) -> App::FeaturePython* {
@@ -576,6 +688,7 @@ void ImpExpDxfRead::OnReadDimension(const Base::Vector3d& start,
 }
 void ImpExpDxfRead::OnReadPolyline(std::list<VertexInfo>& vertices, int flags)
 {
+    FlushShapes();
     std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>> ShapesToCombine;
     {
         // TODO: Currently ExpandPolyline calls OnReadArc etc to generate the pieces, and these
@@ -783,87 +896,92 @@ void ImpExpDxfWrite::setOptions()
     m_version = hGrp->GetInt("DxfVersionOut", 14);
     optionPolyLine = hGrp->GetBool("DiscretizeEllipses", false);
     m_polyOverride = hGrp->GetBool("DiscretizeEllipses", false);
+    optionBlocks = hGrp->GetBool("ExportBlocks", false);
     setDataDir(App::Application::getResourceDir() + "Mod/Import/DxfPlate/");
 }
 
 void ImpExpDxfWrite::exportShape(const TopoDS_Shape input)
 {
     // export Edges
-    TopExp_Explorer edges(input, TopAbs_EDGE);
-    for (int i = 1; edges.More(); edges.Next(), i++) {
-        const TopoDS_Edge& edge = TopoDS::Edge(edges.Current());
-        BRepAdaptor_Curve adapt(edge);
-        if (adapt.GetType() == GeomAbs_Circle) {
-            double f = adapt.FirstParameter();
-            double l = adapt.LastParameter();
-            gp_Pnt start = adapt.Value(f);
-            gp_Pnt e = adapt.Value(l);
-            if (fabs(l - f) > 1.0 && start.SquareDistance(e) < 0.001) {
-                exportCircle(adapt);
-            }
-            else {
-                exportArc(adapt);
-            }
+    std::vector<TopoDS_Edge> edges;
+    for (TopExp_Explorer it(input, TopAbs_EDGE); it.More(); it.Next()) {
+        edges.push_back(TopoDS::Edge(it.Current()));
+    }
+    if (optionBlocks) {
+        exportRepeatedGeometry(edges);
+    }
+    for (const TopoDS_Edge& edge : edges) {
+        exportEdge(edge);
+    }
+
+    if (optionExpPoints) {
+        TopExp_Explorer verts(input, TopAbs_VERTEX);
+        std::vector<gp_Pnt> duplicates;
+        for (int i = 1; verts.More(); verts.Next(), i++) {
+            const TopoDS_Vertex& v = TopoDS::Vertex(verts.Current());
+            gp_Pnt p = BRep_Tool::Pnt(v);
+            duplicates.push_back(p);
         }
-        else if (adapt.GetType() == GeomAbs_Ellipse) {
-            double f = adapt.FirstParameter();
-            double l = adapt.LastParameter();
-            gp_Pnt start = adapt.Value(f);
-            gp_Pnt e = adapt.Value(l);
-            if (fabs(l - f) > 1.0 && start.SquareDistance(e) < 0.001) {
-                if (m_polyOverride) {
-                    if (m_version >= 14) {
-                        exportLWPoly(adapt);
-                    }
-                    else {  // m_version < 14
-                        exportPolyline(adapt);
-                    }
-                }
-                else if (optionPolyLine) {
-                    if (m_version >= 14) {
-                        exportLWPoly(adapt);
-                    }
-                    else {  // m_version < 14
-                        exportPolyline(adapt);
-                    }
+
+        std::sort(duplicates.begin(), duplicates.end(), ImpExpDxfWrite::gp_PntCompare);
+        auto newEnd =
+            std::unique(duplicates.begin(), duplicates.end(), ImpExpDxfWrite::gp_PntEqual);
+        std::vector<gp_Pnt> uniquePts(duplicates.begin(), newEnd);
+        for (auto& p : uniquePts) {
+            double point[3] = {0, 0, 0};
+            gPntToTuple(point, p);
+            writePoint(point);
+        }
+    }
+}
+
+void ImpExpDxfWrite::exportEdge(const TopoDS_Edge& edge)
+{
+    BRepAdaptor_Curve adapt(edge);
+    if (adapt.GetType() == GeomAbs_Circle) {
+        double f = adapt.FirstParameter();
+        double l = adapt.LastParameter();
+        gp_Pnt start = adapt.Value(f);
+        gp_Pnt e = adapt.Value(l);
+        if (fabs(l - f) > 1.0 && start.SquareDistance(e) < 0.001) {
+            exportCircle(adapt);
+        }
+        else {
+            exportArc(adapt);
+        }
+    }
+    else if (adapt.GetType() == GeomAbs_Ellipse) {
+        double f = adapt.FirstParameter();
+        double l = adapt.LastParameter();
+        gp_Pnt start = adapt.Value(f);
+        gp_Pnt e = adapt.Value(l);
+        if (fabs(l - f) > 1.0 && start.SquareDistance(e) < 0.001) {
+            if (m_polyOverride) {
+                if (m_version >= 14) {
+                    exportLWPoly(adapt);
                 }
-                else {  // no overrides, do what's right!
-                    if (m_version < 14) {
-                        exportPolyline(adapt);
-                    }
-                    else {
-                        exportEllipse(adapt);
-                    }
+                else {  // m_version < 14
+                    exportPolyline(adapt);
                 }
             }
-            else {  // it's an arc
-                if (m_polyOverride) {
-                    if (m_version >= 14) {
-                        exportLWPoly(adapt);
-                    }
-                    else {  // m_version < 14
-                        exportPolyline(adapt);
-                    }
+            else if (optionPolyLine) {
+                if (m_version >= 14) {
+                    exportLWPoly(adapt);
+                }
+                else {  // m_version < 14
+                    exportPolyline(adapt);
                 }
-                else if (optionPolyLine) {
-                    if (m_version >= 14) {
-                        exportLWPoly(adapt);
-                    }
-                    else {  // m_version < 14
-                        exportPolyline(adapt);
-                    }
+            }
+            else {  // no overrides, do what's right!
+                if (m_version < 14) {
+                    exportPolyline(adapt);
                 }
-                else {  // no overrides, do what's right!
-                    if (m_version < 14) {
-                        exportPolyline(adapt);
-                    }
-                    else {
-                        exportEllipseArc(adapt);
-                    }
+                else {
+                    exportEllipse(adapt);
                 }
             }
         }
-        else if (adapt.GetType() == GeomAbs_BSplineCurve) {
+        else {  // it's an arc
             if (m_polyOverride) {
                 if (m_version >= 14) {
                     exportLWPoly(adapt);
@@ -885,41 +1003,234 @@ void ImpExpDxfWrite::exportShape(const TopoDS_Shape input)
                     exportPolyline(adapt);
                 }
                 else {
-                    exportBSpline(adapt);
+                    exportEllipseArc(adapt);
                 }
             }
         }
-        else if (adapt.GetType() == GeomAbs_BezierCurve) {
-            exportBCurve(adapt);
+    }
+    else if (adapt.GetType() == GeomAbs_BSplineCurve) {
+        if (m_polyOverride) {
+            if (m_version >= 14) {
+                exportLWPoly(adapt);
+            }
+            else {  // m_version < 14
+                exportPolyline(adapt);
+            }
         }
-        else if (adapt.GetType() == GeomAbs_Line) {
-            exportLine(adapt);
+        else if (optionPolyLine) {
+            if (m_version >= 14) {
+                exportLWPoly(adapt);
+            }
+            else {  // m_version < 14
+                exportPolyline(adapt);
+            }
         }
-        else {
-            Base::Console().Warning("ImpExpDxf - unknown curve type: %d\n",
-                                    static_cast<int>(adapt.GetType()));
+        else {  // no overrides, do what's right!
+            if (m_version < 14) {
+                exportPolyline(adapt);
+            }
+            else {
+                exportBSpline(adapt);
+            }
         }
     }
+    else if (adapt.GetType() == GeomAbs_BezierCurve) {
+        exportBCurve(adapt);
+    }
+    else if (adapt.GetType() == GeomAbs_Line) {
+        exportLine(adapt);
+    }
+    else {
+        Base::Console().Warning("ImpExpDxf - unknown curve type: %d\n",
+                                static_cast<int>(adapt.GetType()));
+    }
+}
 
-    if (optionExpPoints) {
-        TopExp_Explorer verts(input, TopAbs_VERTEX);
-        std::vector<gp_Pnt> duplicates;
-        for (int i = 1; verts.More(); verts.Next(), i++) {
-            const TopoDS_Vertex& v = TopoDS::Vertex(verts.Current());
-            gp_Pnt p = BRep_Tool::Pnt(v);
-            duplicates.push_back(p);
+namespace
+{
+// Geometry closer than this is considered equal when looking for repeated pieces
+constexpr double RepeatTolerance = 1e-6;
+
+using PointKey = std::array<long long, 3>;
+
+PointKey makePointKey(const gp_XYZ& point)
+{
+    return {std::llround(point.X() / RepeatTolerance),
+            std::llround(point.Y() / RepeatTolerance),
+            std::llround(point.Z() / RepeatTolerance)};
+}
+
+// Describes an edge relative to origin, so that translated copies get the same description
+std::vector<long long> describeEdge(const TopoDS_Edge& edge, const gp_XYZ& origin)
+{
+    BRepAdaptor_Curve adapt(edge);
+    std::vector<long long> description {0, static_cast<long long>(adapt.GetType())};
+    auto addPoint = [&description, &origin](const gp_Pnt& point) {
+        PointKey key = makePointKey(point.XYZ() - origin);
+        description.insert(description.end(), key.begin(), key.end());
+    };
+
+    // five points fix lines, circles and ellipses, the poles are needed for free form curves
+    constexpr int samples = 4;
+    double first = adapt.FirstParameter();
+    double last = adapt.LastParameter();
+    for (int i = 0; i <= samples; i++) {
+        addPoint(adapt.Value(first + (last - first) * i / samples));
+    }
+    if (adapt.GetType() == GeomAbs_BSplineCurve) {
+        Handle(Geom_BSplineCurve) spline = adapt.BSpline();
+        for (int i = 1; i <= spline->NbPoles(); i++) {
+            addPoint(spline->Pole(i));
+        }
+    }
+    else if (adapt.GetType() == GeomAbs_BezierCurve) {
+        Handle(Geom_BezierCurve) bezier = adapt.Bezier();
+        for (int i = 1; i <= bezier->NbPoles(); i++) {
+            addPoint(bezier->Pole(i));
         }
+    }
 
-        std::sort(duplicates.begin(), duplicates.end(), ImpExpDxfWrite::gp_PntCompare);
-        auto newEnd =
-            std::unique(duplicates.begin(), duplicates.end(), ImpExpDxfWrite::gp_PntEqual);
-        std::vector<gp_Pnt> uniquePts(duplicates.begin(), newEnd);
-        for (auto& p : uniquePts) {
-            double point[3] = {0, 0, 0};
-            gPntToTuple(point, p);
-            writePoint(point);
+    // the length leads the description so that the concatenated key is unambiguous
+    description.front() = static_cast<long long>(description.size());
+    return description;
+}
+}  // namespace
+
+void ImpExpDxfWrite::exportRepeatedGeometry(std::vector<TopoDS_Edge>& edges)
+{
+    // split the edges into connected pieces, joined by their end points
+    std::vector<std::size_t> parent(edges.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto findRoot = [&parent](std::size_t index) {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+        return index;
+    };
+
+    std::map<PointKey, std::size_t> endPoints;
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        for (const TopoDS_Vertex& vertex :
+             {TopExp::FirstVertex(edges[i]), TopExp::LastVertex(edges[i])}) {
+            if (vertex.IsNull()) {
+                continue;
+            }
+            auto inserted = endPoints.emplace(makePointKey(BRep_Tool::Pnt(vertex).XYZ()), i);
+            if (!inserted.second) {
+                parent[findRoot(i)] = findRoot(inserted.first->second);
+            }
+        }
+    }
+
+    std::map<std::size_t, std::vector<std::size_t>> pieces;
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        pieces[findRoot(i)].push_back(i);
+    }
+
+    // group the pieces by their geometry relative to the lower corner of their end points
+    struct Piece
+    {
+        std::vector<std::size_t> edges;
+        gp_XYZ origin;
+    };
+    std::map<std::string, std::vector<Piece>> groups;
+    std::vector<std::string> order;
+    for (auto& [root, pieceEdges] : pieces) {
+        // A single straight line doesn't get any smaller as a block. Single curves are kept, so
+        // that e.g. a pattern of holes becomes one block of a circle and its inserts.
+        if (pieceEdges.size() < 2
+            && BRepAdaptor_Curve(edges[pieceEdges.front()]).GetType() == GeomAbs_Line) {
+            continue;
+        }
+
+        bool hasOrigin = false;
+        gp_XYZ origin;
+        for (std::size_t index : pieceEdges) {
+            for (const TopoDS_Vertex& vertex :
+                 {TopExp::FirstVertex(edges[index]), TopExp::LastVertex(edges[index])}) {
+                if (vertex.IsNull()) {
+                    continue;
+                }
+                gp_XYZ point = BRep_Tool::Pnt(vertex).XYZ();
+                if (hasOrigin) {
+                    origin.SetCoord(std::min(origin.X(), point.X()),
+                                    std::min(origin.Y(), point.Y()),
+                                    std::min(origin.Z(), point.Z()));
+                }
+                else {
+                    origin = point;
+                    hasOrigin = true;
+                }
+            }
+        }
+        if (!hasOrigin) {
+            continue;
+        }
+
+        std::vector<std::vector<long long>> descriptions;
+        descriptions.reserve(pieceEdges.size());
+        for (std::size_t index : pieceEdges) {
+            descriptions.push_back(describeEdge(edges[index], origin));
+        }
+        std::sort(descriptions.begin(), descriptions.end());
+
+        std::string key;
+        for (const auto& description : descriptions) {
+            key.append(reinterpret_cast<const char*>(description.data()),
+                       description.size() * sizeof(long long));
+        }
+
+        std::vector<Piece>& group = groups[key];
+        if (group.empty()) {
+            order.push_back(key);
+        }
+        group.push_back({std::move(pieceEdges), origin});
+    }
+
+    std::vector<bool> written(edges.size(), false);
+    for (const std::string& key : order) {
+        std::vector<Piece>& group = groups[key];
+        auto known = m_repeatedGeometry.find(key);
+        if (known == m_repeatedGeometry.end() && group.size() < 2) {
+            // seen for the first time, it becomes a block if it shows up again later
+            m_repeatedGeometry.emplace(key, std::string());
+            continue;
+        }
+
+        std::string& blockName = m_repeatedGeometry[key];
+        if (blockName.empty()) {
+            blockName = "Block" + std::to_string(++m_blockCount);
+
+            // the block holds the first piece moved to the origin
+            const Piece& first = group.front();
+            gp_Trsf toOrigin;
+            toOrigin.SetTranslation(gp_Vec(first.origin.Reversed()));
+            beginBlock(blockName);
+            for (std::size_t index : first.edges) {
+                BRepBuilderAPI_Transform mover(edges[index], toOrigin, Standard_False);
+                exportEdge(TopoDS::Edge(mover.Shape()));
+            }
+            endBlock();
+        }
+
+        for (const Piece& piece : group) {
+            double point[3] = {piece.origin.X(), piece.origin.Y(), piece.origin.Z()};
+            writeInsert(blockName, point, 0.0);
+            for (std::size_t index : piece.edges) {
+                written[index] = true;
+            }
+        }
+    }
+
+    // leave the edges that weren't written as inserts for the caller
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        if (!written[i]) {
+            edges[next++] = edges[i];
         }
     }
+    edges.resize(next);
 }
 
 bool ImpExpDxfWrite::gp_PntEqual(gp_Pnt p1, gp_Pnt p2)
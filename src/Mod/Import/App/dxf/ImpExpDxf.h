@@ -34,6 +34,7 @@
 
 
 class BRepAdaptor_Curve;
+class TopoDS_Edge;
 
 namespace Import
 {
@@ -113,6 +114,42 @@ private:
         return {point3d.x, point3d.y, point3d.z};
     }
     void MoveToLayer(App::DocumentObject* object) const;
+
+    // Lines, arcs, circles and points read from the ENTITIES section are queued and their shapes
+    // are built in parallel, one batch at a time. The shapes are then delivered to the Collector in
+    // file order together with the attributes that were current when the entity was read.
+    struct PendingShape
+    {
+        enum Type
+        {
+            Line,
+            Arc,
+            Circle,
+            Point
+        };
+        explicit PendingShape(Type type)
+            : type(type)
+        {}
+        Type type;
+        gp_Pnt start;
+        gp_Pnt end;
+        gp_Pnt center;
+        bool dir = true;
+        CDxfRead::CommonEntityAttributes attributes;
+        TopoDS_Shape shape;
+
+        // Sets shape, leaving it null if the entity is degenerate
+        void Build();
+        const char* NameBase() const;
+    };
+    static constexpr std::size_t ShapeBatchSize = 8192;
+    // Reads the ENTITIES section with the current Collector receiving batched shapes
+    bool ReadBatchedEntities();
+    void AddShape(PendingShape&& pending);
+    void DeliverShape(const PendingShape& pending);
+    // Builds and delivers all queued shapes. Must be called before anything else is passed to the
+    // Collector so the order of the objects is preserved.
+    void FlushShapes();
     // Combine all the shapes in the given shapes collection into a single shape, and AddObject that
     // to the drawing. unref's all the shapes in the collection, possibly freeing them.
     void CombineShapes(std::list<TopoDS_Shape>& shapes, const char* nameBase) const;
@@ -348,6 +385,9 @@ protected:
 
 private:
     EntityCollector* Collector = nullptr;
+    // The collector whose shapes are batched, or null if shapes are built immediately
+    EntityCollector* BatchCollector = nullptr;
+    std::vector<PendingShape> PendingShapes;
 };
 
 class ImportExport ImpExpDxfWrite: public CDxfWrite
@@ -402,6 +442,12 @@ public:
     static bool gp_PntCompare(gp_Pnt p1, gp_Pnt p2);
 
 protected:
+    void exportEdge(const TopoDS_Edge& edge);
+    // Writes connected pieces of geometry that occur more than once, also across calls of
+    // exportShape, as a block and inserts, and removes their edges from the list. Copies are
+    // found by their geometry only: pieces must be translated, not rotated or mirrored, and
+    // App::Link or TechDraw views of the same object are not recognized as such.
+    void exportRepeatedGeometry(std::vector<TopoDS_Edge>& edges);
     void exportCircle(BRepAdaptor_Curve& c);
     void exportEllipse(BRepAdaptor_Curve& c);
     void exportArc(BRepAdaptor_Curve& c);
@@ -416,6 +462,13 @@ protected:
     double optionMaxLength;
     bool optionPolyLine;
     bool optionExpPoints;
+    bool optionBlocks;
+
+private:
+    // The block made for each signature of repeated geometry, or an empty name if the geometry
+    // has been seen once so far.
+    std::map<std::string, std::string> m_repeatedGeometry;
+    int m_blockCount = 0;
 };
 
 }  // namespace Import
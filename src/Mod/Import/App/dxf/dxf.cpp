@@ -5,11 +5,16 @@
 
 #include "PreCompiled.h"
 
+#include <charconv>
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
+
+#include <QFile>
 
 #include "dxf.h"
 #include <App/Application.h>
@@ -22,6 +27,8 @@
 #include <Base/Vector3D.h>
 
 
+FC_LOG_LEVEL_INIT("Import", true, true)
+
 using namespace std;
 static Base::Vector3d MakeVector3d(const double coordinates[3])
 {
@@ -65,6 +72,9 @@ CDxfWrite::CDxfWrite(const char* filepath)
     // use lots of digits to avoid rounding errors
     m_ssEntity->setf(std::ios::fixed);
     m_ssEntity->precision(9);
+    // entities of user blocks are written to the block stream
+    m_ssBlock->setf(std::ios::fixed);
+    m_ssBlock->precision(9);
 }
 
 CDxfWrite::~CDxfWrite()
@@ -95,7 +105,7 @@ void CDxfWrite::endRun()
     writeEntitiesSection();
     writeObjectsSection();
 
-    (*m_ofs) << "  0" << endl;
+    (*m_ofs) << "  0" << '\n';
     (*m_ofs) << "EOF";
 }
 
@@ -110,8 +120,8 @@ void CDxfWrite::writeHeaderSection()
        << App::Application::Config()["BuildRevision"];
 
     // header & version
-    (*m_ofs) << "999" << endl;
-    (*m_ofs) << ss.str() << endl;
+    (*m_ofs) << "999" << '\n';
+    (*m_ofs) << ss.str() << '\n';
 
     // static header content
     ss.str("");
@@ -159,11 +169,11 @@ void CDxfWrite::writeTablesSection()
 
     if (m_version > 12) {
         (*m_ofs) << (*m_ssBlkRecord).str();
-        (*m_ofs) << "  0" << endl;
-        (*m_ofs) << "ENDTAB" << endl;
+        (*m_ofs) << "  0" << '\n';
+        (*m_ofs) << "ENDTAB" << '\n';
     }
-    (*m_ofs) << "  0" << endl;
-    (*m_ofs) << "ENDSEC" << endl;
+    (*m_ofs) << "  0" << '\n';
+    (*m_ofs) << "ENDSEC" << '\n';
 }
 
 //***************************
@@ -172,66 +182,66 @@ void CDxfWrite::writeTablesSection()
 void CDxfWrite::makeLayerTable()
 {
     std::string tablehash = getLayerHandle();
-    (*m_ssLayer) << "  0" << endl;
-    (*m_ssLayer) << "TABLE" << endl;
-    (*m_ssLayer) << "  2" << endl;
-    (*m_ssLayer) << "LAYER" << endl;
-    (*m_ssLayer) << "  5" << endl;
-    (*m_ssLayer) << tablehash << endl;
+    (*m_ssLayer) << "  0" << '\n';
+    (*m_ssLayer) << "TABLE" << '\n';
+    (*m_ssLayer) << "  2" << '\n';
+    (*m_ssLayer) << "LAYER" << '\n';
+    (*m_ssLayer) << "  5" << '\n';
+    (*m_ssLayer) << tablehash << '\n';
     if (m_version > 12) {
-        (*m_ssLayer) << "330" << endl;
-        (*m_ssLayer) << 0 << endl;
-        (*m_ssLayer) << "100" << endl;
-        (*m_ssLayer) << "AcDbSymbolTable" << endl;
-    }
-    (*m_ssLayer) << " 70" << endl;
-    (*m_ssLayer) << m_layerList.size() + 1 << endl;
-
-    (*m_ssLayer) << "  0" << endl;
-    (*m_ssLayer) << "LAYER" << endl;
-    (*m_ssLayer) << "  5" << endl;
-    (*m_ssLayer) << getLayerHandle() << endl;
+        (*m_ssLayer) << "330" << '\n';
+        (*m_ssLayer) << 0 << '\n';
+        (*m_ssLayer) << "100" << '\n';
+        (*m_ssLayer) << "AcDbSymbolTable" << '\n';
+    }
+    (*m_ssLayer) << " 70" << '\n';
+    (*m_ssLayer) << m_layerList.size() + 1 << '\n';
+
+    (*m_ssLayer) << "  0" << '\n';
+    (*m_ssLayer) << "LAYER" << '\n';
+    (*m_ssLayer) << "  5" << '\n';
+    (*m_ssLayer) << getLayerHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssLayer) << "330" << endl;
-        (*m_ssLayer) << tablehash << endl;
-        (*m_ssLayer) << "100" << endl;
-        (*m_ssLayer) << "AcDbSymbolTableRecord" << endl;
-        (*m_ssLayer) << "100" << endl;
-        (*m_ssLayer) << "AcDbLayerTableRecord" << endl;
-    }
-    (*m_ssLayer) << "  2" << endl;
-    (*m_ssLayer) << "0" << endl;
-    (*m_ssLayer) << " 70" << endl;
-    (*m_ssLayer) << "   0" << endl;
-    (*m_ssLayer) << " 62" << endl;
-    (*m_ssLayer) << "   7" << endl;
-    (*m_ssLayer) << "  6" << endl;
-    (*m_ssLayer) << "CONTINUOUS" << endl;
+        (*m_ssLayer) << "330" << '\n';
+        (*m_ssLayer) << tablehash << '\n';
+        (*m_ssLayer) << "100" << '\n';
+        (*m_ssLayer) << "AcDbSymbolTableRecord" << '\n';
+        (*m_ssLayer) << "100" << '\n';
+        (*m_ssLayer) << "AcDbLayerTableRecord" << '\n';
+    }
+    (*m_ssLayer) << "  2" << '\n';
+    (*m_ssLayer) << "0" << '\n';
+    (*m_ssLayer) << " 70" << '\n';
+    (*m_ssLayer) << "   0" << '\n';
+    (*m_ssLayer) << " 62" << '\n';
+    (*m_ssLayer) << "   7" << '\n';
+    (*m_ssLayer) << "  6" << '\n';
+    (*m_ssLayer) << "CONTINUOUS" << '\n';
 
     for (auto& l : m_layerList) {
-        (*m_ssLayer) << "  0" << endl;
-        (*m_ssLayer) << "LAYER" << endl;
-        (*m_ssLayer) << "  5" << endl;
-        (*m_ssLayer) << getLayerHandle() << endl;
+        (*m_ssLayer) << "  0" << '\n';
+        (*m_ssLayer) << "LAYER" << '\n';
+        (*m_ssLayer) << "  5" << '\n';
+        (*m_ssLayer) << getLayerHandle() << '\n';
         if (m_version > 12) {
-            (*m_ssLayer) << "330" << endl;
-            (*m_ssLayer) << tablehash << endl;
-            (*m_ssLayer) << "100" << endl;
-            (*m_ssLayer) << "AcDbSymbolTableRecord" << endl;
-            (*m_ssLayer) << "100" << endl;
-            (*m_ssLayer) << "AcDbLayerTableRecord" << endl;
+            (*m_ssLayer) << "330" << '\n';
+            (*m_ssLayer) << tablehash << '\n';
+            (*m_ssLayer) << "100" << '\n';
+            (*m_ssLayer) << "AcDbSymbolTableRecord" << '\n';
+            (*m_ssLayer) << "100" << '\n';
+            (*m_ssLayer) << "AcDbLayerTableRecord" << '\n';
         }
-        (*m_ssLayer) << "  2" << endl;
-        (*m_ssLayer) << l << endl;
-        (*m_ssLayer) << " 70" << endl;
-        (*m_ssLayer) << "    0" << endl;
-        (*m_ssLayer) << " 62" << endl;
-        (*m_ssLayer) << "    7" << endl;
-        (*m_ssLayer) << "  6" << endl;
-        (*m_ssLayer) << "CONTINUOUS" << endl;
+        (*m_ssLayer) << "  2" << '\n';
+        (*m_ssLayer) << l << '\n';
+        (*m_ssLayer) << " 70" << '\n';
+        (*m_ssLayer) << "    0" << '\n';
+        (*m_ssLayer) << " 62" << '\n';
+        (*m_ssLayer) << "    7" << '\n';
+        (*m_ssLayer) << "  6" << '\n';
+        (*m_ssLayer) << "CONTINUOUS" << '\n';
     }
-    (*m_ssLayer) << "  0" << endl;
-    (*m_ssLayer) << "ENDTAB" << endl;
+    (*m_ssLayer) << "  0" << '\n';
+    (*m_ssLayer) << "ENDTAB" << '\n';
 }
 
 //***************************
@@ -244,48 +254,48 @@ void CDxfWrite::makeBlockRecordTableHead()
     }
     std::string tablehash = getBlkRecordHandle();
     m_saveBlockRecordTableHandle = tablehash;
-    (*m_ssBlkRecord) << "  0" << endl;
-    (*m_ssBlkRecord) << "TABLE" << endl;
-    (*m_ssBlkRecord) << "  2" << endl;
-    (*m_ssBlkRecord) << "BLOCK_RECORD" << endl;
-    (*m_ssBlkRecord) << "  5" << endl;
-    (*m_ssBlkRecord) << tablehash << endl;
-    (*m_ssBlkRecord) << "330" << endl;
-    (*m_ssBlkRecord) << "0" << endl;
-    (*m_ssBlkRecord) << "100" << endl;
-    (*m_ssBlkRecord) << "AcDbSymbolTable" << endl;
-    (*m_ssBlkRecord) << "  70" << endl;
-    (*m_ssBlkRecord) << (m_blockList.size() + 5) << endl;
+    (*m_ssBlkRecord) << "  0" << '\n';
+    (*m_ssBlkRecord) << "TABLE" << '\n';
+    (*m_ssBlkRecord) << "  2" << '\n';
+    (*m_ssBlkRecord) << "BLOCK_RECORD" << '\n';
+    (*m_ssBlkRecord) << "  5" << '\n';
+    (*m_ssBlkRecord) << tablehash << '\n';
+    (*m_ssBlkRecord) << "330" << '\n';
+    (*m_ssBlkRecord) << "0" << '\n';
+    (*m_ssBlkRecord) << "100" << '\n';
+    (*m_ssBlkRecord) << "AcDbSymbolTable" << '\n';
+    (*m_ssBlkRecord) << "  70" << '\n';
+    (*m_ssBlkRecord) << (m_blockList.size() + 5) << '\n';
 
     m_saveModelSpaceHandle = getBlkRecordHandle();
-    (*m_ssBlkRecord) << "  0" << endl;
-    (*m_ssBlkRecord) << "BLOCK_RECORD" << endl;
-    (*m_ssBlkRecord) << "  5" << endl;
-    (*m_ssBlkRecord) << m_saveModelSpaceHandle << endl;
-    (*m_ssBlkRecord) << "330" << endl;
-    (*m_ssBlkRecord) << tablehash << endl;
-    (*m_ssBlkRecord) << "100" << endl;
-    (*m_ssBlkRecord) << "AcDbSymbolTableRecord" << endl;
-    (*m_ssBlkRecord) << "100" << endl;
-    (*m_ssBlkRecord) << "AcDbBlockTableRecord" << endl;
-    (*m_ssBlkRecord) << "  2" << endl;
-    (*m_ssBlkRecord) << "*MODEL_SPACE" << endl;
+    (*m_ssBlkRecord) << "  0" << '\n';
+    (*m_ssBlkRecord) << "BLOCK_RECORD" << '\n';
+    (*m_ssBlkRecord) << "  5" << '\n';
+    (*m_ssBlkRecord) << m_saveModelSpaceHandle << '\n';
+    (*m_ssBlkRecord) << "330" << '\n';
+    (*m_ssBlkRecord) << tablehash << '\n';
+    (*m_ssBlkRecord) << "100" << '\n';
+    (*m_ssBlkRecord) << "AcDbSymbolTableRecord" << '\n';
+    (*m_ssBlkRecord) << "100" << '\n';
+    (*m_ssBlkRecord) << "AcDbBlockTableRecord" << '\n';
+    (*m_ssBlkRecord) << "  2" << '\n';
+    (*m_ssBlkRecord) << "*MODEL_SPACE" << '\n';
     //        (*m_ssBlkRecord) << "  1"      << endl;
     //        (*m_ssBlkRecord) << " "        << endl;
 
     m_savePaperSpaceHandle = getBlkRecordHandle();
-    (*m_ssBlkRecord) << "  0" << endl;
-    (*m_ssBlkRecord) << "BLOCK_RECORD" << endl;
-    (*m_ssBlkRecord) << "  5" << endl;
-    (*m_ssBlkRecord) << m_savePaperSpaceHandle << endl;
-    (*m_ssBlkRecord) << "330" << endl;
-    (*m_ssBlkRecord) << tablehash << endl;
-    (*m_ssBlkRecord) << "100" << endl;
-    (*m_ssBlkRecord) << "AcDbSymbolTableRecord" << endl;
-    (*m_ssBlkRecord) << "100" << endl;
-    (*m_ssBlkRecord) << "AcDbBlockTableRecord" << endl;
-    (*m_ssBlkRecord) << "  2" << endl;
-    (*m_ssBlkRecord) << "*PAPER_SPACE" << endl;
+    (*m_ssBlkRecord) << "  0" << '\n';
+    (*m_ssBlkRecord) << "BLOCK_RECORD" << '\n';
+    (*m_ssBlkRecord) << "  5" << '\n';
+    (*m_ssBlkRecord) << m_savePaperSpaceHandle << '\n';
+    (*m_ssBlkRecord) << "330" << '\n';
+    (*m_ssBlkRecord) << tablehash << '\n';
+    (*m_ssBlkRecord) << "100" << '\n';
+    (*m_ssBlkRecord) << "AcDbSymbolTableRecord" << '\n';
+    (*m_ssBlkRecord) << "100" << '\n';
+    (*m_ssBlkRecord) << "AcDbBlockTableRecord" << '\n';
+    (*m_ssBlkRecord) << "  2" << '\n';
+    (*m_ssBlkRecord) << "*PAPER_SPACE" << '\n';
     //        (*m_ssBlkRecord) << "  1"      << endl;
     //        (*m_ssBlkRecord) << " "        << endl;
 }
@@ -301,18 +311,18 @@ void CDxfWrite::makeBlockRecordTableBody()
 
     int iBlkRecord = 0;
     for (auto& b : m_blockList) {
-        (*m_ssBlkRecord) << "  0" << endl;
-        (*m_ssBlkRecord) << "BLOCK_RECORD" << endl;
-        (*m_ssBlkRecord) << "  5" << endl;
-        (*m_ssBlkRecord) << m_blkRecordList.at(iBlkRecord) << endl;
-        (*m_ssBlkRecord) << "330" << endl;
-        (*m_ssBlkRecord) << m_saveBlockRecordTableHandle << endl;
-        (*m_ssBlkRecord) << "100" << endl;
-        (*m_ssBlkRecord) << "AcDbSymbolTableRecord" << endl;
-        (*m_ssBlkRecord) << "100" << endl;
-        (*m_ssBlkRecord) << "AcDbBlockTableRecord" << endl;
-        (*m_ssBlkRecord) << "  2" << endl;
-        (*m_ssBlkRecord) << b << endl;
+        (*m_ssBlkRecord) << "  0" << '\n';
+        (*m_ssBlkRecord) << "BLOCK_RECORD" << '\n';
+        (*m_ssBlkRecord) << "  5" << '\n';
+        (*m_ssBlkRecord) << m_blkRecordList.at(iBlkRecord) << '\n';
+        (*m_ssBlkRecord) << "330" << '\n';
+        (*m_ssBlkRecord) << m_saveBlockRecordTableHandle << '\n';
+        (*m_ssBlkRecord) << "100" << '\n';
+        (*m_ssBlkRecord) << "AcDbSymbolTableRecord" << '\n';
+        (*m_ssBlkRecord) << "100" << '\n';
+        (*m_ssBlkRecord) << "AcDbBlockTableRecord" << '\n';
+        (*m_ssBlkRecord) << "  2" << '\n';
+        (*m_ssBlkRecord) << b << '\n';
         //        (*m_ssBlkRecord) << " 70"      << endl;
         //        (*m_ssBlkRecord) << "    0"      << endl;
         iBlkRecord++;
@@ -324,108 +334,108 @@ void CDxfWrite::makeBlockRecordTableBody()
 // added by Wandererfan 2018 (wandererfan@gmail.com) for FreeCAD project
 void CDxfWrite::makeBlockSectionHead()
 {
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "SECTION" << endl;
-    (*m_ssBlock) << "  2" << endl;
-    (*m_ssBlock) << "BLOCKS" << endl;
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "BLOCK" << endl;
-    (*m_ssBlock) << "  5" << endl;
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "SECTION" << '\n';
+    (*m_ssBlock) << "  2" << '\n';
+    (*m_ssBlock) << "BLOCKS" << '\n';
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "BLOCK" << '\n';
+    (*m_ssBlock) << "  5" << '\n';
     m_currentBlock = getBlockHandle();
-    (*m_ssBlock) << m_currentBlock << endl;
+    (*m_ssBlock) << m_currentBlock << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "330" << endl;
-        (*m_ssBlock) << m_saveModelSpaceHandle << endl;
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbEntity" << endl;
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_saveModelSpaceHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
     }
-    (*m_ssBlock) << "  8" << endl;
-    (*m_ssBlock) << "0" << endl;
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << "0" << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbBlockBegin" << endl;
-    }
-    (*m_ssBlock) << "  2" << endl;
-    (*m_ssBlock) << "*MODEL_SPACE" << endl;
-    (*m_ssBlock) << " 70" << endl;
-    (*m_ssBlock) << "   0" << endl;
-    (*m_ssBlock) << " 10" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << " 20" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << " 30" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << "  3" << endl;
-    (*m_ssBlock) << "*MODEL_SPACE" << endl;
-    (*m_ssBlock) << "  1" << endl;
-    (*m_ssBlock) << " " << endl;
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "ENDBLK" << endl;
-    (*m_ssBlock) << "  5" << endl;
-    (*m_ssBlock) << getBlockHandle() << endl;
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbBlockBegin" << '\n';
+    }
+    (*m_ssBlock) << "  2" << '\n';
+    (*m_ssBlock) << "*MODEL_SPACE" << '\n';
+    (*m_ssBlock) << " 70" << '\n';
+    (*m_ssBlock) << "   0" << '\n';
+    (*m_ssBlock) << " 10" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 20" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 30" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << "  3" << '\n';
+    (*m_ssBlock) << "*MODEL_SPACE" << '\n';
+    (*m_ssBlock) << "  1" << '\n';
+    (*m_ssBlock) << " " << '\n';
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "ENDBLK" << '\n';
+    (*m_ssBlock) << "  5" << '\n';
+    (*m_ssBlock) << getBlockHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "330" << endl;
-        (*m_ssBlock) << m_saveModelSpaceHandle << endl;
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbEntity" << endl;
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_saveModelSpaceHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
     }
-    (*m_ssBlock) << "  8" << endl;
-    (*m_ssBlock) << "0" << endl;
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << "0" << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbBlockEnd" << endl;
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbBlockEnd" << '\n';
     }
 
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "BLOCK" << endl;
-    (*m_ssBlock) << "  5" << endl;
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "BLOCK" << '\n';
+    (*m_ssBlock) << "  5" << '\n';
     m_currentBlock = getBlockHandle();
-    (*m_ssBlock) << m_currentBlock << endl;
+    (*m_ssBlock) << m_currentBlock << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "330" << endl;
-        (*m_ssBlock) << m_savePaperSpaceHandle << endl;
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbEntity" << endl;
-        (*m_ssBlock) << " 67" << endl;
-        (*m_ssBlock) << "1" << endl;
-    }
-    (*m_ssBlock) << "  8" << endl;
-    (*m_ssBlock) << "0" << endl;
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_savePaperSpaceHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
+        (*m_ssBlock) << " 67" << '\n';
+        (*m_ssBlock) << "1" << '\n';
+    }
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << "0" << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbBlockBegin" << endl;
-    }
-    (*m_ssBlock) << "  2" << endl;
-    (*m_ssBlock) << "*PAPER_SPACE" << endl;
-    (*m_ssBlock) << " 70" << endl;
-    (*m_ssBlock) << "   0" << endl;
-    (*m_ssBlock) << " 10" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << " 20" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << " 30" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << "  3" << endl;
-    (*m_ssBlock) << "*PAPER_SPACE" << endl;
-    (*m_ssBlock) << "  1" << endl;
-    (*m_ssBlock) << " " << endl;
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "ENDBLK" << endl;
-    (*m_ssBlock) << "  5" << endl;
-    (*m_ssBlock) << getBlockHandle() << endl;
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbBlockBegin" << '\n';
+    }
+    (*m_ssBlock) << "  2" << '\n';
+    (*m_ssBlock) << "*PAPER_SPACE" << '\n';
+    (*m_ssBlock) << " 70" << '\n';
+    (*m_ssBlock) << "   0" << '\n';
+    (*m_ssBlock) << " 10" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 20" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 30" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << "  3" << '\n';
+    (*m_ssBlock) << "*PAPER_SPACE" << '\n';
+    (*m_ssBlock) << "  1" << '\n';
+    (*m_ssBlock) << " " << '\n';
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "ENDBLK" << '\n';
+    (*m_ssBlock) << "  5" << '\n';
+    (*m_ssBlock) << getBlockHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "330" << endl;
-        (*m_ssBlock) << m_savePaperSpaceHandle << endl;
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbEntity" << endl;
-        (*m_ssBlock) << " 67" << endl;  // paper_space flag
-        (*m_ssBlock) << "    1" << endl;
-    }
-    (*m_ssBlock) << "  8" << endl;
-    (*m_ssBlock) << "0" << endl;
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_savePaperSpaceHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
+        (*m_ssBlock) << " 67" << '\n';  // paper_space flag
+        (*m_ssBlock) << "    1" << '\n';
+    }
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << "0" << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbBlockEnd" << endl;
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbBlockEnd" << '\n';
     }
 }
 
@@ -526,34 +536,34 @@ void CDxfWrite::putLine(const Base::Vector3d& start,
                         const std::string& handle,
                         const std::string& ownerHandle)
 {
-    (*outStream) << "  0" << endl;
-    (*outStream) << "LINE" << endl;
-    (*outStream) << "  5" << endl;
-    (*outStream) << handle << endl;
+    (*outStream) << "  0" << '\n';
+    (*outStream) << "LINE" << '\n';
+    (*outStream) << "  5" << '\n';
+    (*outStream) << handle << '\n';
     if (m_version > 12) {
-        (*outStream) << "330" << endl;
-        (*outStream) << ownerHandle << endl;
-        (*outStream) << "100" << endl;
-        (*outStream) << "AcDbEntity" << endl;
+        (*outStream) << "330" << '\n';
+        (*outStream) << ownerHandle << '\n';
+        (*outStream) << "100" << '\n';
+        (*outStream) << "AcDbEntity" << '\n';
     }
-    (*outStream) << "  8" << endl;           // Group code for layer name
-    (*outStream) << getLayerName() << endl;  // Layer number
+    (*outStream) << "  8" << '\n';           // Group code for layer name
+    (*outStream) << getLayerName() << '\n';  // Layer number
     if (m_version > 12) {
-        (*outStream) << "100" << endl;
-        (*outStream) << "AcDbLine" << endl;
+        (*outStream) << "100" << '\n';
+        (*outStream) << "AcDbLine" << '\n';
     }
-    (*outStream) << " 10" << endl;    // Start point of line
-    (*outStream) << start.x << endl;  // X in WCS coordinates
-    (*outStream) << " 20" << endl;
-    (*outStream) << start.y << endl;  // Y in WCS coordinates
-    (*outStream) << " 30" << endl;
-    (*outStream) << start.z << endl;  // Z in WCS coordinates
-    (*outStream) << " 11" << endl;    // End point of line
-    (*outStream) << end.x << endl;    // X in WCS coordinates
-    (*outStream) << " 21" << endl;
-    (*outStream) << end.y << endl;  // Y in WCS coordinates
-    (*outStream) << " 31" << endl;
-    (*outStream) << end.z << endl;  // Z in WCS coordinates
+    (*outStream) << " 10" << '\n';    // Start point of line
+    (*outStream) << start.x << '\n';  // X in WCS coordinates
+    (*outStream) << " 20" << '\n';
+    (*outStream) << start.y << '\n';  // Y in WCS coordinates
+    (*outStream) << " 30" << '\n';
+    (*outStream) << start.z << '\n';  // Z in WCS coordinates
+    (*outStream) << " 11" << '\n';    // End point of line
+    (*outStream) << end.x << '\n';    // X in WCS coordinates
+    (*outStream) << " 21" << '\n';
+    (*outStream) << end.y << '\n';  // Y in WCS coordinates
+    (*outStream) << " 31" << '\n';
+    (*outStream) << end.z << '\n';  // Z in WCS coordinates
 }
 
 
@@ -562,50 +572,50 @@ void CDxfWrite::putLine(const Base::Vector3d& start,
 // added by Wandererfan 2018 (wandererfan@gmail.com) for FreeCAD project
 void CDxfWrite::writeLWPolyLine(const LWPolyDataOut& pd)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "LWPOLYLINE" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "LWPOLYLINE" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;  // 100 groups are not part of R12
-        (*m_ssEntity) << "AcDbPolyline" << endl;
-    }
-    (*m_ssEntity) << "  8" << endl;           // Group code for layer name
-    (*m_ssEntity) << getLayerName() << endl;  // Layer name
-    (*m_ssEntity) << " 90" << endl;
-    (*m_ssEntity) << pd.nVert << endl;  // number of vertices
-    (*m_ssEntity) << " 70" << endl;
-    (*m_ssEntity) << pd.Flag << endl;
-    (*m_ssEntity) << " 43" << endl;
-    (*m_ssEntity) << "0" << endl;  // Constant width opt
+        (*m_ssEntity) << "100" << '\n';  // 100 groups are not part of R12
+        (*m_ssEntity) << "AcDbPolyline" << '\n';
+    }
+    (*m_ssEntity) << "  8" << '\n';           // Group code for layer name
+    (*m_ssEntity) << getLayerName() << '\n';  // Layer name
+    (*m_ssEntity) << " 90" << '\n';
+    (*m_ssEntity) << pd.nVert << '\n';  // number of vertices
+    (*m_ssEntity) << " 70" << '\n';
+    (*m_ssEntity) << pd.Flag << '\n';
+    (*m_ssEntity) << " 43" << '\n';
+    (*m_ssEntity) << "0" << '\n';  // Constant width opt
     //    (*m_ssEntity) << pd.Width         << endl;    //Constant width opt
     //    (*m_ssEntity) << " 38"            << endl;
     //    (*m_ssEntity) << pd.Elev          << endl;    // Elevation
     //    (*m_ssEntity) << " 39"            << endl;
     //    (*m_ssEntity) << pd.Thick         << endl;    // Thickness
     for (auto& p : pd.Verts) {
-        (*m_ssEntity) << " 10" << endl;  // Vertices
-        (*m_ssEntity) << p.x << endl;
-        (*m_ssEntity) << " 20" << endl;
-        (*m_ssEntity) << p.y << endl;
+        (*m_ssEntity) << " 10" << '\n';  // Vertices
+        (*m_ssEntity) << p.x << '\n';
+        (*m_ssEntity) << " 20" << '\n';
+        (*m_ssEntity) << p.y << '\n';
     }
     for (auto& s : pd.StartWidth) {
-        (*m_ssEntity) << " 40" << endl;
-        (*m_ssEntity) << s << endl;  // Start Width
+        (*m_ssEntity) << " 40" << '\n';
+        (*m_ssEntity) << s << '\n';  // Start Width
     }
     for (auto& e : pd.EndWidth) {
-        (*m_ssEntity) << " 41" << endl;
-        (*m_ssEntity) << e << endl;  // End Width
+        (*m_ssEntity) << " 41" << '\n';
+        (*m_ssEntity) << e << '\n';  // End Width
     }
     for (auto& b : pd.Bulge) {  // Bulge
-        (*m_ssEntity) << " 42" << endl;
-        (*m_ssEntity) << b << endl;
+        (*m_ssEntity) << " 42" << '\n';
+        (*m_ssEntity) << b << '\n';
     }
     //    (*m_ssEntity) << "210"            << endl;    //Extrusion dir
     //    (*m_ssEntity) << pd.Extr.x        << endl;
@@ -620,78 +630,78 @@ void CDxfWrite::writeLWPolyLine(const LWPolyDataOut& pd)
 // added by Wandererfan 2018 (wandererfan@gmail.com) for FreeCAD project
 void CDxfWrite::writePolyline(const LWPolyDataOut& pd)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "POLYLINE" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "POLYLINE" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;
-    (*m_ssEntity) << getLayerName() << endl;  // Layer name
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';  // Layer name
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;  // 100 groups are not part of R12
-        (*m_ssEntity) << "AcDbPolyline" << endl;
-    }
-    (*m_ssEntity) << " 66" << endl;
-    (*m_ssEntity) << "     1" << endl;  // vertices follow
-    (*m_ssEntity) << " 10" << endl;
-    (*m_ssEntity) << "0.0" << endl;
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << "0.0" << endl;
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << "0.0" << endl;
-    (*m_ssEntity) << " 70" << endl;
-    (*m_ssEntity) << "0" << endl;
+        (*m_ssEntity) << "100" << '\n';  // 100 groups are not part of R12
+        (*m_ssEntity) << "AcDbPolyline" << '\n';
+    }
+    (*m_ssEntity) << " 66" << '\n';
+    (*m_ssEntity) << "     1" << '\n';  // vertices follow
+    (*m_ssEntity) << " 10" << '\n';
+    (*m_ssEntity) << "0.0" << '\n';
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << "0.0" << '\n';
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << "0.0" << '\n';
+    (*m_ssEntity) << " 70" << '\n';
+    (*m_ssEntity) << "0" << '\n';
     for (auto& p : pd.Verts) {
-        (*m_ssEntity) << "  0" << endl;
-        (*m_ssEntity) << "VERTEX" << endl;
-        (*m_ssEntity) << "  5" << endl;
-        (*m_ssEntity) << getEntityHandle() << endl;
-        (*m_ssEntity) << "  8" << endl;
-        (*m_ssEntity) << getLayerName() << endl;
-        (*m_ssEntity) << " 10" << endl;
-        (*m_ssEntity) << p.x << endl;
-        (*m_ssEntity) << " 20" << endl;
-        (*m_ssEntity) << p.y << endl;
-        (*m_ssEntity) << " 30" << endl;
-        (*m_ssEntity) << p.z << endl;
-    }
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "SEQEND" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
-    (*m_ssEntity) << "  8" << endl;
-    (*m_ssEntity) << getLayerName() << endl;
+        (*m_ssEntity) << "  0" << '\n';
+        (*m_ssEntity) << "VERTEX" << '\n';
+        (*m_ssEntity) << "  5" << '\n';
+        (*m_ssEntity) << getEntityHandle() << '\n';
+        (*m_ssEntity) << "  8" << '\n';
+        (*m_ssEntity) << getLayerName() << '\n';
+        (*m_ssEntity) << " 10" << '\n';
+        (*m_ssEntity) << p.x << '\n';
+        (*m_ssEntity) << " 20" << '\n';
+        (*m_ssEntity) << p.y << '\n';
+        (*m_ssEntity) << " 30" << '\n';
+        (*m_ssEntity) << p.z << '\n';
+    }
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "SEQEND" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';
 }
 
 void CDxfWrite::writePoint(const double* point)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "POINT" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "POINT" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;           // Group code for layer name
-    (*m_ssEntity) << getLayerName() << endl;  // Layer name
+    (*m_ssEntity) << "  8" << '\n';           // Group code for layer name
+    (*m_ssEntity) << getLayerName() << '\n';  // Layer name
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbPoint" << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbPoint" << '\n';
     }
-    (*m_ssEntity) << " 10" << endl;
-    (*m_ssEntity) << point[0] << endl;  // X in WCS coordinates
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << point[1] << endl;  // Y in WCS coordinates
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << point[2] << endl;  // Z in WCS coordinates
+    (*m_ssEntity) << " 10" << '\n';
+    (*m_ssEntity) << point[0] << '\n';  // X in WCS coordinates
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << point[1] << '\n';  // Y in WCS coordinates
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << point[2] << '\n';  // Z in WCS coordinates
 }
 
 //! arc from 3 points - start, end, center. dir true if arc is AntiClockwise. unspecified assumption
@@ -712,69 +722,69 @@ void CDxfWrite::writeArc(const double* start, const double* end, const double* c
         start_angle = end_angle;
         end_angle = temp;
     }
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "ARC" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "ARC" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;           // Group code for layer name
-    (*m_ssEntity) << getLayerName() << endl;  // Layer number
+    (*m_ssEntity) << "  8" << '\n';           // Group code for layer name
+    (*m_ssEntity) << getLayerName() << '\n';  // Layer number
                                               //    (*m_ssEntity) << " 62"          << endl;
                                               //    (*m_ssEntity) << "     0"       << endl;
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbCircle" << endl;
-    }
-    (*m_ssEntity) << " 10" << endl;      // Centre X
-    (*m_ssEntity) << center[0] << endl;  // X in WCS coordinates
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << center[1] << endl;  // Y in WCS coordinates
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << center[2] << endl;  // Z in WCS coordinates
-    (*m_ssEntity) << " 40" << endl;      //
-    (*m_ssEntity) << radius << endl;     // Radius
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbCircle" << '\n';
+    }
+    (*m_ssEntity) << " 10" << '\n';      // Centre X
+    (*m_ssEntity) << center[0] << '\n';  // X in WCS coordinates
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << center[1] << '\n';  // Y in WCS coordinates
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << center[2] << '\n';  // Z in WCS coordinates
+    (*m_ssEntity) << " 40" << '\n';      //
+    (*m_ssEntity) << radius << '\n';     // Radius
 
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbArc" << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbArc" << '\n';
     }
-    (*m_ssEntity) << " 50" << endl;
-    (*m_ssEntity) << start_angle << endl;  // Start angle
-    (*m_ssEntity) << " 51" << endl;
-    (*m_ssEntity) << end_angle << endl;  // End angle
+    (*m_ssEntity) << " 50" << '\n';
+    (*m_ssEntity) << start_angle << '\n';  // Start angle
+    (*m_ssEntity) << " 51" << '\n';
+    (*m_ssEntity) << end_angle << '\n';  // End angle
 }
 
 void CDxfWrite::writeCircle(const double* center, double radius)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "CIRCLE" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "CIRCLE" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;           // Group code for layer name
-    (*m_ssEntity) << getLayerName() << endl;  // Layer number
+    (*m_ssEntity) << "  8" << '\n';           // Group code for layer name
+    (*m_ssEntity) << getLayerName() << '\n';  // Layer number
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbCircle" << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbCircle" << '\n';
     }
-    (*m_ssEntity) << " 10" << endl;      // Centre X
-    (*m_ssEntity) << center[0] << endl;  // X in WCS coordinates
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << center[1] << endl;  // Y in WCS coordinates
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << center[2] << endl;  // Z in WCS coordinates
-    (*m_ssEntity) << " 40" << endl;      //
-    (*m_ssEntity) << radius << endl;     // Radius
+    (*m_ssEntity) << " 10" << '\n';      // Centre X
+    (*m_ssEntity) << center[0] << '\n';  // X in WCS coordinates
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << center[1] << '\n';  // Y in WCS coordinates
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << center[2] << '\n';  // Z in WCS coordinates
+    (*m_ssEntity) << " 40" << '\n';      //
+    (*m_ssEntity) << radius << '\n';     // Radius
 }
 
 void CDxfWrite::writeEllipse(const double* center,
@@ -793,47 +803,47 @@ void CDxfWrite::writeEllipse(const double* center,
         start_angle = end_angle;
         end_angle = temp;
     }
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "ELLIPSE" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "ELLIPSE" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;           // Group code for layer name
-    (*m_ssEntity) << getLayerName() << endl;  // Layer number
+    (*m_ssEntity) << "  8" << '\n';           // Group code for layer name
+    (*m_ssEntity) << getLayerName() << '\n';  // Layer number
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEllipse" << endl;
-    }
-    (*m_ssEntity) << " 10" << endl;      // Centre X
-    (*m_ssEntity) << center[0] << endl;  // X in WCS coordinates
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << center[1] << endl;  // Y in WCS coordinates
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << center[2] << endl;  // Z in WCS coordinates
-    (*m_ssEntity) << " 11" << endl;      //
-    (*m_ssEntity) << m.x << endl;        // Major X
-    (*m_ssEntity) << " 21" << endl;
-    (*m_ssEntity) << m.y << endl;  // Major Y
-    (*m_ssEntity) << " 31" << endl;
-    (*m_ssEntity) << m.z << endl;    // Major Z
-    (*m_ssEntity) << " 40" << endl;  //
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEllipse" << '\n';
+    }
+    (*m_ssEntity) << " 10" << '\n';      // Centre X
+    (*m_ssEntity) << center[0] << '\n';  // X in WCS coordinates
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << center[1] << '\n';  // Y in WCS coordinates
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << center[2] << '\n';  // Z in WCS coordinates
+    (*m_ssEntity) << " 11" << '\n';      //
+    (*m_ssEntity) << m.x << '\n';        // Major X
+    (*m_ssEntity) << " 21" << '\n';
+    (*m_ssEntity) << m.y << '\n';  // Major Y
+    (*m_ssEntity) << " 31" << '\n';
+    (*m_ssEntity) << m.z << '\n';    // Major Z
+    (*m_ssEntity) << " 40" << '\n';  //
     (*m_ssEntity) << ratio
-                  << endl;  // Ratio
+                  << '\n';  // Ratio
                             //    (*m_ssEntity) << "210"       << endl;    //extrusion dir??
                             //    (*m_ssEntity) << "0"         << endl;
                             //    (*m_ssEntity) << "220"       << endl;
                             //    (*m_ssEntity) << "0"         << endl;
                             //    (*m_ssEntity) << "230"       << endl;
                             //    (*m_ssEntity) << "1"         << endl;
-    (*m_ssEntity) << " 41" << endl;
-    (*m_ssEntity) << start_angle << endl;  // Start angle (radians [0..2pi])
-    (*m_ssEntity) << " 42" << endl;
-    (*m_ssEntity) << end_angle << endl;  // End angle
+    (*m_ssEntity) << " 41" << '\n';
+    (*m_ssEntity) << start_angle << '\n';  // Start angle (radians [0..2pi])
+    (*m_ssEntity) << " 42" << '\n';
+    (*m_ssEntity) << end_angle << '\n';  // End angle
 }
 
 //***************************
@@ -841,39 +851,39 @@ void CDxfWrite::writeEllipse(const double* center,
 // added by Wandererfan 2018 (wandererfan@gmail.com) for FreeCAD project
 void CDxfWrite::writeSpline(const SplineDataOut& sd)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "SPLINE" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "SPLINE" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;           // Group code for layer name
-    (*m_ssEntity) << getLayerName() << endl;  // Layer name
+    (*m_ssEntity) << "  8" << '\n';           // Group code for layer name
+    (*m_ssEntity) << getLayerName() << '\n';  // Layer name
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbSpline" << endl;
-    }
-    (*m_ssEntity) << "210" << endl;
-    (*m_ssEntity) << "0" << endl;
-    (*m_ssEntity) << "220" << endl;
-    (*m_ssEntity) << "0" << endl;
-    (*m_ssEntity) << "230" << endl;
-    (*m_ssEntity) << "1" << endl;
-
-    (*m_ssEntity) << " 70" << endl;
-    (*m_ssEntity) << sd.flag << endl;  // flags
-    (*m_ssEntity) << " 71" << endl;
-    (*m_ssEntity) << sd.degree << endl;
-    (*m_ssEntity) << " 72" << endl;
-    (*m_ssEntity) << sd.knots << endl;
-    (*m_ssEntity) << " 73" << endl;
-    (*m_ssEntity) << sd.control_points << endl;
-    (*m_ssEntity) << " 74" << endl;
-    (*m_ssEntity) << 0 << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbSpline" << '\n';
+    }
+    (*m_ssEntity) << "210" << '\n';
+    (*m_ssEntity) << "0" << '\n';
+    (*m_ssEntity) << "220" << '\n';
+    (*m_ssEntity) << "0" << '\n';
+    (*m_ssEntity) << "230" << '\n';
+    (*m_ssEntity) << "1" << '\n';
+
+    (*m_ssEntity) << " 70" << '\n';
+    (*m_ssEntity) << sd.flag << '\n';  // flags
+    (*m_ssEntity) << " 71" << '\n';
+    (*m_ssEntity) << sd.degree << '\n';
+    (*m_ssEntity) << " 72" << '\n';
+    (*m_ssEntity) << sd.knots << '\n';
+    (*m_ssEntity) << " 73" << '\n';
+    (*m_ssEntity) << sd.control_points << '\n';
+    (*m_ssEntity) << " 74" << '\n';
+    (*m_ssEntity) << 0 << '\n';
 
     //    (*m_ssEntity) << " 12"          << endl;
     //    (*m_ssEntity) << sd.starttan.x  << endl;
@@ -889,30 +899,30 @@ void CDxfWrite::writeSpline(const SplineDataOut& sd)
     //    (*m_ssEntity) << sd.endtan.z    << endl;
 
     for (auto& k : sd.knot) {
-        (*m_ssEntity) << " 40" << endl;
-        (*m_ssEntity) << k << endl;
+        (*m_ssEntity) << " 40" << '\n';
+        (*m_ssEntity) << k << '\n';
     }
 
     for (auto& w : sd.weight) {
-        (*m_ssEntity) << " 41" << endl;
-        (*m_ssEntity) << w << endl;
+        (*m_ssEntity) << " 41" << '\n';
+        (*m_ssEntity) << w << '\n';
     }
 
     for (auto& center : sd.control) {
-        (*m_ssEntity) << " 10" << endl;
-        (*m_ssEntity) << center.x << endl;  // X in WCS coordinates
-        (*m_ssEntity) << " 20" << endl;
-        (*m_ssEntity) << center.y << endl;  // Y in WCS coordinates
-        (*m_ssEntity) << " 30" << endl;
-        (*m_ssEntity) << center.z << endl;  // Z in WCS coordinates
+        (*m_ssEntity) << " 10" << '\n';
+        (*m_ssEntity) << center.x << '\n';  // X in WCS coordinates
+        (*m_ssEntity) << " 20" << '\n';
+        (*m_ssEntity) << center.y << '\n';  // Y in WCS coordinates
+        (*m_ssEntity) << " 30" << '\n';
+        (*m_ssEntity) << center.z << '\n';  // Z in WCS coordinates
     }
     for (auto& f : sd.fit) {
-        (*m_ssEntity) << " 11" << endl;
-        (*m_ssEntity) << f.x << endl;  // X in WCS coordinates
-        (*m_ssEntity) << " 21" << endl;
-        (*m_ssEntity) << f.y << endl;  // Y in WCS coordinates
-        (*m_ssEntity) << " 31" << endl;
-        (*m_ssEntity) << f.z << endl;  // Z in WCS coordinates
+        (*m_ssEntity) << " 11" << '\n';
+        (*m_ssEntity) << f.x << '\n';  // X in WCS coordinates
+        (*m_ssEntity) << " 21" << '\n';
+        (*m_ssEntity) << f.y << '\n';  // Y in WCS coordinates
+        (*m_ssEntity) << " 31" << '\n';
+        (*m_ssEntity) << f.z << '\n';  // Z in WCS coordinates
     }
 }
 
@@ -921,30 +931,30 @@ void CDxfWrite::writeSpline(const SplineDataOut& sd)
 // added by Wandererfan 2018 (wandererfan@gmail.com) for FreeCAD project
 void CDxfWrite::writeVertex(double x, double y, double z)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "VERTEX" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "VERTEX" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;
-    (*m_ssEntity) << getLayerName() << endl;
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbVertex" << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbVertex" << '\n';
     }
-    (*m_ssEntity) << " 10" << endl;
-    (*m_ssEntity) << x << endl;
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << y << endl;
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << z << endl;
-    (*m_ssEntity) << " 70" << endl;
-    (*m_ssEntity) << 0 << endl;
+    (*m_ssEntity) << " 10" << '\n';
+    (*m_ssEntity) << x << '\n';
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << y << '\n';
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << z << '\n';
+    (*m_ssEntity) << " 70" << '\n';
+    (*m_ssEntity) << 0 << '\n';
 }
 
 void CDxfWrite::writeText(const char* text,
@@ -977,34 +987,34 @@ void CDxfWrite::putText(const char* text,
 {
     (void)location2;
 
-    (*outStream) << "  0" << endl;
-    (*outStream) << "TEXT" << endl;
-    (*outStream) << "  5" << endl;
-    (*outStream) << handle << endl;
+    (*outStream) << "  0" << '\n';
+    (*outStream) << "TEXT" << '\n';
+    (*outStream) << "  5" << '\n';
+    (*outStream) << handle << '\n';
     if (m_version > 12) {
-        (*outStream) << "330" << endl;
-        (*outStream) << ownerHandle << endl;
-        (*outStream) << "100" << endl;
-        (*outStream) << "AcDbEntity" << endl;
+        (*outStream) << "330" << '\n';
+        (*outStream) << ownerHandle << '\n';
+        (*outStream) << "100" << '\n';
+        (*outStream) << "AcDbEntity" << '\n';
     }
-    (*outStream) << "  8" << endl;
-    (*outStream) << getLayerName() << endl;
+    (*outStream) << "  8" << '\n';
+    (*outStream) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*outStream) << "100" << endl;
-        (*outStream) << "AcDbText" << endl;
+        (*outStream) << "100" << '\n';
+        (*outStream) << "AcDbText" << '\n';
     }
     //    (*outStream) << " 39"          << endl;
     //    (*outStream) << 0              << endl;     //thickness
-    (*outStream) << " 10" << endl;  // first alignment point
-    (*outStream) << location1.x << endl;
-    (*outStream) << " 20" << endl;
-    (*outStream) << location1.y << endl;
-    (*outStream) << " 30" << endl;
-    (*outStream) << location1.z << endl;
-    (*outStream) << " 40" << endl;
-    (*outStream) << height << endl;
-    (*outStream) << "  1" << endl;
-    (*outStream) << text << endl;
+    (*outStream) << " 10" << '\n';  // first alignment point
+    (*outStream) << location1.x << '\n';
+    (*outStream) << " 20" << '\n';
+    (*outStream) << location1.y << '\n';
+    (*outStream) << " 30" << '\n';
+    (*outStream) << location1.z << '\n';
+    (*outStream) << " 40" << '\n';
+    (*outStream) << height << '\n';
+    (*outStream) << "  1" << '\n';
+    (*outStream) << text << '\n';
     //    (*outStream) << " 50"          << endl;
     //    (*outStream) << 0              << endl;    //rotation
     //    (*outStream) << " 41"          << endl;
@@ -1012,20 +1022,20 @@ void CDxfWrite::putText(const char* text,
     //    (*outStream) << " 51"          << endl;
     //    (*outStream) << 0              << endl;
 
-    (*outStream) << "  7" << endl;
-    (*outStream) << "STANDARD" << endl;  // style
+    (*outStream) << "  7" << '\n';
+    (*outStream) << "STANDARD" << '\n';  // style
     //    (*outStream) << " 71"          << endl;  //default
     //    (*outStream) << "0"            << endl;
-    (*outStream) << " 72" << endl;
-    (*outStream) << horizJust << endl;
+    (*outStream) << " 72" << '\n';
+    (*outStream) << horizJust << '\n';
     ////    (*outStream) << " 73"          << endl;
     ////    (*outStream) << "0"            << endl;
-    (*outStream) << " 11" << endl;  // second alignment point
-    (*outStream) << location2.x << endl;
-    (*outStream) << " 21" << endl;
-    (*outStream) << location2.y << endl;
-    (*outStream) << " 31" << endl;
-    (*outStream) << location2.z << endl;
+    (*outStream) << " 11" << '\n';  // second alignment point
+    (*outStream) << location2.x << '\n';
+    (*outStream) << " 21" << '\n';
+    (*outStream) << location2.y << '\n';
+    (*outStream) << " 31" << '\n';
+    (*outStream) << location2.z << '\n';
     //    (*outStream) << "210"          << endl;
     //    (*outStream) << "0"            << endl;
     //    (*outStream) << "220"          << endl;
@@ -1033,8 +1043,8 @@ void CDxfWrite::putText(const char* text,
     //    (*outStream) << "230"          << endl;
     //    (*outStream) << "1"            << endl;
     if (m_version > 12) {
-        (*outStream) << "100" << endl;
-        (*outStream) << "AcDbText" << endl;
+        (*outStream) << "100" << '\n';
+        (*outStream) << "AcDbText" << '\n';
     }
 }
 
@@ -1045,48 +1055,48 @@ void CDxfWrite::putArrow(Base::Vector3d& arrowPos,
                          const std::string& handle,
                          const std::string& ownerHandle)
 {
-    (*outStream) << "  0" << endl;
-    (*outStream) << "SOLID" << endl;
-    (*outStream) << "  5" << endl;
-    (*outStream) << handle << endl;
+    (*outStream) << "  0" << '\n';
+    (*outStream) << "SOLID" << '\n';
+    (*outStream) << "  5" << '\n';
+    (*outStream) << handle << '\n';
     if (m_version > 12) {
-        (*outStream) << "330" << endl;
-        (*outStream) << ownerHandle << endl;
-        (*outStream) << "100" << endl;
-        (*outStream) << "AcDbEntity" << endl;
-    }
-    (*outStream) << "  8" << endl;
-    (*outStream) << "0" << endl;
-    (*outStream) << " 62" << endl;
-    (*outStream) << "     0" << endl;
+        (*outStream) << "330" << '\n';
+        (*outStream) << ownerHandle << '\n';
+        (*outStream) << "100" << '\n';
+        (*outStream) << "AcDbEntity" << '\n';
+    }
+    (*outStream) << "  8" << '\n';
+    (*outStream) << "0" << '\n';
+    (*outStream) << " 62" << '\n';
+    (*outStream) << "     0" << '\n';
     if (m_version > 12) {
-        (*outStream) << "100" << endl;
-        (*outStream) << "AcDbTrace" << endl;
-    }
-    (*outStream) << " 10" << endl;
-    (*outStream) << barb1Pos.x << endl;
-    (*outStream) << " 20" << endl;
-    (*outStream) << barb1Pos.y << endl;
-    (*outStream) << " 30" << endl;
-    (*outStream) << barb1Pos.z << endl;
-    (*outStream) << " 11" << endl;
-    (*outStream) << barb2Pos.x << endl;
-    (*outStream) << " 21" << endl;
-    (*outStream) << barb2Pos.y << endl;
-    (*outStream) << " 31" << endl;
-    (*outStream) << barb2Pos.z << endl;
-    (*outStream) << " 12" << endl;
-    (*outStream) << arrowPos.x << endl;
-    (*outStream) << " 22" << endl;
-    (*outStream) << arrowPos.y << endl;
-    (*outStream) << " 32" << endl;
-    (*outStream) << arrowPos.z << endl;
-    (*outStream) << " 13" << endl;
-    (*outStream) << arrowPos.x << endl;
-    (*outStream) << " 23" << endl;
-    (*outStream) << arrowPos.y << endl;
-    (*outStream) << " 33" << endl;
-    (*outStream) << arrowPos.z << endl;
+        (*outStream) << "100" << '\n';
+        (*outStream) << "AcDbTrace" << '\n';
+    }
+    (*outStream) << " 10" << '\n';
+    (*outStream) << barb1Pos.x << '\n';
+    (*outStream) << " 20" << '\n';
+    (*outStream) << barb1Pos.y << '\n';
+    (*outStream) << " 30" << '\n';
+    (*outStream) << barb1Pos.z << '\n';
+    (*outStream) << " 11" << '\n';
+    (*outStream) << barb2Pos.x << '\n';
+    (*outStream) << " 21" << '\n';
+    (*outStream) << barb2Pos.y << '\n';
+    (*outStream) << " 31" << '\n';
+    (*outStream) << barb2Pos.z << '\n';
+    (*outStream) << " 12" << '\n';
+    (*outStream) << arrowPos.x << '\n';
+    (*outStream) << " 22" << '\n';
+    (*outStream) << arrowPos.y << '\n';
+    (*outStream) << " 32" << '\n';
+    (*outStream) << arrowPos.z << '\n';
+    (*outStream) << " 13" << '\n';
+    (*outStream) << arrowPos.x << '\n';
+    (*outStream) << " 23" << '\n';
+    (*outStream) << arrowPos.y << '\n';
+    (*outStream) << " 33" << '\n';
+    (*outStream) << arrowPos.z << '\n';
 }
 
 //***************************
@@ -1102,75 +1112,75 @@ void CDxfWrite::writeLinearDim(const double* textMidPoint,
                                const char* dimText,
                                int type)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "DIMENSION" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "DIMENSION" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;
-    (*m_ssEntity) << getLayerName() << endl;
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbDimension" << endl;
-    }
-    (*m_ssEntity) << "  2" << endl;
-    (*m_ssEntity) << "*" << getLayerName() << endl;  // blockName
-    (*m_ssEntity) << " 10" << endl;                  // dimension line definition point
-    (*m_ssEntity) << lineDefPoint[0] << endl;
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << lineDefPoint[1] << endl;
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << lineDefPoint[2] << endl;
-    (*m_ssEntity) << " 11" << endl;  // text mid point
-    (*m_ssEntity) << textMidPoint[0] << endl;
-    (*m_ssEntity) << " 21" << endl;
-    (*m_ssEntity) << textMidPoint[1] << endl;
-    (*m_ssEntity) << " 31" << endl;
-    (*m_ssEntity) << textMidPoint[2] << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbDimension" << '\n';
+    }
+    (*m_ssEntity) << "  2" << '\n';
+    (*m_ssEntity) << "*" << getLayerName() << '\n';  // blockName
+    (*m_ssEntity) << " 10" << '\n';                  // dimension line definition point
+    (*m_ssEntity) << lineDefPoint[0] << '\n';
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << lineDefPoint[1] << '\n';
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << lineDefPoint[2] << '\n';
+    (*m_ssEntity) << " 11" << '\n';  // text mid point
+    (*m_ssEntity) << textMidPoint[0] << '\n';
+    (*m_ssEntity) << " 21" << '\n';
+    (*m_ssEntity) << textMidPoint[1] << '\n';
+    (*m_ssEntity) << " 31" << '\n';
+    (*m_ssEntity) << textMidPoint[2] << '\n';
     if (type == ALIGNED) {
-        (*m_ssEntity) << " 70" << endl;
-        (*m_ssEntity) << 1 << endl;  // dimType1 = Aligned
+        (*m_ssEntity) << " 70" << '\n';
+        (*m_ssEntity) << 1 << '\n';  // dimType1 = Aligned
     }
     if ((type == HORIZONTAL) || (type == VERTICAL)) {
-        (*m_ssEntity) << " 70" << endl;
-        (*m_ssEntity) << 32 << endl;  // dimType0 = Aligned + 32 (bit for unique block)?
+        (*m_ssEntity) << " 70" << '\n';
+        (*m_ssEntity) << 32 << '\n';  // dimType0 = Aligned + 32 (bit for unique block)?
     }
     //    (*m_ssEntity) << " 71"          << endl;    // not R12
     //    (*m_ssEntity) << 1              << endl;    // attachPoint ??1 = topleft
-    (*m_ssEntity) << "  1" << endl;
-    (*m_ssEntity) << dimText << endl;
-    (*m_ssEntity) << "  3" << endl;
-    (*m_ssEntity) << "STANDARD" << endl;  // style
+    (*m_ssEntity) << "  1" << '\n';
+    (*m_ssEntity) << dimText << '\n';
+    (*m_ssEntity) << "  3" << '\n';
+    (*m_ssEntity) << "STANDARD" << '\n';  // style
     // linear dims
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbAlignedDimension" << endl;
-    }
-    (*m_ssEntity) << " 13" << endl;
-    (*m_ssEntity) << extLine1[0] << endl;
-    (*m_ssEntity) << " 23" << endl;
-    (*m_ssEntity) << extLine1[1] << endl;
-    (*m_ssEntity) << " 33" << endl;
-    (*m_ssEntity) << extLine1[2] << endl;
-    (*m_ssEntity) << " 14" << endl;
-    (*m_ssEntity) << extLine2[0] << endl;
-    (*m_ssEntity) << " 24" << endl;
-    (*m_ssEntity) << extLine2[1] << endl;
-    (*m_ssEntity) << " 34" << endl;
-    (*m_ssEntity) << extLine2[2] << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbAlignedDimension" << '\n';
+    }
+    (*m_ssEntity) << " 13" << '\n';
+    (*m_ssEntity) << extLine1[0] << '\n';
+    (*m_ssEntity) << " 23" << '\n';
+    (*m_ssEntity) << extLine1[1] << '\n';
+    (*m_ssEntity) << " 33" << '\n';
+    (*m_ssEntity) << extLine1[2] << '\n';
+    (*m_ssEntity) << " 14" << '\n';
+    (*m_ssEntity) << extLine2[0] << '\n';
+    (*m_ssEntity) << " 24" << '\n';
+    (*m_ssEntity) << extLine2[1] << '\n';
+    (*m_ssEntity) << " 34" << '\n';
+    (*m_ssEntity) << extLine2[2] << '\n';
     if (m_version > 12) {
         if (type == VERTICAL) {
-            (*m_ssEntity) << " 50" << endl;
-            (*m_ssEntity) << "90" << endl;
+            (*m_ssEntity) << " 50" << '\n';
+            (*m_ssEntity) << "90" << '\n';
         }
         if ((type == HORIZONTAL) || (type == VERTICAL)) {
-            (*m_ssEntity) << "100" << endl;
-            (*m_ssEntity) << "AcDbRotatedDimension" << endl;
+            (*m_ssEntity) << "100" << '\n';
+            (*m_ssEntity) << "AcDbRotatedDimension" << '\n';
         }
     }
 
@@ -1190,80 +1200,80 @@ void CDxfWrite::writeAngularDim(const double* textMidPoint,
                                 const double* endExt2,
                                 const char* dimText)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "DIMENSION" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "DIMENSION" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;
-    (*m_ssEntity) << getLayerName() << endl;
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbDimension" << endl;
-    }
-    (*m_ssEntity) << "  2" << endl;
-    (*m_ssEntity) << "*" << getLayerName() << endl;  // blockName
-
-    (*m_ssEntity) << " 10" << endl;
-    (*m_ssEntity) << endExt2[0] << endl;
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << endExt2[1] << endl;
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << endExt2[2] << endl;
-
-    (*m_ssEntity) << " 11" << endl;
-    (*m_ssEntity) << textMidPoint[0] << endl;
-    (*m_ssEntity) << " 21" << endl;
-    (*m_ssEntity) << textMidPoint[1] << endl;
-    (*m_ssEntity) << " 31" << endl;
-    (*m_ssEntity) << textMidPoint[2] << endl;
-
-    (*m_ssEntity) << " 70" << endl;
-    (*m_ssEntity) << 2 << endl;  // dimType 2 = Angular  5 = Angular 3 point
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbDimension" << '\n';
+    }
+    (*m_ssEntity) << "  2" << '\n';
+    (*m_ssEntity) << "*" << getLayerName() << '\n';  // blockName
+
+    (*m_ssEntity) << " 10" << '\n';
+    (*m_ssEntity) << endExt2[0] << '\n';
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << endExt2[1] << '\n';
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << endExt2[2] << '\n';
+
+    (*m_ssEntity) << " 11" << '\n';
+    (*m_ssEntity) << textMidPoint[0] << '\n';
+    (*m_ssEntity) << " 21" << '\n';
+    (*m_ssEntity) << textMidPoint[1] << '\n';
+    (*m_ssEntity) << " 31" << '\n';
+    (*m_ssEntity) << textMidPoint[2] << '\n';
+
+    (*m_ssEntity) << " 70" << '\n';
+    (*m_ssEntity) << 2 << '\n';  // dimType 2 = Angular  5 = Angular 3 point
                                  // +32 for block?? (not R12)
     //    (*m_ssEntity) << " 71"          << endl;    // not R12?  not required?
     //    (*m_ssEntity) << 5              << endl;    // attachPoint 5 = middle
-    (*m_ssEntity) << "  1" << endl;
-    (*m_ssEntity) << dimText << endl;
-    (*m_ssEntity) << "  3" << endl;
-    (*m_ssEntity) << "STANDARD" << endl;  // style
+    (*m_ssEntity) << "  1" << '\n';
+    (*m_ssEntity) << dimText << '\n';
+    (*m_ssEntity) << "  3" << '\n';
+    (*m_ssEntity) << "STANDARD" << '\n';  // style
     // angular dims
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDb2LineAngularDimension" << endl;
-    }
-    (*m_ssEntity) << " 13" << endl;
-    (*m_ssEntity) << startExt1[0] << endl;
-    (*m_ssEntity) << " 23" << endl;
-    (*m_ssEntity) << startExt1[1] << endl;
-    (*m_ssEntity) << " 33" << endl;
-    (*m_ssEntity) << startExt1[2] << endl;
-
-    (*m_ssEntity) << " 14" << endl;
-    (*m_ssEntity) << endExt1[0] << endl;
-    (*m_ssEntity) << " 24" << endl;
-    (*m_ssEntity) << endExt1[1] << endl;
-    (*m_ssEntity) << " 34" << endl;
-    (*m_ssEntity) << endExt1[2] << endl;
-
-    (*m_ssEntity) << " 15" << endl;
-    (*m_ssEntity) << startExt2[0] << endl;
-    (*m_ssEntity) << " 25" << endl;
-    (*m_ssEntity) << startExt2[1] << endl;
-    (*m_ssEntity) << " 35" << endl;
-    (*m_ssEntity) << startExt2[2] << endl;
-
-    (*m_ssEntity) << " 16" << endl;
-    (*m_ssEntity) << lineDefPoint[0] << endl;
-    (*m_ssEntity) << " 26" << endl;
-    (*m_ssEntity) << lineDefPoint[1] << endl;
-    (*m_ssEntity) << " 36" << endl;
-    (*m_ssEntity) << lineDefPoint[2] << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDb2LineAngularDimension" << '\n';
+    }
+    (*m_ssEntity) << " 13" << '\n';
+    (*m_ssEntity) << startExt1[0] << '\n';
+    (*m_ssEntity) << " 23" << '\n';
+    (*m_ssEntity) << startExt1[1] << '\n';
+    (*m_ssEntity) << " 33" << '\n';
+    (*m_ssEntity) << startExt1[2] << '\n';
+
+    (*m_ssEntity) << " 14" << '\n';
+    (*m_ssEntity) << endExt1[0] << '\n';
+    (*m_ssEntity) << " 24" << '\n';
+    (*m_ssEntity) << endExt1[1] << '\n';
+    (*m_ssEntity) << " 34" << '\n';
+    (*m_ssEntity) << endExt1[2] << '\n';
+
+    (*m_ssEntity) << " 15" << '\n';
+    (*m_ssEntity) << startExt2[0] << '\n';
+    (*m_ssEntity) << " 25" << '\n';
+    (*m_ssEntity) << startExt2[1] << '\n';
+    (*m_ssEntity) << " 35" << '\n';
+    (*m_ssEntity) << startExt2[2] << '\n';
+
+    (*m_ssEntity) << " 16" << '\n';
+    (*m_ssEntity) << lineDefPoint[0] << '\n';
+    (*m_ssEntity) << " 26" << '\n';
+    (*m_ssEntity) << lineDefPoint[1] << '\n';
+    (*m_ssEntity) << " 36" << '\n';
+    (*m_ssEntity) << lineDefPoint[2] << '\n';
     writeDimBlockPreamble();
     writeAngularDimBlock(textMidPoint,
                          lineDefPoint,
@@ -1283,57 +1293,57 @@ void CDxfWrite::writeRadialDim(const double* centerPoint,
                                const double* arcPoint,
                                const char* dimText)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "DIMENSION" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "DIMENSION" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;
-    (*m_ssEntity) << getLayerName() << endl;
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbDimension" << endl;
-    }
-    (*m_ssEntity) << "  2" << endl;
-    (*m_ssEntity) << "*" << getLayerName() << endl;  // blockName
-    (*m_ssEntity) << " 10" << endl;                  // arc center point
-    (*m_ssEntity) << centerPoint[0] << endl;
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << centerPoint[1] << endl;
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << centerPoint[2] << endl;
-    (*m_ssEntity) << " 11" << endl;  // text mid point
-    (*m_ssEntity) << textMidPoint[0] << endl;
-    (*m_ssEntity) << " 21" << endl;
-    (*m_ssEntity) << textMidPoint[1] << endl;
-    (*m_ssEntity) << " 31" << endl;
-    (*m_ssEntity) << textMidPoint[2] << endl;
-    (*m_ssEntity) << " 70" << endl;
-    (*m_ssEntity) << 4 << endl;  // dimType 4 = Radius
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbDimension" << '\n';
+    }
+    (*m_ssEntity) << "  2" << '\n';
+    (*m_ssEntity) << "*" << getLayerName() << '\n';  // blockName
+    (*m_ssEntity) << " 10" << '\n';                  // arc center point
+    (*m_ssEntity) << centerPoint[0] << '\n';
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << centerPoint[1] << '\n';
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << centerPoint[2] << '\n';
+    (*m_ssEntity) << " 11" << '\n';  // text mid point
+    (*m_ssEntity) << textMidPoint[0] << '\n';
+    (*m_ssEntity) << " 21" << '\n';
+    (*m_ssEntity) << textMidPoint[1] << '\n';
+    (*m_ssEntity) << " 31" << '\n';
+    (*m_ssEntity) << textMidPoint[2] << '\n';
+    (*m_ssEntity) << " 70" << '\n';
+    (*m_ssEntity) << 4 << '\n';  // dimType 4 = Radius
                                  //    (*m_ssEntity) << " 71"          << endl;    // not R12
     //    (*m_ssEntity) << 1              << endl;    // attachPoint 5 = middle center
-    (*m_ssEntity) << "  1" << endl;
-    (*m_ssEntity) << dimText << endl;
-    (*m_ssEntity) << "  3" << endl;
-    (*m_ssEntity) << "STANDARD" << endl;  // style
+    (*m_ssEntity) << "  1" << '\n';
+    (*m_ssEntity) << dimText << '\n';
+    (*m_ssEntity) << "  3" << '\n';
+    (*m_ssEntity) << "STANDARD" << '\n';  // style
     // radial dims
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbRadialDimension" << endl;
-    }
-    (*m_ssEntity) << " 15" << endl;
-    (*m_ssEntity) << arcPoint[0] << endl;
-    (*m_ssEntity) << " 25" << endl;
-    (*m_ssEntity) << arcPoint[1] << endl;
-    (*m_ssEntity) << " 35" << endl;
-    (*m_ssEntity) << arcPoint[2] << endl;
-    (*m_ssEntity) << " 40" << endl;  // leader length????
-    (*m_ssEntity) << 0 << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbRadialDimension" << '\n';
+    }
+    (*m_ssEntity) << " 15" << '\n';
+    (*m_ssEntity) << arcPoint[0] << '\n';
+    (*m_ssEntity) << " 25" << '\n';
+    (*m_ssEntity) << arcPoint[1] << '\n';
+    (*m_ssEntity) << " 35" << '\n';
+    (*m_ssEntity) << arcPoint[2] << '\n';
+    (*m_ssEntity) << " 40" << '\n';  // leader length????
+    (*m_ssEntity) << 0 << '\n';
 
     writeDimBlockPreamble();
     writeRadialDimBlock(centerPoint, textMidPoint, arcPoint, dimText);
@@ -1348,57 +1358,57 @@ void CDxfWrite::writeDiametricDim(const double* textMidPoint,
                                   const double* arcPoint2,
                                   const char* dimText)
 {
-    (*m_ssEntity) << "  0" << endl;
-    (*m_ssEntity) << "DIMENSION" << endl;
-    (*m_ssEntity) << "  5" << endl;
-    (*m_ssEntity) << getEntityHandle() << endl;
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "DIMENSION" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "330" << endl;
-        (*m_ssEntity) << m_saveModelSpaceHandle << endl;
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbEntity" << endl;
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
     }
-    (*m_ssEntity) << "  8" << endl;
-    (*m_ssEntity) << getLayerName() << endl;
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbDimension" << endl;
-    }
-    (*m_ssEntity) << "  2" << endl;
-    (*m_ssEntity) << "*" << getLayerName() << endl;  // blockName
-    (*m_ssEntity) << " 10" << endl;
-    (*m_ssEntity) << arcPoint1[0] << endl;
-    (*m_ssEntity) << " 20" << endl;
-    (*m_ssEntity) << arcPoint1[1] << endl;
-    (*m_ssEntity) << " 30" << endl;
-    (*m_ssEntity) << arcPoint1[2] << endl;
-    (*m_ssEntity) << " 11" << endl;  // text mid point
-    (*m_ssEntity) << textMidPoint[0] << endl;
-    (*m_ssEntity) << " 21" << endl;
-    (*m_ssEntity) << textMidPoint[1] << endl;
-    (*m_ssEntity) << " 31" << endl;
-    (*m_ssEntity) << textMidPoint[2] << endl;
-    (*m_ssEntity) << " 70" << endl;
-    (*m_ssEntity) << 3 << endl;  // dimType 3 = Diameter
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbDimension" << '\n';
+    }
+    (*m_ssEntity) << "  2" << '\n';
+    (*m_ssEntity) << "*" << getLayerName() << '\n';  // blockName
+    (*m_ssEntity) << " 10" << '\n';
+    (*m_ssEntity) << arcPoint1[0] << '\n';
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << arcPoint1[1] << '\n';
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << arcPoint1[2] << '\n';
+    (*m_ssEntity) << " 11" << '\n';  // text mid point
+    (*m_ssEntity) << textMidPoint[0] << '\n';
+    (*m_ssEntity) << " 21" << '\n';
+    (*m_ssEntity) << textMidPoint[1] << '\n';
+    (*m_ssEntity) << " 31" << '\n';
+    (*m_ssEntity) << textMidPoint[2] << '\n';
+    (*m_ssEntity) << " 70" << '\n';
+    (*m_ssEntity) << 3 << '\n';  // dimType 3 = Diameter
                                  //    (*m_ssEntity) << " 71"          << endl;    // not R12
     //    (*m_ssEntity) << 5              << endl;    // attachPoint 5 = middle center
-    (*m_ssEntity) << "  1" << endl;
-    (*m_ssEntity) << dimText << endl;
-    (*m_ssEntity) << "  3" << endl;
-    (*m_ssEntity) << "STANDARD" << endl;  // style
+    (*m_ssEntity) << "  1" << '\n';
+    (*m_ssEntity) << dimText << '\n';
+    (*m_ssEntity) << "  3" << '\n';
+    (*m_ssEntity) << "STANDARD" << '\n';  // style
     // diametric dims
     if (m_version > 12) {
-        (*m_ssEntity) << "100" << endl;
-        (*m_ssEntity) << "AcDbDiametricDimension" << endl;
-    }
-    (*m_ssEntity) << " 15" << endl;
-    (*m_ssEntity) << arcPoint2[0] << endl;
-    (*m_ssEntity) << " 25" << endl;
-    (*m_ssEntity) << arcPoint2[1] << endl;
-    (*m_ssEntity) << " 35" << endl;
-    (*m_ssEntity) << arcPoint2[2] << endl;
-    (*m_ssEntity) << " 40" << endl;  // leader length????
-    (*m_ssEntity) << 0 << endl;
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbDiametricDimension" << '\n';
+    }
+    (*m_ssEntity) << " 15" << '\n';
+    (*m_ssEntity) << arcPoint2[0] << '\n';
+    (*m_ssEntity) << " 25" << '\n';
+    (*m_ssEntity) << arcPoint2[1] << '\n';
+    (*m_ssEntity) << " 35" << '\n';
+    (*m_ssEntity) << arcPoint2[2] << '\n';
+    (*m_ssEntity) << " 40" << '\n';  // leader length????
+    (*m_ssEntity) << 0 << '\n';
 
     writeDimBlockPreamble();
     writeDiametricDimBlock(textMidPoint, arcPoint1, arcPoint2, dimText);
@@ -1418,36 +1428,36 @@ void CDxfWrite::writeDimBlockPreamble()
     }
 
     m_currentBlock = getBlockHandle();
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "BLOCK" << endl;
-    (*m_ssBlock) << "  5" << endl;
-    (*m_ssBlock) << m_currentBlock << endl;
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "BLOCK" << '\n';
+    (*m_ssBlock) << "  5" << '\n';
+    (*m_ssBlock) << m_currentBlock << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "330" << endl;
-        (*m_ssBlock) << m_saveBlkRecordHandle << endl;
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbEntity" << endl;
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_saveBlkRecordHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
     }
-    (*m_ssBlock) << "  8" << endl;
-    (*m_ssBlock) << getLayerName() << endl;
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbBlockBegin" << endl;
-    }
-    (*m_ssBlock) << "  2" << endl;
-    (*m_ssBlock) << "*" << getLayerName() << endl;  // blockName
-    (*m_ssBlock) << " 70" << endl;
-    (*m_ssBlock) << "   1" << endl;
-    (*m_ssBlock) << " 10" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << " 20" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << " 30" << endl;
-    (*m_ssBlock) << 0.0 << endl;
-    (*m_ssBlock) << "  3" << endl;
-    (*m_ssBlock) << "*" << getLayerName() << endl;  // blockName
-    (*m_ssBlock) << "  1" << endl;
-    (*m_ssBlock) << " " << endl;
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbBlockBegin" << '\n';
+    }
+    (*m_ssBlock) << "  2" << '\n';
+    (*m_ssBlock) << "*" << getLayerName() << '\n';  // blockName
+    (*m_ssBlock) << " 70" << '\n';
+    (*m_ssBlock) << "   1" << '\n';
+    (*m_ssBlock) << " 10" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 20" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 30" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << "  3" << '\n';
+    (*m_ssBlock) << "*" << getLayerName() << '\n';  // blockName
+    (*m_ssBlock) << "  1" << '\n';
+    (*m_ssBlock) << " " << '\n';
 }
 
 //***************************
@@ -1455,23 +1465,111 @@ void CDxfWrite::writeDimBlockPreamble()
 // added by Wandererfan 2018 (wandererfan@gmail.com) for FreeCAD project
 void CDxfWrite::writeBlockTrailer()
 {
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "ENDBLK" << endl;
-    (*m_ssBlock) << "  5" << endl;
-    (*m_ssBlock) << getBlockHandle() << endl;
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "ENDBLK" << '\n';
+    (*m_ssBlock) << "  5" << '\n';
+    (*m_ssBlock) << getBlockHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "330" << endl;
-        (*m_ssBlock) << m_saveBlkRecordHandle << endl;
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbEntity" << endl;
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_saveBlkRecordHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
     }
     //    (*m_ssBlock) << " 67"    << endl;
     //    (*m_ssBlock) << "1"    << endl;
-    (*m_ssBlock) << "  8" << endl;
-    (*m_ssBlock) << getLayerName() << endl;
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << getLayerName() << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbBlockEnd" << endl;
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbBlockEnd" << '\n';
+    }
+}
+
+void CDxfWrite::beginBlock(const std::string& name)
+{
+    // Block contents live on layer 0 so that every insert shows them on its own layer.
+    m_saveLayerName = m_layerName;
+    m_layerName = "0";
+
+    if (m_version > 12) {
+        m_saveBlkRecordHandle = getBlkRecordHandle();
+        addBlockName(name, m_saveBlkRecordHandle);
+    }
+
+    m_currentBlock = getBlockHandle();
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "BLOCK" << '\n';
+    (*m_ssBlock) << "  5" << '\n';
+    (*m_ssBlock) << m_currentBlock << '\n';
+    if (m_version > 12) {
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_saveBlkRecordHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
+    }
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << getLayerName() << '\n';
+    if (m_version > 12) {
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbBlockBegin" << '\n';
+    }
+    (*m_ssBlock) << "  2" << '\n';
+    (*m_ssBlock) << name << '\n';
+    (*m_ssBlock) << " 70" << '\n';
+    (*m_ssBlock) << "   0" << '\n';
+    (*m_ssBlock) << " 10" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 20" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << " 30" << '\n';
+    (*m_ssBlock) << 0.0 << '\n';
+    (*m_ssBlock) << "  3" << '\n';
+    (*m_ssBlock) << name << '\n';
+    (*m_ssBlock) << "  1" << '\n';
+    (*m_ssBlock) << " " << '\n';
+
+    // Until endBlock the entity writers append to the block definition, owned by its block record.
+    std::swap(m_ssEntity, m_ssBlock);
+    std::swap(m_saveModelSpaceHandle, m_saveBlkRecordHandle);
+}
+
+void CDxfWrite::endBlock()
+{
+    std::swap(m_ssEntity, m_ssBlock);
+    std::swap(m_saveModelSpaceHandle, m_saveBlkRecordHandle);
+    writeBlockTrailer();
+    m_layerName = m_saveLayerName;
+}
+
+void CDxfWrite::writeInsert(const std::string& blockName, const double* point, double rotation)
+{
+    (*m_ssEntity) << "  0" << '\n';
+    (*m_ssEntity) << "INSERT" << '\n';
+    (*m_ssEntity) << "  5" << '\n';
+    (*m_ssEntity) << getEntityHandle() << '\n';
+    if (m_version > 12) {
+        (*m_ssEntity) << "330" << '\n';
+        (*m_ssEntity) << m_saveModelSpaceHandle << '\n';
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbEntity" << '\n';
+    }
+    (*m_ssEntity) << "  8" << '\n';
+    (*m_ssEntity) << getLayerName() << '\n';
+    if (m_version > 12) {
+        (*m_ssEntity) << "100" << '\n';
+        (*m_ssEntity) << "AcDbBlockReference" << '\n';
+    }
+    (*m_ssEntity) << "  2" << '\n';
+    (*m_ssEntity) << blockName << '\n';
+    (*m_ssEntity) << " 10" << '\n';
+    (*m_ssEntity) << point[0] << '\n';  // Insertion point in WCS coordinates
+    (*m_ssEntity) << " 20" << '\n';
+    (*m_ssEntity) << point[1] << '\n';
+    (*m_ssEntity) << " 30" << '\n';
+    (*m_ssEntity) << point[2] << '\n';
+    if (rotation != 0.0) {
+        (*m_ssEntity) << " 50" << '\n';
+        (*m_ssEntity) << rotation << '\n';  // Rotation in degrees
     }
 }
 
@@ -1595,40 +1693,40 @@ void CDxfWrite::writeAngularDimBlock(const double* textMidPoint,
     Base::Vector3d linePt(MakeVector3d(lineDefPoint));
     double radius = (e2S - linePt).Length();
 
-    (*m_ssBlock) << "  0" << endl;
-    (*m_ssBlock) << "ARC" << endl;  // dimline arc
-    (*m_ssBlock) << "  5" << endl;
-    (*m_ssBlock) << getBlockHandle() << endl;
+    (*m_ssBlock) << "  0" << '\n';
+    (*m_ssBlock) << "ARC" << '\n';  // dimline arc
+    (*m_ssBlock) << "  5" << '\n';
+    (*m_ssBlock) << getBlockHandle() << '\n';
     if (m_version > 12) {
-        (*m_ssBlock) << "330" << endl;
-        (*m_ssBlock) << m_saveBlkRecordHandle << endl;
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbEntity" << endl;
+        (*m_ssBlock) << "330" << '\n';
+        (*m_ssBlock) << m_saveBlkRecordHandle << '\n';
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbEntity" << '\n';
     }
-    (*m_ssBlock) << "  8" << endl;
-    (*m_ssBlock) << "0" << endl;
+    (*m_ssBlock) << "  8" << '\n';
+    (*m_ssBlock) << "0" << '\n';
     //    (*m_ssBlock) << " 62"          << endl;
     //    (*m_ssBlock) << "     0"       << endl;
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbCircle" << endl;
-    }
-    (*m_ssBlock) << " 10" << endl;
-    (*m_ssBlock) << startExt2[0] << endl;  // arc center
-    (*m_ssBlock) << " 20" << endl;
-    (*m_ssBlock) << startExt2[1] << endl;
-    (*m_ssBlock) << " 30" << endl;
-    (*m_ssBlock) << startExt2[2] << endl;
-    (*m_ssBlock) << " 40" << endl;
-    (*m_ssBlock) << radius << endl;  // radius
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbCircle" << '\n';
+    }
+    (*m_ssBlock) << " 10" << '\n';
+    (*m_ssBlock) << startExt2[0] << '\n';  // arc center
+    (*m_ssBlock) << " 20" << '\n';
+    (*m_ssBlock) << startExt2[1] << '\n';
+    (*m_ssBlock) << " 30" << '\n';
+    (*m_ssBlock) << startExt2[2] << '\n';
+    (*m_ssBlock) << " 40" << '\n';
+    (*m_ssBlock) << radius << '\n';  // radius
     if (m_version > 12) {
-        (*m_ssBlock) << "100" << endl;
-        (*m_ssBlock) << "AcDbArc" << endl;
+        (*m_ssBlock) << "100" << '\n';
+        (*m_ssBlock) << "AcDbArc" << '\n';
     }
-    (*m_ssBlock) << " 50" << endl;
-    (*m_ssBlock) << startAngle << endl;  // start angle
-    (*m_ssBlock) << " 51" << endl;
-    (*m_ssBlock) << endAngle << endl;  // end angle
+    (*m_ssBlock) << " 50" << '\n';
+    (*m_ssBlock) << startAngle << '\n';  // start angle
+    (*m_ssBlock) << " 51" << '\n';
+    (*m_ssBlock) << endAngle << '\n';  // end angle
 
     putText(dimText,
             toVector3d(textMidPoint),
@@ -1744,6 +1842,15 @@ void CDxfWrite::writeDiametricDimBlock(const double* textMidPoint,
     putArrow(arrowStart, barb1, barb2, m_ssBlock, getBlockHandle(), m_saveBlkRecordHandle);
 }
 
+void CDxfWrite::writeStream(std::ostringstream& content)
+{
+    // Copy the buffer directly instead of making a string of it. Streaming an empty buffer would
+    // set the failbit of the file.
+    if (content.tellp() > 0) {
+        (*m_ofs) << content.rdbuf();
+    }
+}
+
 //***************************
 // writeBlocksSection
 // added by Wandererfan 2018 (wandererfan@gmail.com) for FreeCAD project
@@ -1757,10 +1864,10 @@ void CDxfWrite::writeBlocksSection()
     }
 
     // write blocks content
-    (*m_ofs) << (*m_ssBlock).str();
+    writeStream(*m_ssBlock);
 
-    (*m_ofs) << "  0" << endl;
-    (*m_ofs) << "ENDSEC" << endl;
+    (*m_ofs) << "  0" << '\n';
+    (*m_ofs) << "ENDSEC" << '\n';
 }
 
 //***************************
@@ -1774,11 +1881,11 @@ void CDxfWrite::writeEntitiesSection()
     (*m_ofs) << getPlateFile(fileSpec);
 
     // write entities content
-    (*m_ofs) << (*m_ssEntity).str();
+    writeStream(*m_ssEntity);
 
 
-    (*m_ofs) << "  0" << endl;
-    (*m_ofs) << "ENDSEC" << endl;
+    (*m_ofs) << "  0" << '\n';
+    (*m_ofs) << "ENDSEC" << '\n';
 }
 
 //***************************
@@ -1798,19 +1905,37 @@ void CDxfWrite::writeObjectsSection()
 const DxfUnits DxfUnits::Instance;
 
 CDxfRead::CDxfRead(const std::string& filepath)
-    : m_ifs(new ifstream(filepath))
+    : m_file(std::make_unique<QFile>(QString::fromStdString(filepath)))
 {
-    if (!(*m_ifs)) {
+    if (!m_file->open(QIODevice::ReadOnly)) {
         m_fail = true;
         ImportError("DXF file didn't load\n");
         return;
     }
-    m_ifs->imbue(std::locale("C"));
+    // Records are tokenized in place, so map the whole file. If the file system doesn't allow
+    // this the contents are read into memory instead.
+    qint64 size = m_file->size();
+    if (size == 0) {
+        return;
+    }
+    if (const uchar* data = m_file->map(0, size)) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        m_cursor = reinterpret_cast<const char*>(data);
+    }
+    else {
+        m_buffer.resize(static_cast<std::size_t>(size));
+        if (m_file->read(m_buffer.data(), size) != size) {
+            m_fail = true;
+            ImportError("DXF file didn't load\n");
+            return;
+        }
+        m_cursor = m_buffer.data();
+    }
+    m_end = m_cursor + size;
 }
 
 CDxfRead::~CDxfRead()
 {
-    delete m_ifs;
     // Delete the Layer objects which are referenced by pointer from the Layers table.
     for (auto& pair : Layers) {
         delete pair.second;
@@ -1868,49 +1993,71 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 // Static processing helpers for ProcessCommonEntityAttribute
 void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
+    if (!ParseNumber(object->m_record_data, value)) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
+        value = 0;
     }
     *static_cast<double*>(target) = object->mm(value);
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
+    if (!ParseNumber(object->m_record_data, value)) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
+        value = 0;
     }
     static_cast<std::list<double>*>(target)->push_back(object->mm(value));
 }
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
-    ss >> *static_cast<T*>(target);
-    if (ss.fail()) {
+    if (!ParseNumber(object->m_record_data, *static_cast<T*>(target))) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
         *static_cast<T*>(target) = 0;
         return false;
     }
-    // TODO: Verify nothing it left but whitespace in ss.
+    // TODO: Verify nothing is left but whitespace after the number.
     return true;
 }
+template<typename T>
+bool CDxfRead::ParseNumber(std::string_view text, T& value)
+{
+    // Skip the leading blanks (which stream extraction used to do) and an explicit plus sign
+    // (which std::from_chars does not accept).
+    std::size_t first = text.find_first_not_of(" \t");
+    if (first == std::string_view::npos) {
+        return false;
+    }
+    text.remove_prefix(first);
+    if (text.front() == '+') {
+        text.remove_prefix(1);
+    }
+    if constexpr (std::is_same_v<T, bool>) {
+        int number = 0;
+        if (!ParseNumber(text, number)) {
+            return false;
+        }
+        value = number != 0;
+        return true;
+    }
+#if !defined(__cpp_lib_to_chars)
+    // Not all standard libraries (e.g. libc++) implement std::from_chars for floating-point types.
+    else if constexpr (std::is_floating_point_v<T>) {
+        std::istringstream ss {std::string(text)};
+        ss.imbue(std::locale::classic());
+        ss >> value;
+        return !ss.fail();
+    }
+#endif
+    else {
+        return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+    }
+}
+
 void CDxfRead::ProcessStdString(CDxfRead* object, void* target)
 {
     *static_cast<std::string*>(target) = object->m_record_data;
@@ -2348,6 +2495,27 @@ void CDxfRead::UnsupportedFeature(const char* format, args&&... argValuess)
     }
 }
 
+bool CDxfRead::get_next_line(std::string_view& line)
+{
+    if (m_cursor == m_end) {
+        return false;
+    }
+    auto length = static_cast<std::size_t>(m_end - m_cursor);
+    const char* eol = static_cast<const char*>(std::memchr(m_cursor, '\n', length));
+    const char* next = eol == nullptr ? m_end : eol + 1;
+    if (eol == nullptr) {
+        eol = m_end;
+    }
+    // Remove any carriage return at the end of the line which may occur because of inconsistent
+    // handling of LF vs. CRLF line termination.
+    if (eol != m_cursor && *(eol - 1) == '\r') {
+        --eol;
+    }
+    line = std::string_view(m_cursor, static_cast<std::size_t>(eol - m_cursor));
+    m_cursor = next;
+    return true;
+}
+
 bool CDxfRead::get_next_record()
 {
     if (m_repeat_last_record) {
@@ -2355,39 +2523,31 @@ bool CDxfRead::get_next_record()
         return m_not_eof;
     }
 
+    std::string_view line;
     do {
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(line)) {
             m_not_eof = false;
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
         int temp = 0;
-        if (!ParseValue<int>(this, &temp)) {
+        if (!ParseNumber(line, temp)) {
             ImportError("CDxfRead::get_next_record() Failed to get integer record type from '%s'\n",
-                        m_record_data);
+                        std::string(line));
             return false;
         }
         m_record_type = (eDXFGroupCode_t)temp;
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(line)) {
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
     } while (m_record_type == eComment);
 
-    // Remove any carriage return at the end of m_str which may occur because of inconsistent
-    // handling of LF vs. CRLF line termination.
-    auto last = m_record_data.rbegin();
-    if (last != m_record_data.rend() && *last == '\r') {
-        m_record_data.pop_back();
-    }
     // The code that was here just blindly trimmed leading white space, but if you have, for
     // instance, a TEXT entity whose text starts with spaces, or, more plausibly, a long TEXT entity
     // where the text is broken into one or more type-3 records with a final type-1 and the break
     // happens to be just before a space, this would be wrong.
+    m_record_data.assign(line.data(), line.size());
     return true;
 }
 
@@ -2629,6 +2789,10 @@ void CDxfRead::DoRead(const bool ignore_errors /* = false */)
         return;
     }
 
+    FC_TIME_INIT(t);
+    IndexFile();
+    FC_TIME_LOG(t, "DXF index");
+
     StartImport();
     // Loop reading the sections.
     while (get_next_record()) {
@@ -2650,6 +2814,7 @@ void CDxfRead::DoRead(const bool ignore_errors /* = false */)
         }
     }
     FinishImport();
+    FC_TIME_LOG(t, "DXF read");
 
     // FLush out any unsupported features messages
     if (!m_unsupportedFeaturesNoted.empty()) {
@@ -2663,6 +2828,70 @@ void CDxfRead::DoRead(const bool ignore_errors /* = false */)
     }
 }
 
+void CDxfRead::IndexFile()
+{
+    // This runs over the same buffer as the actual read, so afterwards only the position has to be
+    // restored. Records are not decoded or checked here, get_next_record reports any errors.
+    const char* start = m_cursor;
+    enum
+    {
+        OtherSection,
+        BlocksSection,
+        EntitiesSection
+    } section = OtherSection;
+    bool sectionStart = false;
+    bool inInsert = false;
+    auto remember = [](std::set<std::string, std::less<>>& names, std::string_view name) {
+        if (names.find(name) == names.end()) {
+            names.emplace(name);
+        }
+    };
+
+    std::string_view codeLine;
+    std::string_view value;
+    while (get_next_line(codeLine) && get_next_line(value)) {
+        int code = 0;
+        if (!ParseNumber(codeLine, code)) {
+            break;
+        }
+        switch (code) {
+            case eObjectType:
+                sectionStart = value == "SECTION";
+                inInsert = section != OtherSection && value == "INSERT";
+                if (value == "ENDSEC") {
+                    section = OtherSection;
+                }
+                else if (section == EntitiesSection && value != "VERTEX" && value != "SEQEND") {
+                    ++m_entityCount;
+                }
+                break;
+            case eName:
+                if (sectionStart) {
+                    sectionStart = false;
+                    section = value == "BLOCKS"  ? BlocksSection
+                        : value == "ENTITIES" ? EntitiesSection
+                                              : OtherSection;
+                }
+                else if (inInsert) {
+                    remember(m_referencedBlocks, value);
+                }
+                break;
+            case eLayerName:
+                if (section != OtherSection) {
+                    remember(m_referencedLayers, value);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    m_cursor = start;
+    m_indexed = true;
+    FC_LOG("DXF index: " << m_entityCount << " entities, " << m_referencedBlocks.size()
+                         << " referenced blocks, " << m_referencedLayers.size() << " used layers");
+}
+
 bool CDxfRead::ReadSection()
 {
     if (!get_next_record()) {
@@ -2945,6 +3174,9 @@ bool CDxfRead::ReadLayer()
         ImportError("CDxfRead::ReadLayer() - no layer name\n");
         return false;
     }
+    if (m_skipUnusedLayers && !IsLayerReferenced(layername)) {
+        return true;
+    }
     if ((layerFlags & 0x01) != 0) {
         // Frozen layers are implicitly hidden which we don't do yet.
         // TODO: Should have an import option to omit frozen layers.
@@ -17,8 +17,10 @@
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <Base/Interpreter.h>
@@ -28,6 +30,8 @@
 #include <Base/Color.h>
 #include <Mod/Import/ImportGlobal.h>
 
+class QFile;
+
 // For some reason Cpplint complains about some of the categories used by Clang-tidy
 // However, cpplint also does not seem to use NOLINTE BEGIN and NOLINT END so we must use
 // NOLINT NEXT LINE on each occurrence. [spaces added to avoid being seen by lint]
@@ -291,6 +295,8 @@ protected:
 
     //! copy boiler plate file
     std::string getPlateFile(std::string fileSpec);
+    //! append the contents of a section buffer to the file
+    void writeStream(std::ostringstream& content);
     void setDataDir(const std::string& dirName)
     {
         m_dataDir = dirName;
@@ -317,6 +323,7 @@ protected:
     std::string m_currentBlock;
     std::string m_dataDir;
     std::string m_layerName;
+    std::string m_saveLayerName;
     std::vector<std::string> m_layerList;
     std::vector<std::string> m_blockList;
     std::vector<std::string> m_blkRecordList;
@@ -422,6 +429,13 @@ public:
     void writeDimBlockPreamble();
     void writeBlockTrailer();
 
+    // Definition of a block for geometry that is used repeatedly. All entities written between
+    // beginBlock and endBlock go into the block on layer 0; writeInsert places it in model space
+    // on the current layer.
+    void beginBlock(const std::string& name);
+    void endBlock();
+    void writeInsert(const std::string& blockName, const double* point, double rotation);
+
     void writeHeaderSection();
     void writeTablesSection();
     void writeBlocksSection();
@@ -440,7 +454,12 @@ class ImportExport CDxfRead
 {
 private:
     // Low-level reader members
-    std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    // The file contents are memory-mapped when possible, otherwise they are read into m_buffer.
+    // m_cursor points at the next unread line and m_end past the last byte of the contents.
+    std::unique_ptr<QFile> m_file;
+    std::string m_buffer;
+    const char* m_cursor = nullptr;
+    const char* m_end = nullptr;
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -448,6 +467,13 @@ private:
     int m_line = 0;
     bool m_repeat_last_record = false;
 
+    // Names referenced from the BLOCKS and ENTITIES sections, gathered by IndexFile before the
+    // actual read so that definitions nobody uses can be skipped.
+    bool m_indexed = false;
+    std::set<std::string, std::less<>> m_referencedBlocks;
+    std::set<std::string, std::less<>> m_referencedLayers;
+    std::size_t m_entityCount = 0;
+
     // The scaling from DXF units to millimetres.
     // This does not include the dxfScaling option
     // This has the value 0.0 if no units have been specified.
@@ -524,6 +550,8 @@ protected:
     // Import content on Hidden layers. Note that an INSERT on a hidden layer would still be
     // expanded, but the resulting entities would not appear if placed on a hidden layer.
     bool m_importHiddenLayers = true;
+    // Omit layers that no entity is placed on (dxfSkipUnusedLayers)
+    bool m_skipUnusedLayers = false;
     // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
 
     // TODO: options still to implement:
@@ -548,6 +576,23 @@ protected:
     bool ExplodePolyline(std::list<VertexInfo>&, int flags);
     bool ReadBlockContents();
     bool SkipBlockContents();
+    // Whether an INSERT anywhere in the file refers to the named block. This is always true if the
+    // file has not been indexed.
+    bool IsBlockReferenced(const std::string& name) const
+    {
+        return !m_indexed || m_referencedBlocks.find(name) != m_referencedBlocks.end();
+    }
+    // Whether any entity is placed on the named layer. This is always true if the file has not been
+    // indexed.
+    bool IsLayerReferenced(const std::string& name) const
+    {
+        return !m_indexed || m_referencedLayers.find(name) != m_referencedLayers.end();
+    }
+    // The number of entities in the ENTITIES section, as counted by the index pass
+    std::size_t EntityCount() const
+    {
+        return m_entityCount;
+    }
 
 private:
     // Error-handling control
@@ -565,6 +610,9 @@ private:
     static const std::string LineTypeByBlock;
     static const std::string DefaultLineType;
 
+    // A quick pass over the whole file that only looks at section, entity, block and layer names.
+    void IndexFile();
+
     // Readers for various parts of the DXF file.
     bool ReadSection();
     // Section readers (sections are identified by the type-2 (name) record they start with and each
@@ -655,6 +703,9 @@ private:
     }
     template<typename T>
     static bool ParseValue(CDxfRead* object, void* target);
+    // Locale-independent conversion of a record value, ignoring leading blanks.
+    template<typename T>
+    static bool ParseNumber(std::string_view text, T& value);
 
     bool ProcessAttribute();
     void ProcessAllAttributes();
@@ -664,6 +715,7 @@ private:
     bool ReadBlockInfo();
     bool ResolveEncoding();
 
+    bool get_next_line(std::string_view& line);
     bool get_next_record();
     void repeat_last_record();
 
@@ -242,6 +242,10 @@ private:
                         ocaf.setExpandCompound(
                             static_cast<bool>(Py::Boolean(options.getItem("expandCompound"))));
                     }
+                    if (options.hasKey("mergeDuplicates")) {
+                        ocaf.setMergeDuplicates(
+                            static_cast<bool>(Py::Boolean(options.getItem("mergeDuplicates"))));
+                    }
                     if (options.hasKey("mode")) {
                         ocaf.setMode(static_cast<int>(Py::Long(options.getItem("mode"))));
                     }
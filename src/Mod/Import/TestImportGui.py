@@ -19,7 +19,9 @@
 #                                                                         *
 # **************************************************************************
 
+import json
 import os
+import struct
 import tempfile
 import unittest
 import FreeCAD as App
@@ -89,3 +91,130 @@ class ExportImportTest(unittest.TestCase):
 
         mat = paths.get(2).getTail()
         self.assertEqual(mat.diffuseColor.getNum(), 6)
+
+    def testMergeDuplicates(self):
+        """
+        Import a STEP file that defines the same colored part twice
+        """
+        colors = [
+            (1.0, 0.0, 0.0, 1.0),
+            (1.0, 0.0, 0.0, 1.0),
+            (0.0, 1.0, 0.0, 1.0),
+            (0.0, 1.0, 0.0, 1.0),
+            (1.0, 1.0, 0.0, 1.0),
+            (1.0, 1.0, 0.0, 1.0),
+        ]
+
+        # The repeated definitions must carry the same name to be merged
+        param = App.ParamGet("User parameter:BaseApp/Preferences/Document")
+        duplicateLabels = param.GetBool("DuplicateLabels", False)
+        param.SetBool("DuplicateLabels", True)
+        try:
+            parts = []
+            for i in range(2):
+                part = self.doc.addObject("App::Part", "Part")
+                part.Placement.Base = App.Vector(20 * i, 0, 0)
+                box = part.newObject("Part::Box", "Box")
+                box.Label = "Box"
+                parts.append(part)
+            self.doc.recompute()
+            for part in parts:
+                part.Group[0].ViewObject.DiffuseColor = colors
+
+            ImportGui.export(parts, self.fileName)
+        finally:
+            param.SetBool("DuplicateLabels", duplicateLabels)
+
+        for merge in (True, False):
+            self.doc.clearDocument()
+            ImportGui.insert(
+                name=self.fileName,
+                docName=self.doc.Name,
+                options={"merge": False, "useLinkGroup": True, "mergeDuplicates": merge},
+            )
+            self.doc.recompute()
+
+            features = [o for o in self.doc.Objects if o.isDerivedFrom("Part::Feature")]
+            links = [o for o in self.doc.Objects if o.isDerivedFrom("App::Link")]
+            if merge:
+                self.assertEqual(len(features), 1)
+                self.assertIn(features[0], [link.LinkedObject for link in links])
+            else:
+                self.assertEqual(len(features), 2)
+                self.assertNotIn(features[0], [link.LinkedObject for link in links])
+
+            for feature in features:
+                self.assertEqual(feature.ViewObject.DiffuseColor, colors)
+
+    def testExportGlbLinkArray(self):
+        """
+        Export a link array to glTF and check the part is written once as a tessellated mesh
+        """
+        count = 4
+        box = self.doc.addObject("Part::Box", "Box")
+        # Hide the box so that the 3D view doesn't tessellate it
+        box.Visibility = False
+        array = self.doc.addObject("App::Link", "Array")
+        array.setLink(box)
+        array.ElementCount = count
+        self.doc.recompute()
+
+        fileName = tempfile.gettempdir() + os.sep + "LinkArrayTest.glb"
+        try:
+            ImportGui.export([array], fileName)
+            with open(fileName, "rb") as glb:
+                data = glb.read()
+        finally:
+            if os.path.exists(fileName):
+                os.remove(fileName)
+
+        # 12 bytes header, then the JSON chunk with its length and type
+        magic, _, _ = struct.unpack_from("<4sII", data, 0)
+        self.assertEqual(magic, b"glTF")
+        length, kind = struct.unpack_from("<I4s", data, 12)
+        self.assertEqual(kind, b"JSON")
+        gltf = json.loads(data[20 : 20 + length])
+
+        self.assertEqual(len(gltf["meshes"]), 1)
+        nodes = [node for node in gltf["nodes"] if "mesh" in node]
+        self.assertEqual(len(nodes), count)
+
+        for primitive in gltf["meshes"][0]["primitives"]:
+            accessor = gltf["accessors"][primitive["attributes"]["POSITION"]]
+            self.assertGreater(accessor["count"], 0)
+
+    def testExportColorsParallel(self):
+        """
+        Export face and edge colors with and without the parallel color pass
+        """
+        box = self.doc.addObject("Part::Box", "Box")
+        self.doc.recompute()
+        faceColors = [(0.0, 0.0, 1.0, 1.0)] * 6
+        faceColors[2] = (1.0, 0.0, 0.0, 1.0)
+        lineColors = [(0.0, 0.0, 0.0, 1.0)] * 12
+        lineColors[5] = (0.0, 1.0, 0.0, 1.0)
+        box.ViewObject.DiffuseColor = faceColors
+        box.ViewObject.LineColorArray = lineColors
+
+        param = App.ParamGet("User parameter:BaseApp/Preferences/Mod/Import")
+        parallel = param.GetBool("ExportParallel", False)
+        results = []
+        try:
+            for mode in (False, True):
+                param.SetBool("ExportParallel", mode)
+                doc = App.newDocument()
+                try:
+                    ImportGui.export([box], self.fileName)
+                    ImportGui.insert(name=self.fileName, docName=doc.Name, merge=False)
+                    features = [o for o in doc.Objects if o.isDerivedFrom("Part::Feature")]
+                    self.assertEqual(len(features), 1)
+                    vobj = features[0].ViewObject
+                    results.append((list(vobj.DiffuseColor), list(vobj.LineColorArray)))
+                finally:
+                    App.closeDocument(doc.Name)
+        finally:
+            param.SetBool("ExportParallel", parallel)
+
+        self.assertEqual(results[0], results[1])
+        self.assertEqual(results[0][0], faceColors)
+        self.assertIn((0.0, 1.0, 0.0, 1.0), results[0][1])
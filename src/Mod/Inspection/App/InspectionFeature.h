@@ -46,7 +46,7 @@ class MeshObject;
 }
 namespace Points
 {
-class PointsGrid;
+class PointsSearch;
 }
 namespace Part
 {
@@ -155,8 +155,7 @@ public:
     float getDistance(const Base::Vector3f&) const override;
 
 private:
-    const Points::PointKernel& _rKernel;
-    Points::PointsGrid* _pGrid;
+    Points::PointsSearch* _pSearch;
 };
 
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
@@ -30,6 +30,7 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObjectPy.h>
+#include <Base/Console.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/Interpreter.h>
 #include <Base/PlacementPy.h>
@@ -210,6 +211,8 @@ private:
 
         int exportAmfCompressed(hGrp->GetBool("ExportAmfCompressed", true));
         bool export3mfModel(hGrp->GetBool("Export3mfModel", true));
+        bool export3mfProduction(hGrp->GetBool("Export3mfProduction", false));
+        bool exportParallel(hGrp->GetBool("ExportParallel", false));
 
         static const std::array<const char*, 5> kwList {"objectList",
                                                         "filename",
@@ -269,7 +272,12 @@ private:
             Extension3MFFactory::initialize();
             exporter = std::make_unique<Exporter3MF>(outputFileName,
                                                      Extension3MFFactory::createExtensions());
-            dynamic_cast<Exporter3MF*>(exporter.get())->setForceModel(export3mfModel);
+            auto exporter3mf = dynamic_cast<Exporter3MF*>(exporter.get());
+            exporter3mf->setForceModel(export3mfModel);
+            exporter3mf->setProductionExtension(export3mfProduction);
+        }
+        else if (exportFormat == MeshIO::BSTL) {
+            exporter = std::make_unique<ExporterBinarySTL>(outputFileName);
         }
         else if (exportFormat != MeshIO::Undefined) {
             exporter = std::make_unique<MergeExporter>(outputFileName, exportFormat);
@@ -281,9 +289,19 @@ private:
             throw Py::ValueError(exStr.c_str());
         }
 
-        for (auto it : objectList) {
-            exporter->addObject(it, fTolerance);
-        }
+        exporter->setParallel(exportParallel);
+        exporter->addObjects(objectList, fTolerance);
+
+        const auto& stats = exporter->getStatistics();
+        Base::Console().Log("Mesh export: %zu meshes from %zu shapes, %zu facets in %.3f s "
+                            "(tessellation %.3f s, %.0f facets/s), peak mesh memory %.1f MB\n",
+                            stats.meshes,
+                            stats.tessellated,
+                            stats.facets,
+                            stats.totalTime,
+                            stats.tessellationTime,
+                            stats.totalTime > 0 ? double(stats.facets) / stats.totalTime : 0.0,
+                            double(stats.peakMemory) / (1024.0 * 1024.0));
 
         exporter.reset();  // deletes Exporter, mesh file is written by destructor
 
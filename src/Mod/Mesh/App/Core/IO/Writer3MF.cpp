@@ -22,6 +22,9 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <ostream>
 #include <sstream>
 #endif
@@ -29,24 +32,48 @@
 #include "Core/Evaluation.h"
 #include "Core/MeshKernel.h"
 #include <Base/Tools.h>
+#include <Base/Uuid.h>
 
 #include "Writer3MF.h"
 
 
 using namespace MeshCore;
 
+namespace
+{
+// The XML is formatted into a buffer of this size before it's passed to the zip writer
+constexpr std::size_t bufferSize = 1 << 20;
+// Upper bound for the length of a formatted float or index
+constexpr std::size_t numberSize = 24;
+constexpr const char* rootModel = "3D/3dmodel.model";
+constexpr const char* modelRelationship =
+    "http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel";
+constexpr const char* productionNamespace =
+    "http://schemas.microsoft.com/3dmanufacturing/production/2015/06";
+
+char* appendText(char* pos, std::string_view str)
+{
+    return std::copy(str.begin(), str.end(), pos);
+}
+
+template<typename T>
+char* appendNumber(char* pos, T value)
+{
+    auto res = std::to_chars(pos, pos + numberSize, value);
+    return res.ec == std::errc() ? res.ptr : pos;
+}
+}  // namespace
+
 Writer3MF::Writer3MF(std::ostream& str)
     : zip(str)
 {
-    zip.putNextEntry("3D/3dmodel.model");
-    Initialize(zip);
+    buffer.reserve(bufferSize);
 }
 
 Writer3MF::Writer3MF(const std::string& filename)
     : zip(filename)
 {
-    zip.putNextEntry("3D/3dmodel.model");
-    Initialize(zip);
+    buffer.reserve(bufferSize);
 }
 
 void Writer3MF::SetForceModel(bool model)
@@ -54,31 +81,77 @@ void Writer3MF::SetForceModel(bool model)
     forceModel = model;
 }
 
-void Writer3MF::Initialize(std::ostream& str)
+void Writer3MF::SetProductionExtension(bool on)
+{
+    if (!initialized) {
+        production = on;
+    }
+}
+
+void Writer3MF::SetParallel(bool on)
+{
+    zip.setParallel(on);
+}
+
+void Writer3MF::Initialize()
+{
+    if (initialized) {
+        return;
+    }
+
+    // With the production extension the root model is written at the end
+    // because it only references the parts.
+    initialized = true;
+    if (!production) {
+        zip.putNextEntry(rootModel);
+        WriteHeader(true);
+        Write(" <resources>\n");
+    }
+}
+
+void Writer3MF::WriteHeader(bool root)
 {
-    str << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-           "<model unit=\"millimeter\" xml:lang=\"en-US\" "
-           "xmlns=\"http://schemas.microsoft.com/3dmanufacturing/core/2015/02\">\n"
-           " <metadata name=\"Application\">FreeCAD</metadata>\n";
-    str << Base::blanks(1) << "<resources>\n";
+    Write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+          "<model unit=\"millimeter\" xml:lang=\"en-US\" "
+          "xmlns=\"http://schemas.microsoft.com/3dmanufacturing/core/2015/02\"");
+    if (production) {
+        Write(" xmlns:p=\"");
+        Write(productionNamespace);
+        Write(root ? "\" requiredextensions=\"p\">\n" : "\">\n");
+    }
+    else {
+        Write(">\n");
+    }
+    Write(" <metadata name=\"Application\">FreeCAD</metadata>\n");
 }
 
-void Writer3MF::Finish(std::ostream& str)
+void Writer3MF::Finish()
 {
-    str << Base::blanks(1) << "</resources>\n";
-    str << Base::blanks(1) << "<build>\n";
+    Write(" </resources>\n");
+    if (production) {
+        Write(" <build p:UUID=\"" + Base::Uuid::createUuid() + "\">\n");
+    }
+    else {
+        Write(" <build>\n");
+    }
     for (const auto& it : items) {
-        str << Base::blanks(2) << it;
+        Write(Base::blanks(2));
+        Write(it);
     }
-    str << Base::blanks(1) << "</build>\n";
-    str << "</model>\n";
+    Write(" </build>\n");
+    Write("</model>\n");
+    Flush();
 }
 
 bool Writer3MF::AddMesh(const MeshKernel& mesh, const Base::Matrix4D& mat)
 {
+    Initialize();
     int id = ++objectIndex;
     SaveBuildItem(id, mat);
-    return SaveObject(zip, id, mesh);
+    if (production) {
+        return SaveObjectPart(id, mesh);
+    }
+    return SaveObject(id, GetType(mesh), mesh);
 }
 
 void Writer3MF::AddResource(const Resource3MF& res)
@@ -88,64 +161,143 @@ void Writer3MF::AddResource(const Resource3MF& res)
 
 bool Writer3MF::Save()
 {
-    Finish(zip);
+    Initialize();
+    if (production) {
+        zip.putNextEntry(rootModel);
+        WriteHeader(true);
+        Write(" <resources>\n");
+        for (const auto& it : components) {
+            Write(it);
+        }
+    }
+    Finish();
     zip.closeEntry();
 
-    zip.putNextEntry("_rels/.rels");
-    if (!SaveRels(zip)) {
+    std::stringstream str;
+    if (production) {
+        if (!SaveModelRels(str)) {
+            return false;
+        }
+        WriteEntry("3D/_rels/3dmodel.model.rels", str.str());
+        str.str(std::string());
+    }
+
+    if (!SaveRels(str)) {
         return false;
     }
-    zip.closeEntry();
+    WriteEntry("_rels/.rels", str.str());
+    str.str(std::string());
 
-    zip.putNextEntry("[Content_Types].xml");
-    if (!SaveContent(zip)) {
+    if (!SaveContent(str)) {
         return false;
     }
-    zip.closeEntry();
+    WriteEntry("[Content_Types].xml", str.str());
+
     for (const auto& it : resources) {
-        zip.putNextEntry(it.fileNameInZip);
-        zip.write(it.fileContent.data(), static_cast<std::streamsize>(it.fileContent.size()));
-        zip.closeEntry();
+        WriteEntry(it.fileNameInZip, it.fileContent);
     }
 
-    return true;
+    zip.close();
+    return zip.good();
 }
 
-bool Writer3MF::SaveObject(std::ostream& str, int id, const MeshKernel& mesh) const
+void Writer3MF::WriteEntry(const std::string& name, std::string_view data)
+{
+    zip.putNextEntry(name);
+    zip.write(data);
+    zip.closeEntry();
+}
+
+void Writer3MF::Write(std::string_view str)
+{
+    buffer.append(str);
+    if (buffer.size() >= bufferSize) {
+        Flush();
+    }
+}
+
+void Writer3MF::Flush()
+{
+    zip.write(buffer);
+    buffer.clear();
+}
+
+bool Writer3MF::SaveObjectPart(int id, const MeshKernel& mesh)
+{
+    // Each part is a complete model of its own that is closed before the next mesh is
+    // added, so only the small root model is kept in memory until Save() is called.
+    std::string path = "/3D/Objects/object_" + std::to_string(id) + ".model";
+    std::string type = GetType(mesh);
+
+    zip.putNextEntry(path.substr(1));
+    WriteHeader(false);
+    Write(" <resources>\n");
+    bool ok = SaveObject(id, type, mesh);
+    Write(" </resources>\n");
+    Write(" <build />\n");
+    Write("</model>\n");
+    Flush();
+    zip.closeEntry();
+
+    SaveComponent(id, type, path);
+    parts.push_back(path);
+    return ok;
+}
+
+bool Writer3MF::SaveObject(int id, const std::string& type, const MeshKernel& mesh)
 {
     // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
     const MeshPointArray& rPoints = mesh.GetPoints();
     const MeshFacetArray& rFacets = mesh.GetFacets();
 
-    if (!str || str.bad()) {
+    if (!zip.good()) {
         return false;
     }
 
-    str << Base::blanks(2) << "<object id=\"" << id << "\" type=\"" << GetType(mesh) << "\">\n";
-    str << Base::blanks(3) << "<mesh>\n";
+    Write(Base::blanks(2) + "<object id=\"" + std::to_string(id) + "\"");
+    if (production) {
+        Write(" p:UUID=\"" + Base::Uuid::createUuid() + "\"");
+    }
+    Write(" type=\"" + type + "\">\n");
+    Write(Base::blanks(3) + "<mesh>\n");
+
+    // Vertices and triangles are formatted with std::to_chars which is locale independent
+    // and by far faster than iostreams. A line never exceeds the size of the local array.
+    std::array<char, 128> line {};
 
     // vertices
-    str << Base::blanks(4) << "<vertices>\n";
-    std::size_t index = 0;
-    for (auto it = rPoints.begin(); it != rPoints.end(); ++it, ++index) {
-        str << Base::blanks(5) << "<vertex x=\"" << it->x << "\" y=\"" << it->y << "\" z=\""
-            << it->z << "\" />\n";
+    Write(Base::blanks(4) + "<vertices>\n");
+    for (const auto& it : rPoints) {
+        char* pos = appendText(line.data(), "     <vertex x=\"");
+        pos = appendNumber(pos, it.x);
+        pos = appendText(pos, "\" y=\"");
+        pos = appendNumber(pos, it.y);
+        pos = appendText(pos, "\" z=\"");
+        pos = appendNumber(pos, it.z);
+        pos = appendText(pos, "\" />\n");
+        Write(std::string_view(line.data(), static_cast<std::size_t>(pos - line.data())));
     }
-    str << Base::blanks(4) << "</vertices>\n";
+    Write(Base::blanks(4) + "</vertices>\n");
 
     // facet indices
-    str << Base::blanks(4) << "<triangles>\n";
+    Write(Base::blanks(4) + "<triangles>\n");
     for (const auto& it : rFacets) {
-        str << Base::blanks(5) << "<triangle v1=\"" << it._aulPoints[0] << "\" v2=\""
-            << it._aulPoints[1] << "\" v3=\"" << it._aulPoints[2] << "\" />\n";
+        char* pos = appendText(line.data(), "     <triangle v1=\"");
+        pos = appendNumber(pos, it._aulPoints[0]);
+        pos = appendText(pos, "\" v2=\"");
+        pos = appendNumber(pos, it._aulPoints[1]);
+        pos = appendText(pos, "\" v3=\"");
+        pos = appendNumber(pos, it._aulPoints[2]);
+        pos = appendText(pos, "\" />\n");
+        Write(std::string_view(line.data(), static_cast<std::size_t>(pos - line.data())));
     }
-    str << Base::blanks(4) << "</triangles>\n";
+    Write(Base::blanks(4) + "</triangles>\n");
 
-    str << Base::blanks(3) << "</mesh>\n";
-    str << Base::blanks(2) << "</object>\n";
+    Write(Base::blanks(3) + "</mesh>\n");
+    Write(Base::blanks(2) + "</object>\n");
     // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
 
-    return true;
+    return zip.good();
 }
 
 std::string Writer3MF::GetType(const MeshKernel& mesh) const
@@ -157,10 +309,29 @@ std::string Writer3MF::GetType(const MeshKernel& mesh) const
 void Writer3MF::SaveBuildItem(int id, const Base::Matrix4D& mat)
 {
     std::stringstream str;
-    str << "<item objectid=\"" << id << "\" transform=\"" << DumpMatrix(mat) << "\" />\n";
+    str << "<item objectid=\"" << id << "\"";
+    if (production) {
+        str << " p:UUID=\"" << Base::Uuid::createUuid() << "\"";
+    }
+    str << " transform=\"" << DumpMatrix(mat) << "\" />\n";
     items.push_back(str.str());
 }
 
+void Writer3MF::SaveComponent(int id, const std::string& type, const std::string& path)
+{
+    // The object of the root model has the same id as the object in the part, so
+    // that the build item refers to both.
+    std::stringstream str;
+    str << Base::blanks(2) << "<object id=\"" << id << "\" p:UUID=\"" << Base::Uuid::createUuid()
+        << "\" type=\"" << type << "\">\n";
+    str << Base::blanks(3) << "<components>\n";
+    str << Base::blanks(4) << "<component objectid=\"" << id << "\" p:path=\"" << path
+        << "\" p:UUID=\"" << Base::Uuid::createUuid() << "\" />\n";
+    str << Base::blanks(3) << "</components>\n";
+    str << Base::blanks(2) << "</object>\n";
+    components.push_back(str.str());
+}
+
 std::string Writer3MF::DumpMatrix(const Base::Matrix4D& mat)
 {
     // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -177,6 +348,22 @@ std::string Writer3MF::DumpMatrix(const Base::Matrix4D& mat)
     // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 }
 
+bool Writer3MF::SaveModelRels(std::ostream& str) const
+{
+    // NOLINTBEGIN(modernize-raw-string-literal)
+    int ids = 0;
+    str << "<?xml version='1.0' encoding='UTF-8'?>\n"
+        << "<Relationships "
+           "xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">\n";
+    for (const auto& it : parts) {
+        str << " <Relationship Target=\"" << it << "\" Id=\"rel" << ++ids << "\" Type=\""
+            << modelRelationship << "\" />\n";
+    }
+    str << "</Relationships>\n";
+    return true;
+    // NOLINTEND(modernize-raw-string-literal)
+}
+
 bool Writer3MF::SaveRels(std::ostream& str) const
 {
     // NOLINTBEGIN(modernize-raw-string-literal)
@@ -185,7 +372,7 @@ bool Writer3MF::SaveRels(std::ostream& str) const
         << "<Relationships "
            "xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">\n"
         << " <Relationship Target=\"/3D/3dmodel.model\" Id=\"rel0\""
-        << " Type=\"http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel\" />\n";
+        << " Type=\"" << modelRelationship << "\" />\n";
     for (const auto& it : resources) {
         str << " <Relationship Target=\"" << it.relationshipTarget << "\" Id=\"rel" << ++ids
             << "\" Type=\"" << it.relationshipType << "\" />\n";
@@ -26,7 +26,10 @@
 
 #include <Mod/Mesh/MeshGlobal.h>
 #include <iosfwd>
-#include <zipios++/zipoutputstream.h>
+#include <string>
+#include <vector>
+
+#include "ZipWriter.h"
 
 namespace Base
 {
@@ -70,6 +73,20 @@ public:
      * \param model
      */
     void SetForceModel(bool model);
+    /*!
+     * \brief SetProductionExtension
+     * Writes every mesh object to its own model part (/3D/Objects/object_N.model) as defined
+     * by the 3MF production extension. The root model then only references the parts.
+     * Must be set before the first mesh is added.
+     * \param on
+     */
+    void SetProductionExtension(bool on);
+    /*!
+     * \brief SetParallel
+     * Enables or disables the compression of the zip entries with multiple threads.
+     * \param on
+     */
+    void SetParallel(bool on);
     /*!
      * \brief Add a mesh object resource to the 3MF file.
      * \param mesh The mesh object to be written
@@ -90,21 +107,33 @@ public:
     bool Save();
 
 private:
-    static void Initialize(std::ostream& str);
-    void Finish(std::ostream& str);
+    void Initialize();
+    void WriteHeader(bool root);
+    void Finish();
     std::string GetType(const MeshKernel& mesh) const;
     void SaveBuildItem(int id, const Base::Matrix4D& mat);
+    void SaveComponent(int id, const std::string& type, const std::string& path);
     static std::string DumpMatrix(const Base::Matrix4D& mat);
-    bool SaveObject(std::ostream& str, int id, const MeshKernel& mesh) const;
+    bool SaveObject(int id, const std::string& type, const MeshKernel& mesh);
+    bool SaveObjectPart(int id, const MeshKernel& mesh);
+    bool SaveModelRels(std::ostream& str) const;
     bool SaveRels(std::ostream& str) const;
     bool SaveContent(std::ostream& str) const;
+    void WriteEntry(const std::string& name, std::string_view data);
+    void Write(std::string_view str);
+    void Flush();
 
 private:
-    zipios::ZipOutputStream zip;
+    ZipWriter zip;
+    std::string buffer;
     int objectIndex = 0;
     std::vector<std::string> items;
+    std::vector<std::string> components;
+    std::vector<std::string> parts;
     std::vector<Resource3MF> resources;
     bool forceModel = true;
+    bool production = false;
+    bool initialized = false;
 };
 
 }  // namespace MeshCore
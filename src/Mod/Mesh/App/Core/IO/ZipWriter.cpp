@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <ctime>
+#include <ostream>
+#endif
+
+#include <QThread>
+#include <QtConcurrentMap>
+#include <zlib.h>
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "ZipWriter.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+
+constexpr std::size_t windowSize = 32768;
+constexpr std::size_t defaultBlockSize = 512 * 1024;
+constexpr uint64_t maxSize32 = 0xFFFFFFFF;
+constexpr std::size_t maxEntries16 = 0xFFFF;
+constexpr uint16_t zipVersion = 20;
+constexpr uint16_t methodDeflated = 8;
+
+/// A chunk of an entry that is deflated independently of the others
+struct Block
+{
+    const char* data = nullptr;
+    std::size_t size = 0;
+    const char* dict = nullptr;
+    std::size_t dictSize = 0;
+    int level = Z_DEFAULT_COMPRESSION;
+    bool last = false;
+    bool failed = false;
+    uint32_t crc = 0;
+    std::string output;
+};
+
+void compressBlock(Block& block)
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    auto input = reinterpret_cast<Bytef*>(const_cast<char*>(block.data));
+    block.crc = static_cast<uint32_t>(crc32(0L, input, static_cast<uInt>(block.size)));
+
+    z_stream strm {};
+    if (deflateInit2(&strm, block.level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        block.failed = true;
+        return;
+    }
+    if (block.dictSize > 0) {
+        deflateSetDictionary(&strm,
+                             reinterpret_cast<const Bytef*>(block.dict),
+                             static_cast<uInt>(block.dictSize));
+    }
+
+    // A sync flush ends the block on a byte boundary without setting the final bit,
+    // so the outputs of all blocks can be concatenated to a single deflate stream.
+    const int flush = block.last ? Z_FINISH : Z_SYNC_FLUSH;
+    const std::size_t margin = 64;
+    block.output.resize(deflateBound(&strm, static_cast<uLong>(block.size)) + margin);
+    strm.next_in = input;
+    strm.avail_in = static_cast<uInt>(block.size);
+
+    std::size_t done = 0;
+    int ret = Z_OK;
+    for (;;) {
+        strm.next_out = reinterpret_cast<Bytef*>(block.output.data() + done);
+        strm.avail_out = static_cast<uInt>(block.output.size() - done);
+        ret = deflate(&strm, flush);
+        done = block.output.size() - strm.avail_out;
+        if (ret == Z_STREAM_ERROR || strm.avail_out > 0 || ret == Z_STREAM_END) {
+            break;
+        }
+        block.output.resize(block.output.size() * 2);
+    }
+
+    block.output.resize(done);
+    block.failed = block.last ? ret != Z_STREAM_END : ret != Z_OK;
+    deflateEnd(&strm);
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+void append16(std::string& str, uint16_t value)
+{
+    // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+    str.push_back(static_cast<char>(value & 0xFF));
+    str.push_back(static_cast<char>((value >> 8) & 0xFF));
+    // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+}
+
+void append32(std::string& str, uint32_t value)
+{
+    // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+    append16(str, static_cast<uint16_t>(value & 0xFFFF));
+    append16(str, static_cast<uint16_t>((value >> 16) & 0xFFFF));
+    // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+}
+
+}  // namespace
+
+ZipWriter::ZipWriter(std::ostream& str)
+    : out(str)
+{
+    init();
+}
+
+ZipWriter::ZipWriter(const std::string& filename)
+    : file(std::make_unique<Base::ofstream>(Base::FileInfo(filename),
+                                            std::ios::out | std::ios::binary))
+    , out(*file)
+{
+    if (!out) {
+        throw Base::FileException("Cannot open file", filename.c_str());
+    }
+    init();
+}
+
+ZipWriter::~ZipWriter()
+{
+    try {
+        close();
+    }
+    catch (...) {
+    }
+}
+
+void ZipWriter::init()
+{
+    // The stream may already contain data before the archive
+    std::streampos start = out.tellp();
+    if (start != std::streampos(-1)) {
+        position = static_cast<uint64_t>(start);
+    }
+
+    blockSize = defaultBlockSize;
+    batchSize = static_cast<std::size_t>(std::max(1, QThread::idealThreadCount()) * 2);
+    level = Z_DEFAULT_COMPRESSION;
+
+    // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+    std::time_t now = std::time(nullptr);
+    if (const std::tm* local = std::localtime(&now)) {
+        dosTime = static_cast<uint16_t>((local->tm_hour << 11) | (local->tm_min << 5)
+                                        | (local->tm_sec / 2));
+        dosDate = static_cast<uint16_t>(((local->tm_year - 80) << 9)
+                                        | ((local->tm_mon + 1) << 5) | local->tm_mday);
+    }
+    // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+}
+
+void ZipWriter::setLevel(int value)
+{
+    level = value;
+}
+
+void ZipWriter::setParallel(bool on)
+{
+    parallel = on;
+}
+
+void ZipWriter::putNextEntry(const std::string& name)
+{
+    if (closed) {
+        throw Base::FileException("Cannot add an entry to a closed zip archive");
+    }
+    closeEntry();
+    if (entries.size() >= maxEntries16) {
+        throw Base::FileException("Too many entries in zip archive");
+    }
+
+    Entry entry;
+    entry.name = name;
+    entry.offset = position;
+    entries.push_back(entry);
+
+    // Without seeking the header can only be written once CRC and sizes are known
+    headerPos = out.tellp();
+    seekable = headerPos != std::streampos(-1);
+    if (seekable) {
+        writeLocalHeader(entry);
+    }
+
+    input.clear();
+    dictionary.clear();
+    pending.clear();
+    entryOpen = true;
+}
+
+void ZipWriter::write(const char* data, std::size_t size)
+{
+    if (!entryOpen) {
+        throw Base::FileException("No open entry in zip archive");
+    }
+
+    input.append(data, size);
+    if (input.size() >= blockSize * batchSize) {
+        flushBlocks(false);
+    }
+}
+
+void ZipWriter::closeEntry()
+{
+    if (!entryOpen) {
+        return;
+    }
+
+    flushBlocks(true);
+    entryOpen = false;
+
+    const Entry& entry = entries.back();
+    if (entry.size > maxSize32 || entry.compressedSize > maxSize32
+        || entry.offset + entry.compressedSize > maxSize32) {
+        throw Base::FileException("Zip archive exceeds 4 GB, ZIP64 is not supported");
+    }
+
+    if (seekable) {
+        patchLocalHeader(entry);
+    }
+    else {
+        writeLocalHeader(entry);
+        writeRaw(pending.data(), pending.size());
+        pending.clear();
+    }
+}
+
+void ZipWriter::close()
+{
+    if (closed) {
+        return;
+    }
+
+    closeEntry();
+    writeCentralDirectory();
+    out.flush();
+    closed = true;
+}
+
+bool ZipWriter::good() const
+{
+    return out.good();
+}
+
+void ZipWriter::flushBlocks(bool last)
+{
+    // Unless the entry is closed only complete blocks are compressed, the remainder
+    // is kept for the next batch. An empty entry still needs a final (empty) block.
+    std::size_t count = input.size() / blockSize;
+    if (last && (count * blockSize < input.size() || count == 0)) {
+        ++count;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    std::vector<Block> blocks(count);
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        Block& block = blocks[i];
+        block.data = input.data() + offset;
+        block.size = std::min(blockSize, input.size() - offset);
+        block.level = level;
+        block.last = last && (i + 1 == count);
+        if (i == 0) {
+            block.dict = dictionary.data();
+            block.dictSize = dictionary.size();
+        }
+        else {
+            block.dictSize = std::min(windowSize, blocks[i - 1].size);
+            block.dict = block.data - block.dictSize;
+        }
+        offset += block.size;
+    }
+
+    if (parallel && count > 1) {
+        QtConcurrent::blockingMap(blocks, compressBlock);
+    }
+    else {
+        std::for_each(blocks.begin(), blocks.end(), compressBlock);
+    }
+
+    Entry& entry = entries.back();
+    for (const auto& block : blocks) {
+        if (block.failed) {
+            throw Base::FileException("Failed to compress zip entry", entry.name.c_str());
+        }
+        entry.crc = static_cast<uint32_t>(
+            crc32_combine(entry.crc, block.crc, static_cast<z_off_t>(block.size)));
+        entry.size += block.size;
+        entry.compressedSize += block.output.size();
+        writeCompressed(block.output);
+    }
+
+    std::size_t keep = std::min(windowSize, offset);
+    dictionary.assign(input, offset - keep, keep);
+    input.erase(0, offset);
+}
+
+void ZipWriter::writeRaw(const char* data, std::size_t size)
+{
+    out.write(data, static_cast<std::streamsize>(size));
+    position += size;
+}
+
+void ZipWriter::writeCompressed(const std::string& data)
+{
+    if (seekable) {
+        writeRaw(data.data(), data.size());
+    }
+    else {
+        pending += data;
+    }
+}
+
+void ZipWriter::writeLocalHeader(const Entry& entry)
+{
+    // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+    std::string header;
+    append32(header, 0x04034b50);
+    append16(header, zipVersion);
+    append16(header, 0);  // flags
+    append16(header, methodDeflated);
+    append16(header, dosTime);
+    append16(header, dosDate);
+    append32(header, entry.crc);
+    append32(header, static_cast<uint32_t>(entry.compressedSize));
+    append32(header, static_cast<uint32_t>(entry.size));
+    append16(header, static_cast<uint16_t>(entry.name.size()));
+    append16(header, 0);
+    header += entry.name;
+    writeRaw(header.data(), header.size());
+    // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+}
+
+void ZipWriter::patchLocalHeader(const Entry& entry)
+{
+    // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+    std::string fields;
+    append32(fields, entry.crc);
+    append32(fields, static_cast<uint32_t>(entry.compressedSize));
+    append32(fields, static_cast<uint32_t>(entry.size));
+
+    // CRC and sizes start at offset 14 of the local header
+    std::streampos end = out.tellp();
+    out.seekp(headerPos + std::streamoff(14));
+    out.write(fields.data(), static_cast<std::streamsize>(fields.size()));
+    out.seekp(end);
+    // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+}
+
+void ZipWriter::writeCentralDirectory()
+{
+    // NOLINTBEGIN(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+    uint64_t start = position;
+    std::string dir;
+    for (const auto& entry : entries) {
+        append32(dir, 0x02014b50);
+        append16(dir, zipVersion);  // version made by
+        append16(dir, zipVersion);  // version needed to extract
+        append16(dir, 0);  // flags
+        append16(dir, methodDeflated);
+        append16(dir, dosTime);
+        append16(dir, dosDate);
+        append32(dir, entry.crc);
+        append32(dir, static_cast<uint32_t>(entry.compressedSize));
+        append32(dir, static_cast<uint32_t>(entry.size));
+        append16(dir, static_cast<uint16_t>(entry.name.size()));
+        append16(dir, 0);  // extra field length
+        append16(dir, 0);  // comment length
+        append16(dir, 0);  // disk number
+        append16(dir, 0);  // internal attributes
+        append32(dir, 0);  // external attributes
+        append32(dir, static_cast<uint32_t>(entry.offset));
+        dir += entry.name;
+    }
+
+    if (start + dir.size() > maxSize32) {
+        throw Base::FileException("Zip archive exceeds 4 GB, ZIP64 is not supported");
+    }
+
+    auto dirSize = static_cast<uint32_t>(dir.size());
+    auto numEntries = static_cast<uint16_t>(entries.size());
+    append32(dir, 0x06054b50);
+    append16(dir, 0);  // number of this disk
+    append16(dir, 0);  // disk with the central directory
+    append16(dir, numEntries);
+    append16(dir, numEntries);
+    append32(dir, dirSize);
+    append32(dir, static_cast<uint32_t>(start));
+    append16(dir, 0);  // comment length
+    writeRaw(dir.data(), dir.size());
+    // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+}
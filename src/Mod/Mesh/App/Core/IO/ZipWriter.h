@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_IO_ZIP_WRITER_H
+#define MESH_IO_ZIP_WRITER_H
+
+#include <Mod/Mesh/MeshGlobal.h>
+#include <cstdint>
+#include <ios>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MeshCore
+{
+
+/** Writes a zip archive whose entries are deflated in parallel.
+ *
+ * The data of an entry is collected in blocks that are compressed independently by
+ * a pool of threads, each block primed with the last 32 kB of its predecessor as
+ * dictionary (the approach of pigz). The blocks are concatenated to a single raw
+ * deflate stream, so the result is a regular zip archive readable by any tool.
+ * At most one batch of uncompressed blocks is held in memory at a time, so arbitrarily
+ * large entries can be streamed. CRC and sizes are patched into the local header when
+ * the entry is closed. If the output stream isn't seekable the compressed data of an
+ * entry is kept in memory until then.
+ *
+ * ZIP64 is not supported: a Base::FileException is thrown if an entry or the
+ * archive exceeds 4 GB.
+ */
+class MeshExport ZipWriter
+{
+public:
+    /*!
+     * \brief ZipWriter
+     * Writes the archive to an output stream that must be opened in binary mode.
+     * The archive starts at the current position of the stream. As zip readers
+     * expect offsets from the beginning of the file, the offsets are counted from
+     * the beginning of a seekable stream. If the stream isn't seekable they are
+     * counted from its current position, which then must be the beginning.
+     */
+    explicit ZipWriter(std::ostream& str);
+    /*!
+     * \brief ZipWriter
+     * Creates the file \a filename and writes the archive to it.
+     */
+    explicit ZipWriter(const std::string& filename);
+    /// Closes the archive if not already done.
+    ~ZipWriter();
+
+    ZipWriter(const ZipWriter&) = delete;
+    ZipWriter(ZipWriter&&) = delete;
+    ZipWriter& operator=(const ZipWriter&) = delete;
+    ZipWriter& operator=(ZipWriter&&) = delete;
+
+    /*!
+     * \brief Sets the zlib compression level (0-9) used for the following entries.
+     */
+    void setLevel(int level);
+    /*!
+     * \brief Enables or disables the parallel compression of blocks.
+     */
+    void setParallel(bool on);
+    /*!
+     * \brief Closes the current entry, if any, and starts a new one.
+     */
+    void putNextEntry(const std::string& name);
+    /*!
+     * \brief Appends data to the current entry.
+     */
+    void write(const char* data, std::size_t size);
+    void write(std::string_view data)
+    {
+        write(data.data(), data.size());
+    }
+    /*!
+     * \brief Compresses the pending data of the current entry and completes its local header.
+     */
+    void closeEntry();
+    /*!
+     * \brief Closes the current entry and writes the central directory.
+     */
+    void close();
+    /*!
+     * \brief Returns true if no error occurred on the output stream.
+     */
+    bool good() const;
+
+private:
+    struct Entry
+    {
+        std::string name;
+        uint32_t crc = 0;
+        uint64_t compressedSize = 0;
+        uint64_t size = 0;
+        uint64_t offset = 0;
+    };
+
+    void init();
+    void flushBlocks(bool last);
+    void writeRaw(const char* data, std::size_t size);
+    void writeCompressed(const std::string& data);
+    void writeLocalHeader(const Entry& entry);
+    void patchLocalHeader(const Entry& entry);
+    void writeCentralDirectory();
+
+private:
+    std::unique_ptr<std::ostream> file;
+    std::ostream& out;
+    std::vector<Entry> entries;
+    std::string input;
+    std::string dictionary;
+    std::string pending;
+    std::streampos headerPos;
+    uint64_t position = 0;  // offset from the beginning of the stream
+    std::size_t blockSize = 0;
+    std::size_t batchSize = 0;
+    uint16_t dosTime = 0;
+    uint16_t dosDate = 0;
+    int level = 0;
+    bool parallel = true;
+    bool seekable = false;
+    bool entryOpen = false;
+    bool closed = false;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_ZIP_WRITER_H
@@ -24,12 +24,18 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <bit>
+#include <charconv>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string_view>
 #endif
 
+#include <QThread>
+#include <QtConcurrentMap>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/convert.hpp>
 #include <boost/convert/spirit.hpp>
@@ -140,6 +146,86 @@ private:
     Base::ifstream str;
 };
 
+namespace
+{
+// Number of records formatted by one task of the chunked writers below
+constexpr std::size_t chunkSize = 16384;
+// Upper bound for the length of a float formatted with six decimals
+constexpr std::size_t numberSize = 48;
+
+std::size_t countChunks(std::size_t count)
+{
+    return (count + chunkSize - 1) / chunkSize;
+}
+
+// Formats the records [0, count) chunk by chunk, a batch of chunks at a time in parallel, and
+// writes the chunks in order as single blocks. format(begin, end, data) replaces data with the
+// records [begin, end).
+template<typename Format>
+bool writeChunked(std::ostream& out,
+                  std::size_t count,
+                  Base::SequencerLauncher& seq,
+                  const Format& format)
+{
+    struct Chunk
+    {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::string data;
+    };
+
+    std::size_t batchSize = static_cast<std::size_t>(std::max(1, QThread::idealThreadCount())) * 2;
+    std::vector<Chunk> chunks(std::min(batchSize, countChunks(count)));
+    for (std::size_t begin = 0; begin < count;) {
+        std::size_t used = 0;
+        for (; used < chunks.size() && begin < count; used++, begin += chunkSize) {
+            chunks[used].begin = begin;
+            chunks[used].end = std::min(begin + chunkSize, count);
+        }
+        chunks.resize(used);
+        QtConcurrent::blockingMap(chunks, [&format](Chunk& chunk) {
+            format(chunk.begin, chunk.end, chunk.data);
+        });
+        for (const Chunk& chunk : chunks) {
+            out.write(chunk.data.data(), static_cast<std::streamsize>(chunk.data.size()));
+            seq.next(true);  // allow one to cancel
+        }
+        if (out.bad()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+char* appendText(char* pos, std::string_view str)
+{
+    return std::copy(str.begin(), str.end(), pos);
+}
+
+// Same output as a stream with precision 6, std::ios::fixed and std::ios::showpoint
+char* appendFixed(char* pos, float value)
+{
+    auto res = std::to_chars(pos, pos + numberSize, value, std::chars_format::fixed, 6);
+    return res.ec == std::errc() ? res.ptr : pos;
+}
+
+char* appendVector(char* pos, const Base::Vector3f& vec)
+{
+    pos = appendFixed(pos, vec.x);
+    *pos++ = ' ';
+    pos = appendFixed(pos, vec.y);
+    *pos++ = ' ';
+    return appendFixed(pos, vec.z);
+}
+
+template<typename T>
+char* appendBinary(char* pos, T value)
+{
+    std::memcpy(pos, &value, sizeof(T));
+    return pos + sizeof(T);
+}
+}  // namespace
+
 }  // namespace MeshCore
 
 // --------------------------------------------------------------
@@ -1262,6 +1348,11 @@ void MeshOutput::SetSTLHeaderData(const std::string& header)
     }
 }
 
+const std::string& MeshOutput::GetSTLHeaderData()
+{
+    return stl_header;
+}
+
 std::string MeshOutput::asyWidth = "500";
 std::string MeshOutput::asyHeight = "500";
 
@@ -1578,17 +1669,12 @@ bool MeshOutput::SaveFormat(std::ostream& str, MeshIO::Format fmt) const
 /** Saves the mesh object into an ASCII file. */
 bool MeshOutput::SaveAsciiSTL(std::ostream& output) const
 {
-    MeshFacetIterator clIter(_rclMesh), clEnd(_rclMesh);
-    clIter.Transform(this->_transform);
-    const MeshGeomFacet* pclFacet {};
-
     if (!output || output.bad() || _rclMesh.CountFacets() == 0) {
         return false;
     }
 
-    output.precision(6);
-    output.setf(std::ios::fixed | std::ios::showpoint);
-    Base::SequencerLauncher seq("saving...", _rclMesh.CountFacets() + 1);
+    std::size_t count = _rclMesh.CountFacets();
+    Base::SequencerLauncher seq("saving...", countChunks(count) + 1);
 
     if (this->objectName.empty()) {
         output << "solid Mesh\n";
@@ -1597,26 +1683,33 @@ bool MeshOutput::SaveAsciiSTL(std::ostream& output) const
         output << "solid " << this->objectName << '\n';
     }
 
-    clIter.Begin();
-    clEnd.End();
-    while (clIter < clEnd) {
-        pclFacet = &(*clIter);
-
-        // normal
-        output << "  facet normal " << pclFacet->GetNormal().x << " " << pclFacet->GetNormal().y
-               << " " << pclFacet->GetNormal().z << '\n';
-        output << "    outer loop\n";
+    // The facets are formatted with std::to_chars which is locale independent and much faster
+    // than iostreams
+    auto format = [this](std::size_t begin, std::size_t end, std::string& data) {
+        constexpr std::size_t facetSize = 12 * numberSize + 160;
+        data.resize((end - begin) * facetSize);
+        char* pos = data.data();
+        for (std::size_t i = begin; i < end; i++) {
+            MeshGeomFacet facet = _rclMesh.GetFacet(FacetIndex(i));
+            if (this->apply_transform) {
+                facet.Transform(this->_transform);
+            }
 
-        // vertices
-        for (const auto& pnt : pclFacet->_aclPoints) {
-            output << "      vertex " << pnt.x << " " << pnt.y << " " << pnt.z << '\n';
+            pos = appendText(pos, "  facet normal ");
+            pos = appendVector(pos, facet.GetNormal());
+            pos = appendText(pos, "\n    outer loop\n");
+            for (const auto& pnt : facet._aclPoints) {
+                pos = appendText(pos, "      vertex ");
+                pos = appendVector(pos, pnt);
+                *pos++ = '\n';
+            }
+            pos = appendText(pos, "    endloop\n  endfacet\n");
         }
+        data.resize(pos - data.data());
+    };
 
-        output << "    endloop\n";
-        output << "  endfacet\n";
-
-        ++clIter;
-        seq.next(true);  // allow to cancel
+    if (!writeChunked(output, count, seq, format)) {
+        return false;
     }
 
     output << "endsolid Mesh\n";
@@ -1627,51 +1720,48 @@ bool MeshOutput::SaveAsciiSTL(std::ostream& output) const
 /** Saves the mesh object into a binary file. */
 bool MeshOutput::SaveBinarySTL(std::ostream& output) const
 {
-    MeshFacetIterator clIter(_rclMesh), clEnd(_rclMesh);
-    clIter.Transform(this->_transform);
-    const MeshGeomFacet* pclFacet {};
-    uint16_t usAtt {};
     char szInfo[81];
 
     if (!output || output.bad() /*|| _rclMesh.CountFacets() == 0*/) {
         return false;
     }
 
-    Base::SequencerLauncher seq("saving...", _rclMesh.CountFacets() + 1);
+    std::size_t count = _rclMesh.CountFacets();
+    Base::SequencerLauncher seq("saving...", countChunks(count) + 1);
 
     // stl_header has a length of 80
     strcpy(szInfo, stl_header.c_str());
     output.write(szInfo, std::strlen(szInfo));
 
-    uint32_t uCtFts = (uint32_t)_rclMesh.CountFacets();
+    uint32_t uCtFts = (uint32_t)count;
     output.write((const char*)&uCtFts, sizeof(uCtFts));
 
-    usAtt = 0;
-    clIter.Begin();
-    clEnd.End();
-    while (clIter < clEnd) {
-        pclFacet = &(*clIter);
-        // normal
-        Base::Vector3f normal = pclFacet->GetNormal();
-        output.write((const char*)&(normal.x), sizeof(float));
-        output.write((const char*)&(normal.y), sizeof(float));
-        output.write((const char*)&(normal.z), sizeof(float));
-
-        // vertices
-        for (uint32_t i = 0; i < 3; i++) {
-            output.write((const char*)&(pclFacet->_aclPoints[i].x), sizeof(float));
-            output.write((const char*)&(pclFacet->_aclPoints[i].y), sizeof(float));
-            output.write((const char*)&(pclFacet->_aclPoints[i].z), sizeof(float));
+    // Normals and points of a chunk of facets are computed in parallel into a buffer that is
+    // written as a whole
+    auto format = [this](std::size_t begin, std::size_t end, std::string& data) {
+        // normal, three points and the attribute
+        constexpr std::size_t facetSize = 12 * sizeof(float) + sizeof(uint16_t);
+        data.resize((end - begin) * facetSize);
+        char* pos = data.data();
+        auto put = [&pos](const Base::Vector3f& v) {
+            pos = appendBinary(pos, v.x);
+            pos = appendBinary(pos, v.y);
+            pos = appendBinary(pos, v.z);
+        };
+        for (std::size_t i = begin; i < end; i++) {
+            MeshGeomFacet facet = _rclMesh.GetFacet(FacetIndex(i));
+            if (this->apply_transform) {
+                facet.Transform(this->_transform);
+            }
+            put(facet.GetNormal());
+            put(facet._aclPoints[0]);
+            put(facet._aclPoints[1]);
+            put(facet._aclPoints[2]);
+            pos = appendBinary(pos, uint16_t(0));
         }
+    };
 
-        // attribute
-        output.write((const char*)&usAtt, sizeof(usAtt));
-
-        ++clIter;
-        seq.next(true);  // allow one to cancel
-    }
-
-    return true;
+    return writeChunked(output, count, seq, format);
 }
 
 /** Saves an OBJ file. */
@@ -1971,6 +2061,45 @@ bool MeshOutput::SaveBinaryPLY(std::ostream& out) const
         << "property list uchar int vertex_index\n"
         << "end_header\n";
 
+    if constexpr (std::endian::native == std::endian::little) {
+        Base::SequencerLauncher seq("saving...", countChunks(v_count) + countChunks(f_count) + 1);
+        auto formatVertexes = [&](std::size_t begin, std::size_t end, std::string& data) {
+            std::size_t vertexSize = 3 * sizeof(float) + (saveVertexColor ? 3 : 0);
+            data.resize((end - begin) * vertexSize);
+            char* pos = data.data();
+            for (std::size_t i = begin; i < end; i++) {
+                Base::Vector3f pt = rPoints[i];
+                if (this->apply_transform) {
+                    pt = this->_transform * pt;
+                }
+                pos = appendBinary(pos, pt.x);
+                pos = appendBinary(pos, pt.y);
+                pos = appendBinary(pos, pt.z);
+                if (saveVertexColor) {
+                    const Base::Color& c = _material->diffuseColor[i];
+                    pos = appendBinary(pos, uint8_t(255.0F * c.r));
+                    pos = appendBinary(pos, uint8_t(255.0F * c.g));
+                    pos = appendBinary(pos, uint8_t(255.0F * c.b));
+                }
+            }
+        };
+        auto formatFaces = [&rFacets](std::size_t begin, std::size_t end, std::string& data) {
+            constexpr std::size_t faceSize = 1 + 3 * sizeof(int);
+            data.resize((end - begin) * faceSize);
+            char* pos = data.data();
+            for (std::size_t i = begin; i < end; i++) {
+                const MeshFacet& f = rFacets[i];
+                pos = appendBinary(pos, uint8_t(3));
+                pos = appendBinary(pos, int(f._aulPoints[0]));
+                pos = appendBinary(pos, int(f._aulPoints[1]));
+                pos = appendBinary(pos, int(f._aulPoints[2]));
+            }
+        };
+        return writeChunked(out, v_count, seq, formatVertexes)
+            && writeChunked(out, f_count, seq, formatFaces);
+    }
+
+    // Generic path that also works on big-endian machines
     Base::OutputStream os(out);
     os.setByteOrder(Base::Stream::LittleEndian);
 
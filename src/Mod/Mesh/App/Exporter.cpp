@@ -23,20 +23,27 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cstring>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <vector>
 #endif
 
+#include <QThread>
+#include <QtConcurrentMap>
+
 #include <App/Application.h>
 #include <App/ComplexGeoData.h>
 #include <App/ComplexGeoDataPy.h>
 #include <App/DocumentObject.h>
+#include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
+#include <Base/Profiler.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 #include "Core/Iterator.h"
 #include "Core/IO/Writer3MF.h"
@@ -101,51 +108,213 @@ std::string Exporter::xmlEscape(const std::string& input)
     return out;
 }
 
+namespace
+{
+
+// A sub-object to export together with the matrix and the linked object
+// that provides its geometry
+struct ExportItem
+{
+    App::DocumentObject* sobj {};
+    App::DocumentObject* linked {};
+    Base::Matrix4D matrix;
+};
+
+// The mesh of a linked object shared by all items that refer to it
+struct ExportShape
+{
+    ExportShape() = default;
+    ~ExportShape()
+    {
+        releaseGeometry();
+    }
+
+    ExportShape(const ExportShape&) = delete;
+    ExportShape(ExportShape&&) = delete;
+    ExportShape& operator=(const ExportShape&) = delete;
+    ExportShape& operator=(ExportShape&&) = delete;
+
+    void releaseGeometry()
+    {
+        if (pyobj) {
+            Base::PyGILStateLocker lock;
+            Py_DECREF(pyobj);
+            pyobj = nullptr;
+        }
+        geoData = nullptr;
+        source = nullptr;
+    }
+
+    const App::DocumentObject* linked {};
+    const MeshObject* source {};              // mesh of a mesh feature
+    const Data::ComplexGeoData* geoData {};   // geometry to be tessellated
+    PyObject* pyobj {};                       // owns geoData
+    MeshObject mesh;
+    std::size_t uses {};
+    bool ready {};
+    bool failed {};
+    bool serial {};  // geometry may be shared with other shapes
+};
+
+}  // namespace
+
 int Exporter::addObject(App::DocumentObject* obj, float tol)
 {
-    int count = 0;
-    for (std::string& sub : expandSubObjectNames(obj, subObjectNameCache, 0)) {
-        Base::Matrix4D matrix;
-        auto sobj = obj->getSubObject(sub.c_str(), nullptr, &matrix);
-        auto linked = sobj->getLinkedObject(true, &matrix, false);
-        auto it = meshCache.find(linked);
-        if (it == meshCache.end()) {
-            if (linked->isDerivedFrom<Mesh::Feature>()) {
-                it = meshCache.emplace(linked, static_cast<Mesh::Feature*>(linked)->Mesh.getValue())
-                         .first;
-                it->second.setTransform(matrix);
+    return addObjects({obj}, tol);
+}
+
+int Exporter::addObjects(const std::vector<App::DocumentObject*>& objs, float tol)
+{
+    FC_PROFILE_ZONE("Mesh::Exporter::addObjects");
+    Base::TimeElapsed startTime;
+
+    std::vector<ExportItem> items;
+    std::map<const App::DocumentObject*, ExportShape> shapes;
+    std::vector<ExportShape*> order;  // distinct shapes in the order of their first use
+
+    for (auto obj : objs) {
+        for (std::string& sub : expandSubObjectNames(obj, subObjectNameCache, 0)) {
+            ExportItem item;
+            item.sobj = obj->getSubObject(sub.c_str(), nullptr, &item.matrix);
+            if (!item.sobj) {
+                continue;
             }
-            else {
-                Base::PyGILStateLocker lock;
-                PyObject* pyobj = nullptr;
-                linked->getSubObject("", &pyobj, nullptr, false);
-                if (!pyobj) {
-                    continue;
+            item.linked = item.sobj->getLinkedObject(true, &item.matrix, false);
+            auto res = shapes.try_emplace(item.linked);
+            auto& shape = res.first->second;
+            if (res.second) {
+                shape.linked = item.linked;
+                if (item.linked->isDerivedFrom<Mesh::Feature>()) {
+                    shape.source = &static_cast<Mesh::Feature*>(item.linked)->Mesh.getValue();
                 }
-                if (PyObject_TypeCheck(pyobj, &Data::ComplexGeoDataPy::Type)) {
-                    std::vector<Base::Vector3d> aPoints;
-                    std::vector<Data::ComplexGeoData::Facet> aTopo;
-                    auto geoData =
-                        static_cast<Data::ComplexGeoDataPy*>(pyobj)->getComplexGeoDataPtr();
-                    geoData->getFaces(aPoints, aTopo, tol);
-                    it = meshCache.emplace(linked, MeshObject()).first;
-                    it->second.setFacets(aTopo, aPoints);
-                    it->second.setTransform(matrix);
+                else {
+                    Base::PyGILStateLocker lock;
+                    PyObject* pyobj = nullptr;
+                    item.linked->getSubObject("", &pyobj, nullptr, false);
+                    if (pyobj && PyObject_TypeCheck(pyobj, &Data::ComplexGeoDataPy::Type)) {
+                        if (parallel) {
+                            // Shapes of different objects may share their geometry, and
+                            // tessellating stores the triangulation in it. So, tessellate
+                            // a private copy, or the shape alone if it cannot be copied.
+                            PyObject* copy = PyObject_CallMethod(pyobj, "copy", nullptr);
+                            if (copy && PyObject_TypeCheck(copy, &Data::ComplexGeoDataPy::Type)) {
+                                Py_DECREF(pyobj);
+                                pyobj = copy;
+                            }
+                            else {
+                                Py_XDECREF(copy);
+                                PyErr_Clear();
+                                shape.serial = true;
+                            }
+                        }
+                        shape.pyobj = pyobj;
+                        shape.geoData =
+                            static_cast<Data::ComplexGeoDataPy*>(pyobj)->getComplexGeoDataPtr();
+                    }
+                    else {
+                        Py_XDECREF(pyobj);
+                        shape.ready = true;
+                        shape.failed = true;
+                    }
                 }
-                Py_DECREF(pyobj);
+                order.push_back(&shape);
+            }
+            ++shape.uses;
+            items.push_back(item);
+        }
+    }
+
+    // Meshes are created in batches of a few times the number of threads.
+    // The batch that is due always starts with the shape of the current item
+    // because the shapes are ordered by their first use.
+    const std::size_t batchSize =
+        parallel ? static_cast<std::size_t>(std::max(1, QThread::idealThreadCount()) * 2) : 1;
+    std::size_t next = 0;
+    std::size_t memory = 0;
+
+    auto tessellate = [tol](ExportShape* shape) {
+        try {
+            if (shape->source) {
+                shape->mesh = *shape->source;
             }
+            else {
+                std::vector<Base::Vector3d> points;
+                std::vector<Data::ComplexGeoData::Facet> topo;
+                shape->geoData->getFaces(points, topo, tol);
+                shape->mesh.setFacets(topo, points);
+            }
+        }
+        catch (...) {
+            shape->mesh.clear();
+            shape->failed = true;
         }
-        else if (it->second.getTransform() != matrix) {
-            it->second.setTransform(matrix);
+    };
+
+    int count = 0;
+    for (const auto& item : items) {
+        auto& shape = shapes.at(item.linked);
+        if (!shape.ready) {
+            std::vector<ExportShape*> batch;
+            for (; next < order.size() && batch.size() < batchSize; ++next) {
+                if (!order[next]->ready) {
+                    batch.push_back(order[next]);
+                }
+            }
+
+            Base::TimeElapsed tessellationTime;
+            {
+                FC_PROFILE_ZONE("Mesh::Exporter::tessellate");
+                // The caller usually holds the GIL, e.g. when called from Python
+                std::unique_ptr<Base::PyGILStateRelease> release;
+                if (PyGILState_Check()) {
+                    release = std::make_unique<Base::PyGILStateRelease>();
+                }
+                auto firstSerial = std::stable_partition(batch.begin(), batch.end(), [](auto it) {
+                    return !it->serial;
+                });
+                if (std::distance(batch.begin(), firstSerial) > 1) {
+                    QtConcurrent::blockingMap(batch.begin(), firstSerial, tessellate);
+                }
+                else if (firstSerial != batch.begin()) {
+                    tessellate(batch.front());
+                }
+                std::for_each(firstSerial, batch.end(), tessellate);
+            }
+            stats.tessellationTime +=
+                Base::TimeElapsed::diffTimeF(tessellationTime, Base::TimeElapsed());
+
+            for (auto it : batch) {
+                it->releaseGeometry();
+                it->ready = true;
+                if (it->failed) {
+                    Base::Console().Warning("Failed to create mesh of %s\n",
+                                            it->linked->getFullName().c_str());
+                }
+                else {
+                    memory += it->mesh.getMemSize();
+                    ++stats.tessellated;
+                }
+            }
+            stats.peakMemory = std::max(stats.peakMemory, memory);
         }
 
-        // Add a new mesh
-        if (it != meshCache.end()) {
-            if (addMesh(sobj->Label.getValue(), it->second)) {
+        if (!shape.failed) {
+            shape.mesh.setTransform(item.matrix);
+            if (addMesh(item.sobj->Label.getValue(), shape.mesh)) {
                 ++count;
+                ++stats.meshes;
+                stats.facets += shape.mesh.countFacets();
             }
         }
+
+        // release the mesh after its last use
+        if (--shape.uses == 0 && !shape.failed) {
+            memory -= shape.mesh.getMemSize();
+            shape.mesh.clear();
+        }
     }
+
+    stats.totalTime += Base::TimeElapsed::diffTimeF(startTime, Base::TimeElapsed());
     return count;
 }
 
@@ -237,6 +406,82 @@ bool MergeExporter::addMesh(const char* name, const MeshObject& mesh)
 
 // ----------------------------------------------------------------------------
 
+ExporterBinarySTL::ExporterBinarySTL(const std::string& fileName)
+{
+    throwIfNoPermission(fileName);
+
+    Base::FileInfo fi(fileName);
+    outputStream = std::make_unique<Base::ofstream>(fi, std::ios::out | std::ios::binary);
+
+    // the facet count is a placeholder until write() is called
+    std::string header = MeshOutput::GetSTLHeaderData();
+    header.resize(80, ' ');
+    outputStream->write(header.c_str(), static_cast<std::streamsize>(header.size()));
+    outputStream->write(reinterpret_cast<const char*>(&countFacets), sizeof(countFacets));
+}
+
+ExporterBinarySTL::~ExporterBinarySTL()
+{
+    write();
+}
+
+void ExporterBinarySTL::write()
+{
+    if (outputStream && !outputStream->bad()) {
+        outputStream->seekp(80);
+        outputStream->write(reinterpret_cast<const char*>(&countFacets), sizeof(countFacets));
+    }
+    outputStream.reset();
+}
+
+bool ExporterBinarySTL::addMesh(const char* name, const MeshObject& mesh)
+{
+    boost::ignore_unused(name);
+    if (!outputStream || outputStream->bad()) {
+        return false;
+    }
+
+    const MeshCore::MeshKernel& kernel = mesh.getKernel();
+    if (kernel.CountFacets() == 0) {
+        return false;
+    }
+
+    // normal, three points and the attribute
+    constexpr std::size_t facetSize = 12 * sizeof(float) + sizeof(uint16_t);
+    constexpr std::size_t maxFacets = 4096;
+    std::vector<char> buffer(std::min<std::size_t>(kernel.CountFacets(), maxFacets) * facetSize);
+    char* ptr = buffer.data();
+    auto put = [&ptr](const Base::Vector3f& v) {
+        std::memcpy(ptr, &v.x, 3 * sizeof(float));
+        ptr += 3 * sizeof(float);
+    };
+
+    MeshFacetIterator clIter(kernel);
+    clIter.Transform(mesh.getTransform());
+    for (clIter.Init(); clIter.More(); clIter.Next()) {
+        const MeshGeomFacet& facet = *clIter;
+        put(facet.GetNormal());
+        put(facet._aclPoints[0]);
+        put(facet._aclPoints[1]);
+        put(facet._aclPoints[2]);
+        std::memset(ptr, 0, sizeof(uint16_t));
+        ptr += sizeof(uint16_t);
+
+        if (ptr == buffer.data() + buffer.size()) {
+            outputStream->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            ptr = buffer.data();
+        }
+    }
+    if (ptr != buffer.data()) {
+        outputStream->write(buffer.data(), ptr - buffer.data());
+    }
+
+    countFacets += static_cast<uint32_t>(kernel.CountFacets());
+    return !outputStream->bad();
+}
+
+// ----------------------------------------------------------------------------
+
 AbstractFormatExtensionPtr GuiExtension3MFProducer::create() const
 {
     return nullptr;
@@ -321,6 +566,11 @@ void Exporter3MF::setForceModel(bool model)
     d->writer3mf.SetForceModel(model);
 }
 
+void Exporter3MF::setProductionExtension(bool on)
+{
+    d->writer3mf.SetProductionExtension(on);
+}
+
 void Exporter3MF::write()
 {
     d->writer3mf.Save();
@@ -24,6 +24,7 @@
 #define MESH_EXPORTER_H
 
 #include <map>
+#include <memory>
 #include <ostream>
 #include <vector>
 
@@ -59,8 +60,43 @@ public:
      */
     int addObject(App::DocumentObject* obj, float tol);
 
+    /// Add several objects at once. Returns the number of stuff added.
+    /*!
+     * The sub-objects of all objects are collected first. Then the shapes of
+     * the distinct linked objects are tessellated in parallel batches, in
+     * the order they are used, while the Python GIL is released. As shapes
+     * of different objects may share their geometry, each one is copied
+     * first, and a shape that cannot be copied is tessellated on its own.
+     * Every mesh is passed to addMesh() as soon as it is ready and dropped
+     * after its last use, so only a small window of meshes is kept in memory.
+     * @param objs The objects to export
+     * @param tol The tolerance/accuracy with which to generate the triangle mesh
+     */
+    int addObjects(const std::vector<App::DocumentObject*>& objs, float tol);
+
     virtual bool addMesh(const char* name, const MeshObject& mesh) = 0;
 
+    /// Enables or disables the parallel tessellation of shapes, disabled by default
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
+
+    /// Statistics of the objects added so far
+    struct Statistics
+    {
+        std::size_t meshes = 0;       /**< number of meshes passed to addMesh() */
+        std::size_t tessellated = 0;  /**< number of tessellated shapes */
+        std::size_t facets = 0;       /**< number of facets passed to addMesh() */
+        std::size_t peakMemory = 0;   /**< peak memory of cached meshes in bytes */
+        double tessellationTime = 0;  /**< wall-clock time of tessellation in seconds */
+        double totalTime = 0;         /**< wall-clock time of addObjects() in seconds */
+    };
+    const Statistics& getStatistics() const
+    {
+        return stats;
+    }
+
     Exporter(const Exporter&) = delete;
     Exporter(Exporter&&) = delete;
     Exporter& operator=(const Exporter&) = delete;
@@ -72,7 +108,10 @@ protected:
     void throwIfNoPermission(const std::string&);
 
     std::map<const App::DocumentObject*, std::vector<std::string>> subObjectNameCache;
-    std::map<const App::DocumentObject*, MeshObject> meshCache;
+
+private:
+    Statistics stats;
+    bool parallel {false};
 };
 
 /// Creates a single mesh, in a file, from one or more objects
@@ -100,6 +139,34 @@ protected:
     // NOLINTEND
 };
 
+/// Writes a binary STL file facet by facet
+/*!
+ * Unlike MergeExporter no combined mesh is built. The facets of every added
+ * mesh are transformed and appended to the file directly, and the facet count
+ * in the header is updated when the exporter is destroyed.
+ */
+class MeshExport ExporterBinarySTL: public Exporter
+{
+public:
+    explicit ExporterBinarySTL(const std::string& fileName);
+    ~ExporterBinarySTL() override;
+
+    ExporterBinarySTL(const ExporterBinarySTL&) = delete;
+    ExporterBinarySTL(ExporterBinarySTL&&) = delete;
+    ExporterBinarySTL& operator=(const ExporterBinarySTL&) = delete;
+    ExporterBinarySTL& operator=(ExporterBinarySTL&&) = delete;
+
+    bool addMesh(const char* name, const MeshObject& mesh) override;
+
+private:
+    /// Write the final facet count to the header
+    void write();
+
+private:
+    std::unique_ptr<std::ostream> outputStream;
+    uint32_t countFacets {0};
+};
+
 // ------------------------------------------------------------------------------------------------
 
 /*!
@@ -220,6 +287,12 @@ public:
      * \param model
      */
     void setForceModel(bool model);
+    /*!
+     * \brief setProductionExtension
+     * Writes each mesh to its own model part as defined by the 3MF production extension.
+     * \param on
+     */
+    void setProductionExtension(bool on);
 
 private:
     /// Write the meshes of the added objects to the output file
@@ -31,6 +31,7 @@
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Interpreter.h>
+#include <Base/Profiler.h>
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
@@ -929,6 +930,7 @@ void MeshObject::fillupHoles(unsigned long length,
                              int level,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
+    FC_PROFILE_ZONE("MeshObject::fillupHoles");
     std::list<std::vector<PointIndex>> aFailed;
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.FillupHoles(length, level, cTria, aFailed);
@@ -1073,17 +1075,20 @@ void MeshObject::setPoint(PointIndex index, const Base::Vector3d& p)
 
 void MeshObject::smooth(int iterations, float d_max)
 {
+    FC_PROFILE_ZONE("MeshObject::smooth");
     _kernel.Smooth(iterations, d_max);
 }
 
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
+    FC_PROFILE_ZONE("MeshObject::decimate");
     MeshCore::MeshSimplify dm(this->_kernel);
     dm.simplify(fTolerance, fReduction);
 }
 
 void MeshObject::decimate(int targetSize)
 {
+    FC_PROFILE_ZONE("MeshObject::decimate");
     MeshCore::MeshSimplify dm(this->_kernel);
     dm.simplify(targetSize);
 }
@@ -1219,6 +1224,7 @@ void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& n
 
 MeshObject* MeshObject::unite(const MeshObject& mesh) const
 {
+    FC_PROFILE_ZONE("MeshObject::unite");
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
@@ -1235,6 +1241,7 @@ MeshObject* MeshObject::unite(const MeshObject& mesh) const
 
 MeshObject* MeshObject::intersect(const MeshObject& mesh) const
 {
+    FC_PROFILE_ZONE("MeshObject::intersect");
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
@@ -1251,6 +1258,7 @@ MeshObject* MeshObject::intersect(const MeshObject& mesh) const
 
 MeshObject* MeshObject::subtract(const MeshObject& mesh) const
 {
+    FC_PROFILE_ZONE("MeshObject::subtract");
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
@@ -1267,6 +1275,7 @@ MeshObject* MeshObject::subtract(const MeshObject& mesh) const
 
 MeshObject* MeshObject::inner(const MeshObject& mesh) const
 {
+    FC_PROFILE_ZONE("MeshObject::inner");
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
@@ -1283,6 +1292,7 @@ MeshObject* MeshObject::inner(const MeshObject& mesh) const
 
 MeshObject* MeshObject::outer(const MeshObject& mesh) const
 {
+    FC_PROFILE_ZONE("MeshObject::outer");
     MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
@@ -1338,6 +1348,7 @@ MeshObject::section(const MeshObject& mesh, bool connectLines, float fMinDist) c
 
 void MeshObject::refine()
 {
+    FC_PROFILE_ZONE("MeshObject::refine");
     unsigned long cnt = _kernel.CountFacets();
     MeshCore::MeshFacetIterator cF(_kernel);
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
@@ -1373,6 +1384,7 @@ void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
+    FC_PROFILE_ZONE("MeshObject::optimizeTopology");
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     if (fMaxAngle > 0.0F) {
         topalg.OptimizeTopology(fMaxAngle);
@@ -1500,6 +1512,7 @@ void MeshObject::flipNormals()
 
 void MeshObject::harmonizeNormals()
 {
+    FC_PROFILE_ZONE("MeshObject::harmonizeNormals");
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.HarmonizeNormals();
 }
@@ -1568,6 +1581,7 @@ MeshObject::getSelfIntersections(const MeshObject::TFacePairs& facets) const
 
 void MeshObject::removeSelfIntersections()
 {
+    FC_PROFILE_ZONE("MeshObject::removeSelfIntersections");
     std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
     MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
     cMeshEval.GetIntersections(selfIntersections);
@@ -744,27 +744,40 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
-    _meshObject = mesh;
+    resetMeshObject(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
-    *_meshObject = mesh;
+    if (_meshObject.getRefCount() > 1) {
+        resetMeshObject(new MeshObject(mesh));
+    }
+    else {
+        *_meshObject = mesh;
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
-    _meshObject->setKernel(mesh);
+    if (_meshObject.getRefCount() > 1) {
+        resetMeshObject(new MeshObject(mesh, _meshObject->getTransform()));
+    }
+    else {
+        _meshObject->setKernel(mesh);
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    if (_meshObject.getRefCount() > 1) {
+        resetMeshObject(new MeshObject());
+    }
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -772,10 +785,30 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    if (_meshObject.getRefCount() > 1) {
+        resetMeshObject(new MeshObject(MeshCore::MeshKernel(), _meshObject->getTransform()));
+    }
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
+void PropertyMeshKernel::detach()
+{
+    // The mesh object may still be referenced by a copy of this property,
+    // e.g. by the undo/redo stack. So, it must not be modified in place.
+    if (_meshObject.getRefCount() > 1) {
+        resetMeshObject(new MeshObject(*_meshObject));
+    }
+}
+
+void PropertyMeshKernel::resetMeshObject(MeshObject* mesh)
+{
+    _meshObject = mesh;
+    if (meshPyObject) {
+        meshPyObject->setTwinPointer(mesh);
+    }
+}
+
 const MeshObject& PropertyMeshKernel::getValue() const
 {
     return *_meshObject;
@@ -807,6 +840,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detach();
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -818,6 +852,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detach();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +861,7 @@ void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detach();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,6 +871,7 @@ void PropertyMeshKernel::setPointIndices(
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detach();
     _meshObject->setTransform(rclTrf);
 }
 
@@ -910,6 +947,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detach();
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -927,23 +965,29 @@ void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detach();
     _meshObject->load(reader);
     hasSetValue();
 }
 
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Share the mesh object, it gets copied on the next modification
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
+    // Note: Share the mesh object, it gets copied on the next modification
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    if (getValuePtr() == prop.getValuePtr()) {
+        return;
+    }
+    // keep the referenced mesh alive until hasSetValue() has been called
+    Base::Reference<MeshObject> tmp(_meshObject);
+    aboutToSetValue();
+    resetMeshObject(static_cast<MeshObject*>(prop._meshObject));
     hasSetValue();
 }
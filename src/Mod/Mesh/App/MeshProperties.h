@@ -316,10 +316,18 @@ public:
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
+    /** The copy shares the mesh object with this property. The mesh data is
+     * only duplicated when one of the two properties gets modified afterwards.
+     */
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
+private:
+    /// Makes sure the mesh object is not shared with a copy of this property before modifying it
+    void detach();
+    void resetMeshObject(MeshObject* mesh);
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
@@ -262,6 +262,16 @@ bool ImportExportSettings::getExpandCompound() const
     return pGroup->GetBool("ExpandCompound", false);
 }
 
+void ImportExportSettings::setMergeDuplicates(bool on)
+{
+    pGroup->SetBool("MergeDuplicates", on);
+}
+
+bool ImportExportSettings::getMergeDuplicates() const
+{
+    return pGroup->GetBool("MergeDuplicates", false);
+}
+
 void ImportExportSettings::setShowProgress(bool on)
 {
     pGroup->SetBool("ShowProgress", on);
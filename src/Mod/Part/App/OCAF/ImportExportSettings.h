@@ -92,6 +92,9 @@ public:
     void setExpandCompound(bool);
     bool getExpandCompound() const;
 
+    void setMergeDuplicates(bool);
+    bool getMergeDuplicates() const;
+
     void setShowProgress(bool);
     bool getShowProgress() const;
 
@@ -74,6 +74,7 @@
 #include <App/Document.h>
 #include <Base/Console.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 #include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 
@@ -928,6 +929,7 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
 
 void ViewProviderPartExt::updateVisual()
 {
+    FC_PROFILE_ZONE_DETAIL("ViewProviderPartExt::updateVisual", getObject()->getFullName());
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
 
@@ -990,7 +992,10 @@ void ViewProviderPartExt::updateVisual()
         meshParams.InParallel = Standard_True;
         meshParams.AllowQualityDecrease = Standard_True;
 
-        BRepMesh_IncrementalMesh(cShape, meshParams);
+        {
+            FC_PROFILE_ZONE("BRepMesh_IncrementalMesh");
+            BRepMesh_IncrementalMesh(cShape, meshParams);
+        }
 
         // We must reset the location here because the transformation data
         // are set in the placement property
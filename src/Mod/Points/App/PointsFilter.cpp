@@ -0,0 +1,284 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#endif
+
+#include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+
+#include <Base/BoundBox.h>
+#include <Base/Exception.h>
+
+#include "Points.h"
+#include "PointsFilter.h"
+#include "PointsSearch.h"
+
+
+using namespace Points;
+
+namespace
+{
+
+// Computes the normal of a point from its neighbours by principal component analysis
+Base::Vector3d estimateNormal(const PointsSearch& search,
+                              const std::vector<std::size_t>& indices,
+                              const Base::Vector3d& point)
+{
+    if (indices.size() < 3) {
+        double nan = std::numeric_limits<double>::quiet_NaN();
+        return Base::Vector3d(nan, nan, nan);
+    }
+
+    Base::Vector3d center;
+    for (std::size_t index : indices) {
+        center += search.getPoint(index);
+    }
+    center /= static_cast<double>(indices.size());
+
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    for (std::size_t index : indices) {
+        Base::Vector3d diff = search.getPoint(index) - center;
+        Eigen::Vector3d vec(diff.x, diff.y, diff.z);
+        covariance += vec * vec.transpose();
+    }
+
+    // the eigenvalues are sorted in increasing order
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+    solver.computeDirect(covariance);
+    Eigen::Vector3d eigenVector = solver.eigenvectors().col(0);
+    Base::Vector3d normal(eigenVector.x(), eigenVector.y(), eigenVector.z());
+
+    // orient the normal towards the viewpoint at the origin
+    if (normal * point > 0.0) {
+        normal = -normal;
+    }
+    return normal;
+}
+
+}  // namespace
+
+PointsFilter::PointsFilter(const PointKernel& kernel)
+    : kernel(kernel)
+{}
+
+PointsFilter::~PointsFilter() = default;
+
+const PointsSearch& PointsFilter::getSearch()
+{
+    if (!search) {
+        search = std::make_unique<PointsSearch>(kernel);
+    }
+    return *search;
+}
+
+PointKernel PointsFilter::voxelGrid(const Base::Vector3d& leafSize) const
+{
+    if (!(leafSize.x > 0.0 && leafSize.y > 0.0 && leafSize.z > 0.0)) {
+        throw Base::ValueError("Leaf size must be positive");
+    }
+
+    struct VoxelPoint
+    {
+        Base::Vector3d point;
+        std::uint64_t key;
+    };
+
+    std::vector<VoxelPoint> points;
+    points.reserve(kernel.size());
+    Base::BoundBox3d boundBox;
+    for (const auto& pnt : kernel) {
+        if (std::isfinite(pnt.x) && std::isfinite(pnt.y) && std::isfinite(pnt.z)) {
+            points.push_back({pnt, 0});
+            boundBox.Add(pnt);
+        }
+    }
+
+    PointKernel result;
+    if (points.empty()) {
+        return result;
+    }
+
+    double numX = std::floor(boundBox.LengthX() / leafSize.x) + 1.0;
+    double numY = std::floor(boundBox.LengthY() / leafSize.y) + 1.0;
+    double numZ = std::floor(boundBox.LengthZ() / leafSize.z) + 1.0;
+    if (numX * numY * numZ > double(std::numeric_limits<std::int64_t>::max())) {
+        throw Base::ValueError("Leaf size is too small for the extent of the points");
+    }
+
+    auto countX = static_cast<std::uint64_t>(numX);
+    auto countY = static_cast<std::uint64_t>(numY);
+    Base::Vector3d minPoint(boundBox.MinX, boundBox.MinY, boundBox.MinZ);
+    QtConcurrent::blockingMap(points, [&](VoxelPoint& value) {
+        Base::Vector3d pos = value.point - minPoint;
+        auto x = static_cast<std::uint64_t>(pos.x / leafSize.x);
+        auto y = static_cast<std::uint64_t>(pos.y / leafSize.y);
+        auto z = static_cast<std::uint64_t>(pos.z / leafSize.z);
+        value.key = (z * countY + y) * countX + x;
+    });
+
+    std::sort(points.begin(), points.end(), [](const VoxelPoint& lhs, const VoxelPoint& rhs) {
+        return lhs.key < rhs.key;
+    });
+
+    struct Voxel
+    {
+        std::size_t begin;
+        std::size_t end;
+        Base::Vector3d center;
+    };
+
+    std::vector<Voxel> voxels;
+    for (std::size_t begin = 0; begin < points.size();) {
+        std::size_t end = begin + 1;
+        while (end < points.size() && points[end].key == points[begin].key) {
+            end++;
+        }
+        voxels.push_back({begin, end, Base::Vector3d()});
+        begin = end;
+    }
+
+    QtConcurrent::blockingMap(voxels, [&points](Voxel& voxel) {
+        for (std::size_t i = voxel.begin; i < voxel.end; i++) {
+            voxel.center += points[i].point;
+        }
+        voxel.center /= static_cast<double>(voxel.end - voxel.begin);
+    });
+
+    result.reserve(voxels.size());
+    for (const auto& voxel : voxels) {
+        result.push_back(voxel.center);
+    }
+    return result;
+}
+
+std::vector<std::size_t> PointsFilter::statisticalOutlierRemoval(std::size_t meanK,
+                                                                 double stdDevMul)
+{
+    if (meanK == 0) {
+        throw Base::ValueError("Number of neighbours must be positive");
+    }
+
+    struct MeanDistance
+    {
+        std::size_t index;
+        double distance;
+    };
+
+    const PointsSearch& index = getSearch();
+    std::vector<MeanDistance> distances(index.size());
+    for (std::size_t i = 0; i < distances.size(); i++) {
+        distances[i] = {i, 0.0};
+    }
+
+    // The nearest point is the point itself. A point with NaN or infinite coordinates isn't
+    // found by the search, it gets a NaN distance.
+    QtConcurrent::blockingMap(distances, [&index, meanK](MeanDistance& value) {
+        std::vector<std::size_t> indices;
+        std::vector<double> sqrDistances;
+        std::size_t count = index.nearest(index.getPoint(value.index),
+                                          meanK + 1,
+                                          indices,
+                                          sqrDistances);
+        double sum = 0.0;
+        for (std::size_t i = 1; i < count; i++) {
+            sum += std::sqrt(sqrDistances[i]);
+        }
+        if (count == 0) {
+            value.distance = std::numeric_limits<double>::quiet_NaN();
+        }
+        else {
+            value.distance = count > 1 ? sum / static_cast<double>(count - 1) : 0.0;
+        }
+    });
+
+    double sum = 0.0;
+    double sqrSum = 0.0;
+    std::size_t valid = 0;
+    for (const auto& it : distances) {
+        if (!std::isnan(it.distance)) {
+            sum += it.distance;
+            sqrSum += it.distance * it.distance;
+            valid++;
+        }
+    }
+
+    // the invalid points are removed as the comparison with NaN fails
+    std::vector<std::size_t> inliers;
+    if (valid < 2) {
+        for (const auto& it : distances) {
+            if (!std::isnan(it.distance)) {
+                inliers.push_back(it.index);
+            }
+        }
+        return inliers;
+    }
+
+    auto num = static_cast<double>(valid);
+    double mean = sum / num;
+    double variance = std::max((sqrSum - sum * sum / num) / (num - 1.0), 0.0);
+    double threshold = mean + stdDevMul * std::sqrt(variance);
+
+    for (const auto& it : distances) {
+        if (it.distance <= threshold) {
+            inliers.push_back(it.index);
+        }
+    }
+    return inliers;
+}
+
+std::vector<Base::Vector3d> PointsFilter::normalEstimation(std::size_t kSearch,
+                                                           double searchRadius)
+{
+    if (kSearch == 0 && !(searchRadius > 0.0)) {
+        throw Base::ValueError("Either the number of neighbours or the search radius must be set");
+    }
+
+    const PointsSearch& index = getSearch();
+    std::vector<Base::Vector3d> normals(index.size());
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        normals[i] = index.getPoint(i);
+    }
+
+    // Each point is replaced by its normal. A point with NaN or infinite coordinates has no
+    // neighbours, so its normal is NaN.
+    QtConcurrent::blockingMap(normals, [&index, kSearch, searchRadius](Base::Vector3d& value) {
+        std::vector<std::size_t> indices;
+        std::vector<double> sqrDistances;
+        if (kSearch > 0) {
+            index.nearest(value, kSearch, indices, sqrDistances);
+        }
+        else {
+            index.radius(value, searchRadius, indices, sqrDistances);
+        }
+        value = estimateNormal(index, indices, value);
+    });
+
+    return normals;
+}
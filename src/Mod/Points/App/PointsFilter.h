@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_FILTER_H
+#define POINTS_FILTER_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+class PointKernel;
+class PointsSearch;
+
+/**
+ * The PointsFilter class implements common algorithms to clean up and analyse scanned point
+ * clouds. All of them run in parallel and work on the points in global coordinates, i.e. with
+ * the placement of the kernel applied.
+ */
+class PointsExport PointsFilter
+{
+public:
+    explicit PointsFilter(const PointKernel& kernel);
+    ~PointsFilter();
+
+    PointsFilter(const PointsFilter&) = delete;
+    PointsFilter(PointsFilter&&) = delete;
+    PointsFilter& operator=(const PointsFilter&) = delete;
+    PointsFilter& operator=(PointsFilter&&) = delete;
+
+    /** Replaces the points inside each box of a grid with the size \a leafSize by their
+     * centroid. Points with NaN or infinite coordinates are ignored.
+     */
+    PointKernel voxelGrid(const Base::Vector3d& leafSize) const;
+    /** Computes for each point the mean distance to its \a meanK nearest neighbours. A point
+     * is an outlier if its mean distance exceeds the average of all mean distances by more than
+     * \a stdDevMul times their standard deviation. Returns the indices of the points that are
+     * not outliers. Points with NaN or infinite coordinates are always removed and don't count
+     * for the statistics.
+     */
+    std::vector<std::size_t> statisticalOutlierRemoval(std::size_t meanK, double stdDevMul);
+    /** Estimates the normal of each point as the direction of least variance of its
+     * neighbourhood. The neighbourhood consists of the \a kSearch nearest points or, if
+     * \a kSearch is 0, of the points within \a searchRadius. The normals are oriented towards
+     * the origin. If a neighbourhood has less than three points or the point has NaN or
+     * infinite coordinates the normal is NaN.
+     */
+    std::vector<Base::Vector3d> normalEstimation(std::size_t kSearch, double searchRadius);
+
+private:
+    const PointsSearch& getSearch();
+
+private:
+    const PointKernel& kernel;
+    std::unique_ptr<PointsSearch> search;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_FILTER_H
@@ -22,15 +22,19 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <QtConcurrentMap>
+#include <cmath>
 #include <boost/math/special_functions/fpclassify.hpp>
 #endif
 
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/VectorPy.h>
 
 #include "Points.h"
+#include "PointsSearch.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 #include "PointsPy.h"
 #include "PointsPy.cpp"
@@ -242,6 +246,135 @@ PyObject* PointsPy::fromValid(PyObject* args) const
     }
 }
 
+namespace
+{
+// Converts a Vector, a sequence of Vectors or a Points object into a list of points
+bool getSearchPoints(PyObject* obj, std::vector<Base::Vector3d>& points)
+{
+    if (PyObject_TypeCheck(obj, &(Base::VectorPy::Type))) {
+        points.push_back(*static_cast<Base::VectorPy*>(obj)->getVectorPtr());
+        return true;
+    }
+    if (PyObject_TypeCheck(obj, &(PointsPy::Type))) {
+        const PointKernel* kernel = static_cast<PointsPy*>(obj)->getPointKernelPtr();
+        points.reserve(kernel->size());
+        for (const auto& point : *kernel) {
+            points.push_back(point);
+        }
+        return true;
+    }
+
+    try {
+        Py::Sequence list(obj);
+        points.reserve(list.size());
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            points.push_back(Py::Vector(*it).toVector());
+        }
+        return true;
+    }
+    catch (const Py::Exception&) {
+        PyErr_SetString(PyExc_TypeError,
+                        "either expect\n"
+                        "-- Vector\n"
+                        "-- [Vector,...]\n"
+                        "-- Points");
+        return false;
+    }
+}
+
+using SearchResult = std::pair<std::vector<std::size_t>, std::vector<double>>;
+
+// Runs the search for all points in parallel and converts the results into Python
+template<typename Func>
+PyObject* searchPoints(const std::vector<Base::Vector3d>& points, Func&& func)
+{
+    std::vector<std::pair<Base::Vector3d, SearchResult>> results;
+    results.reserve(points.size());
+    for (const auto& point : points) {
+        results.emplace_back(point, SearchResult());
+    }
+    {
+        // the search doesn't touch any Python object, so other threads may run meanwhile
+        Base::PyGILStateRelease releaser {};
+        QtConcurrent::blockingMap(results, [&func](std::pair<Base::Vector3d, SearchResult>& item) {
+            func(item.first, item.second.first, item.second.second);
+        });
+    }
+
+    Py::List list;
+    for (const auto& it : results) {
+        Py::List indices;
+        Py::List distances;
+        for (std::size_t i = 0; i < it.second.first.size(); i++) {
+            indices.append(Py::Long(static_cast<long>(it.second.first[i])));
+            distances.append(Py::Float(std::sqrt(it.second.second[i])));
+        }
+        list.append(Py::TupleN(indices, distances));
+    }
+    return Py::new_reference_to(list);
+}
+}  // namespace
+
+PyObject* PointsPy::nearestNeighbors(PyObject* args) const
+{
+    PyObject* obj {};
+    int k {};
+    if (!PyArg_ParseTuple(args, "Oi", &obj, &k)) {
+        return nullptr;
+    }
+    if (k < 1) {
+        PyErr_SetString(PyExc_ValueError, "number of neighbors must be positive");
+        return nullptr;
+    }
+
+    std::vector<Base::Vector3d> points;
+    if (!getSearchPoints(obj, points)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        PointsSearch search(*getPointKernelPtr());
+        return searchPoints(points,
+                            [&search, k](const Base::Vector3d& point,
+                                         std::vector<std::size_t>& indices,
+                                         std::vector<double>& sqrDistances) {
+                                search.nearest(point, std::size_t(k), indices, sqrDistances);
+                            });
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::radiusNeighbors(PyObject* args) const
+{
+    PyObject* obj {};
+    double radius {};
+    if (!PyArg_ParseTuple(args, "Od", &obj, &radius)) {
+        return nullptr;
+    }
+    if (radius < 0.0) {
+        PyErr_SetString(PyExc_ValueError, "radius must not be negative");
+        return nullptr;
+    }
+
+    std::vector<Base::Vector3d> points;
+    if (!getSearchPoints(obj, points)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        PointsSearch search(*getPointKernelPtr());
+        return searchPoints(points,
+                            [&search, radius](const Base::Vector3d& point,
+                                              std::vector<std::size_t>& indices,
+                                              std::vector<double>& sqrDistances) {
+                                search.radius(point, radius, indices, sqrDistances);
+                            });
+    }
+    PY_CATCH;
+}
+
 Py::Long PointsPy::getCountPoints() const
 {
     return Py::Long((long)getPointKernelPtr()->size());
@@ -0,0 +1,364 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QThread>
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#endif
+
+#include "Points.h"
+#include "PointsSearch.h"
+
+
+using namespace Points;
+
+namespace
+{
+
+using Range = std::pair<std::size_t, std::size_t>;
+
+/// Calls \a func for all indices in [0, count) from several threads
+template<typename Func>
+void parallelFor(std::size_t count, Func&& func)
+{
+    constexpr std::size_t minBatch = 4096;
+    std::size_t numBatches = std::max<std::size_t>(QThread::idealThreadCount() * 2, 1);
+    std::size_t batchSize = std::max((count + numBatches - 1) / numBatches, minBatch);
+
+    std::vector<Range> ranges;
+    for (std::size_t begin = 0; begin < count; begin += batchSize) {
+        ranges.emplace_back(begin, std::min(begin + batchSize, count));
+    }
+
+    if (ranges.size() == 1) {
+        for (std::size_t i = 0; i < count; i++) {
+            func(i);
+        }
+    }
+    else {
+        QtConcurrent::blockingMap(ranges, [&func](Range& range) {
+            for (std::size_t i = range.first; i < range.second; i++) {
+                func(i);
+            }
+        });
+    }
+}
+
+bool isFinite(const Base::Vector3d& point)
+{
+    return std::isfinite(point.x) && std::isfinite(point.y) && std::isfinite(point.z);
+}
+
+using Neighbour = std::pair<double, std::size_t>;
+
+void splitNeighbours(const std::vector<Neighbour>& neighbours,
+                     std::vector<std::size_t>& indices,
+                     std::vector<double>& sqrDistances)
+{
+    indices.resize(neighbours.size());
+    sqrDistances.resize(neighbours.size());
+    for (std::size_t i = 0; i < neighbours.size(); i++) {
+        sqrDistances[i] = neighbours[i].first;
+        indices[i] = neighbours[i].second;
+    }
+}
+
+}  // namespace
+
+PointsSearch::PointsSearch(const PointKernel& kernel, std::size_t pointsPerCell)
+    : points(kernel.size())
+    , pointsPerCell(pointsPerCell)
+{
+    parallelFor(points.size(), [this, &kernel](std::size_t index) {
+        points[index] = kernel.getPoint(static_cast<int>(index));
+    });
+    build(pointsPerCell);
+}
+
+PointsSearch::PointsSearch(std::vector<Base::Vector3d> pnts, std::size_t pointsPerCell)
+    : points(std::move(pnts))
+    , pointsPerCell(pointsPerCell)
+{
+    build(pointsPerCell);
+}
+
+void PointsSearch::addPoints(const std::vector<Base::Vector3d>& pnts)
+{
+    points.insert(points.end(), pnts.begin(), pnts.end());
+}
+
+void PointsSearch::rebuild()
+{
+    build(pointsPerCell);
+}
+
+void PointsSearch::build(std::size_t ppc)
+{
+    // Points with NaN or infinite coordinates can't be sorted into a cell and are left out
+    std::vector<std::size_t> valid;
+    valid.reserve(points.size());
+    boundBox = Base::BoundBox3d();
+    for (std::size_t index = 0; index < points.size(); index++) {
+        if (isFinite(points[index])) {
+            valid.push_back(index);
+            boundBox.Add(points[index]);
+        }
+    }
+
+    std::size_t count = valid.size();
+
+    std::array<double, 3> length {0.0, 0.0, 0.0};
+    if (count > 0) {
+        length = {boundBox.LengthX(), boundBox.LengthY(), boundBox.LengthZ()};
+    }
+
+    // Only the extended dimensions define the cell size so that planar or linear clouds
+    // don't end up with a single layer of huge cells
+    double maxLength = *std::max_element(length.begin(), length.end());
+    double volume = 1.0;
+    int dimension = 0;
+    for (double len : length) {
+        if (len > maxLength * 1e-6) {
+            volume *= len;
+            dimension++;
+        }
+    }
+
+    double targetSize = double(std::max<std::size_t>(ppc, 1));
+    double numCells = std::max(double(count) / targetSize, 1.0);
+    cellSize = dimension > 0 ? std::pow(volume / numCells, 1.0 / dimension) : 1.0;
+
+    // If the points are clustered, e.g. a scan with a few far outliers, most cells stay empty
+    // and the others get crowded. Then the cells are refined as far as the limit of the total
+    // number of cells permits.
+    double maxCells = 4.0 * double(count) + 64.0;
+    std::vector<std::size_t> cellIds(count);
+    for (int pass = 0;; pass++) {
+        bool limited = false;
+        for (;;) {
+            double total = 1.0;
+            for (int i = 0; i < 3; i++) {
+                cellCount[i] = static_cast<std::size_t>(length[i] / cellSize) + 1;
+                total *= double(cellCount[i]);
+            }
+            if (total <= maxCells) {
+                break;
+            }
+            cellSize *= 1.25;
+            limited = true;
+        }
+
+        parallelFor(count, [this, &cellIds, &valid](std::size_t index) {
+            Cell cell = cellOf(points[valid[index]]);
+            cellIds[index] = cellIndex(cell[0], cell[1], cell[2]);
+        });
+
+        cellStart.assign(cellCount[0] * cellCount[1] * cellCount[2] + 1, 0);
+        for (std::size_t id : cellIds) {
+            cellStart[id + 1]++;
+        }
+
+        if (limited || pass == 3 || count == 0) {
+            break;
+        }
+        auto used = std::count_if(cellStart.begin(), cellStart.end(), [](std::size_t num) {
+            return num > 0;
+        });
+        double occupancy = double(count) / double(used);
+        if (occupancy <= 2.0 * targetSize) {
+            break;
+        }
+        cellSize /= std::cbrt(occupancy / targetSize);
+    }
+
+    // counting sort of the points by their cell, storing their indices into points
+    for (std::size_t i = 1; i < cellStart.size(); i++) {
+        cellStart[i] += cellStart[i - 1];
+    }
+
+    std::vector<std::size_t> fill(cellStart.begin(), cellStart.end() - 1);
+    cellPoints.resize(count);
+    for (std::size_t index = 0; index < count; index++) {
+        cellPoints[fill[cellIds[index]]++] = valid[index];
+    }
+}
+
+PointsSearch::Cell PointsSearch::cellOf(const Base::Vector3d& point) const
+{
+    auto toCell = [this](double value, double min, std::size_t num) -> std::size_t {
+        double pos = (value - min) / cellSize;
+        if (!(pos > 0.0)) {
+            return 0;
+        }
+        return std::min(static_cast<std::size_t>(std::min(pos, double(num))), num - 1);
+    };
+
+    return {toCell(point.x, boundBox.MinX, cellCount[0]),
+            toCell(point.y, boundBox.MinY, cellCount[1]),
+            toCell(point.z, boundBox.MinZ, cellCount[2])};
+}
+
+bool PointsSearch::nearest(const Base::Vector3d& point, std::size_t& index, double& distance) const
+{
+    std::vector<std::size_t> indices;
+    std::vector<double> sqrDistances;
+    if (nearest(point, 1, indices, sqrDistances) == 0) {
+        return false;
+    }
+
+    index = indices.front();
+    distance = std::sqrt(sqrDistances.front());
+    return true;
+}
+
+std::size_t PointsSearch::nearest(const Base::Vector3d& point,
+                                  std::size_t k,
+                                  std::vector<std::size_t>& indices,
+                                  std::vector<double>& sqrDistances) const
+{
+    k = std::min(k, cellPoints.size());
+    std::vector<Neighbour> heap;
+    heap.reserve(k);
+    if (k == 0 || !isFinite(point)) {
+        splitNeighbours(heap, indices, sqrDistances);
+        return 0;
+    }
+
+    auto visit = [&](long long x, long long y, long long z) {
+        std::size_t id = cellIndex(std::size_t(x), std::size_t(y), std::size_t(z));
+        for (std::size_t i = cellStart[id]; i < cellStart[id + 1]; i++) {
+            std::size_t idx = cellPoints[i];
+            double dist = Base::DistanceP2(point, points[idx]);
+            if (heap.size() < k) {
+                heap.emplace_back(dist, idx);
+                std::push_heap(heap.begin(), heap.end());
+            }
+            else if (dist < heap.front().first) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = Neighbour(dist, idx);
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+    };
+
+    Cell cell = cellOf(point);
+    std::array<long long, 3> center {};
+    std::array<long long, 3> num {};
+    for (int i = 0; i < 3; i++) {
+        center[i] = static_cast<long long>(cell[i]);
+        num[i] = static_cast<long long>(cellCount[i]);
+    }
+    const std::array<double, 3> pos {point.x, point.y, point.z};
+    const std::array<double, 3> min {boundBox.MinX, boundBox.MinY, boundBox.MinZ};
+
+    // Search the cells in shells of growing Chebyshev distance around the cell of the point
+    for (long long ring = 0;; ring++) {
+        std::array<long long, 3> lower {};
+        std::array<long long, 3> upper {};
+        for (int i = 0; i < 3; i++) {
+            lower[i] = std::max(center[i] - ring, 0LL);
+            upper[i] = std::min(center[i] + ring, num[i] - 1);
+        }
+
+        for (long long z = lower[2]; z <= upper[2]; z++) {
+            bool onShellZ = std::abs(z - center[2]) == ring;
+            for (long long y = lower[1]; y <= upper[1]; y++) {
+                if (onShellZ || std::abs(y - center[1]) == ring) {
+                    for (long long x = lower[0]; x <= upper[0]; x++) {
+                        visit(x, y, z);
+                    }
+                }
+                else {
+                    if (center[0] - ring >= 0) {
+                        visit(center[0] - ring, y, z);
+                    }
+                    if (center[0] + ring < num[0]) {
+                        visit(center[0] + ring, y, z);
+                    }
+                }
+            }
+        }
+
+        // The distance to the nearest cell not yet visited is the distance to the nearest
+        // side of the visited box that doesn't coincide with the border of the grid
+        double bound = std::numeric_limits<double>::max();
+        for (int i = 0; i < 3; i++) {
+            if (center[i] - ring > 0) {
+                bound = std::min(bound, pos[i] - (min[i] + double(center[i] - ring) * cellSize));
+            }
+            if (center[i] + ring < num[i] - 1) {
+                bound =
+                    std::min(bound, (min[i] + double(center[i] + ring + 1) * cellSize) - pos[i]);
+            }
+        }
+
+        if (bound == std::numeric_limits<double>::max()) {
+            break;
+        }
+        if (heap.size() == k && heap.front().first <= bound * bound) {
+            break;
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
+    splitNeighbours(heap, indices, sqrDistances);
+    return heap.size();
+}
+
+std::size_t PointsSearch::radius(const Base::Vector3d& point,
+                                 double radius,
+                                 std::vector<std::size_t>& indices,
+                                 std::vector<double>& sqrDistances) const
+{
+    std::vector<Neighbour> neighbours;
+    if (!cellPoints.empty() && radius >= 0.0 && isFinite(point)) {
+        Base::Vector3d offset(radius, radius, radius);
+        Cell lower = cellOf(point - offset);
+        Cell upper = cellOf(point + offset);
+        double sqrRadius = radius * radius;
+
+        for (std::size_t z = lower[2]; z <= upper[2]; z++) {
+            for (std::size_t y = lower[1]; y <= upper[1]; y++) {
+                for (std::size_t x = lower[0]; x <= upper[0]; x++) {
+                    std::size_t id = cellIndex(x, y, z);
+                    for (std::size_t i = cellStart[id]; i < cellStart[id + 1]; i++) {
+                        std::size_t idx = cellPoints[i];
+                        double dist = Base::DistanceP2(point, points[idx]);
+                        if (dist <= sqrRadius) {
+                            neighbours.emplace_back(dist, idx);
+                        }
+                    }
+                }
+            }
+        }
+
+        std::sort(neighbours.begin(), neighbours.end());
+    }
+
+    splitNeighbours(neighbours, indices, sqrDistances);
+    return neighbours.size();
+}
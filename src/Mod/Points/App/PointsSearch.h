@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_SEARCH_H
+#define POINTS_SEARCH_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+class PointKernel;
+
+/**
+ * The PointsSearch class is a spatial index for exact nearest neighbour and radius queries on a
+ * point cloud.
+ *
+ * The points are sorted into a regular grid of cubic cells that is stored as a flat array: the
+ * indices of all points ordered by cell and the offset of each cell into it. The cell of every
+ * point is computed in parallel, the sorting is a linear counting sort. Compared to the
+ * PointsGrid with its std::set per cell the index is cheap to build and to traverse.
+ *
+ * All queries are const and can be run from several threads at the same time.
+ */
+class PointsExport PointsSearch
+{
+public:
+    /// Default number of points per cell
+    static constexpr std::size_t defaultPointsPerCell = 8;
+
+    /** Builds the index for the points of \a kernel in global coordinates, i.e. with the
+     * placement of the kernel applied. Points with NaN or infinite coordinates keep their index
+     * but are never found by a search.
+     */
+    explicit PointsSearch(const PointKernel& kernel,
+                          std::size_t pointsPerCell = defaultPointsPerCell);
+    /** Builds the index for the given points. */
+    explicit PointsSearch(std::vector<Base::Vector3d> points,
+                          std::size_t pointsPerCell = defaultPointsPerCell);
+
+    /** Rebuilds the index after points were added with addPoints(). */
+    void rebuild();
+    /** Appends points to the index. The new points get the indices following the existing ones
+     * and can be found after the next call of rebuild().
+     */
+    void addPoints(const std::vector<Base::Vector3d>& points);
+
+    /** Returns the number of points including those that can't be found by a search. */
+    std::size_t size() const
+    {
+        return points.size();
+    }
+    /** Returns the point with the given index. */
+    const Base::Vector3d& getPoint(std::size_t index) const
+    {
+        return points[index];
+    }
+    /** Returns the edge length of the cubic cells. */
+    double getCellSize() const
+    {
+        return cellSize;
+    }
+
+    /** @name Search */
+    //@{
+    /** Searches for the point nearest to \a point. Returns false if the index is empty or
+     * \a point has NaN or infinite coordinates.
+     */
+    bool nearest(const Base::Vector3d& point, std::size_t& index, double& distance) const;
+    /** Searches for the \a k points nearest to \a point, sorted by increasing distance. The
+     * squared distances are written to \a sqrDistances. Returns the number of found points which
+     * is less than \a k only if the index has fewer finite points. Nothing is found for a point
+     * with NaN or infinite coordinates.
+     */
+    std::size_t nearest(const Base::Vector3d& point,
+                        std::size_t k,
+                        std::vector<std::size_t>& indices,
+                        std::vector<double>& sqrDistances) const;
+    /** Searches for all points within distance \a radius of \a point, sorted by increasing
+     * distance. The squared distances are written to \a sqrDistances. Returns the number of
+     * found points, i.e. 0 for a point with NaN or infinite coordinates.
+     */
+    std::size_t radius(const Base::Vector3d& point,
+                       double radius,
+                       std::vector<std::size_t>& indices,
+                       std::vector<double>& sqrDistances) const;
+    //@}
+
+private:
+    using Cell = std::array<std::size_t, 3>;
+
+    void build(std::size_t pointsPerCell);
+    Cell cellOf(const Base::Vector3d& point) const;
+    std::size_t cellIndex(std::size_t x, std::size_t y, std::size_t z) const
+    {
+        return (z * cellCount[1] + y) * cellCount[0] + x;
+    }
+
+private:
+    std::vector<Base::Vector3d> points;
+    std::vector<std::size_t> cellStart;
+    /// The indices of the finite points ordered by cell
+    std::vector<std::size_t> cellPoints;
+    Base::BoundBox3d boundBox;
+    Cell cellCount {0, 0, 0};
+    double cellSize {1.0};
+    std::size_t pointsPerCell;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_SEARCH_H
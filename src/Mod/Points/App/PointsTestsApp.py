@@ -0,0 +1,108 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *   Copyright (c) 2025 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+import unittest
+
+import FreeCAD
+import Points
+
+from FreeCAD import Vector
+
+
+class PointsSearchTestCases(unittest.TestCase):
+    def setUp(self):
+        # a grid of 10 x 10 x 10 points with a spacing of 1
+        self.grid = [Vector(x, y, z) for x in range(10) for y in range(10) for z in range(10)]
+        self.points = Points.Points(self.grid)
+
+    def bruteForce(self, point):
+        distances = [(p.distanceToPoint(point), i) for i, p in enumerate(self.grid)]
+        distances.sort()
+        return distances
+
+    def testNearestNeighbors(self):
+        point = Vector(2.1, 3.2, 4.3)
+        result = self.points.nearestNeighbors(point, 5)
+        self.assertEqual(len(result), 1)
+        indices, distances = result[0]
+        self.assertEqual(len(indices), 5)
+        self.assertEqual(distances, sorted(distances))
+
+        expected = self.bruteForce(point)[:5]
+        for index, distance, (expectedDistance, _) in zip(indices, distances, expected):
+            self.assertAlmostEqual(distance, expectedDistance)
+            self.assertAlmostEqual(self.grid[index].distanceToPoint(point), distance)
+        self.assertEqual(indices[0], expected[0][1])
+
+    def testNearestNeighborsOfSeveralPoints(self):
+        query = [Vector(0, 0, 0), Vector(9, 9, 9), Vector(4.4, 4.6, 0.2)]
+        for search in (query, Points.Points(query)):
+            result = self.points.nearestNeighbors(search, 1)
+            self.assertEqual(len(result), len(query))
+            for point, (indices, distances) in zip(query, result):
+                expectedDistance, expectedIndex = self.bruteForce(point)[0]
+                self.assertEqual(indices, [expectedIndex])
+                self.assertAlmostEqual(distances[0], expectedDistance)
+
+    def testNearestNeighborsMoreThanPoints(self):
+        points = Points.Points([Vector(0, 0, 0), Vector(1, 0, 0)])
+        indices, distances = points.nearestNeighbors(Vector(5, 0, 0), 10)[0]
+        self.assertEqual(indices, [1, 0])
+        self.assertAlmostEqual(distances[0], 4.0)
+        self.assertAlmostEqual(distances[1], 5.0)
+
+    def testNearestNeighborsInvalid(self):
+        with self.assertRaises(ValueError):
+            self.points.nearestNeighbors(Vector(), 0)
+        with self.assertRaises(TypeError):
+            self.points.nearestNeighbors("no points", 1)
+
+    def testRadiusNeighbors(self):
+        point = Vector(5.2, 4.9, 5.1)
+        radius = 1.5
+        indices, distances = self.points.radiusNeighbors(point, radius)[0]
+        self.assertEqual(distances, sorted(distances))
+
+        expected = [(d, i) for d, i in self.bruteForce(point) if d <= radius]
+        self.assertEqual(sorted(indices), sorted(i for _, i in expected))
+        for index, distance in zip(indices, distances):
+            self.assertLessEqual(distance, radius)
+            self.assertAlmostEqual(self.grid[index].distanceToPoint(point), distance)
+
+    def testRadiusNeighborsOutside(self):
+        result = self.points.radiusNeighbors([Vector(50, 50, 50), Vector(0, 0, 0)], 0.5)
+        self.assertEqual(result[0], ([], []))
+        self.assertEqual(result[1][0], [0])
+        self.assertAlmostEqual(result[1][1][0], 0.0)
+
+    def testRadiusNeighborsInvalid(self):
+        with self.assertRaises(ValueError):
+            self.points.radiusNeighbors(Vector(), -1.0)
+
+    def testSearchWithPlacement(self):
+        # the search runs in global coordinates
+        self.points.Placement = FreeCAD.Placement(Vector(100, 0, 0), FreeCAD.Rotation())
+        indices, distances = self.points.nearestNeighbors(Vector(100, 0, 0), 1)[0]
+        self.assertEqual(indices, [0])
+        self.assertAlmostEqual(distances[0], 0.0)
+        self.assertEqual(self.points.radiusNeighbors(Vector(), 1.0)[0], ([], []))
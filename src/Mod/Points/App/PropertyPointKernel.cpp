@@ -43,10 +43,22 @@ PropertyPointKernel::PropertyPointKernel()
     : _cPoints(new PointKernel())
 {}
 
+PropertyPointKernel::~PropertyPointKernel()
+{
+    if (pointsPyObject) {
+        Py_DECREF(pointsPyObject);
+    }
+}
+
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
-    *_cPoints = m;
+    if (_cPoints.getRefCount() > 1) {
+        resetPointKernel(new PointKernel(m));
+    }
+    else {
+        *_cPoints = m;
+    }
     hasSetValue();
 }
 
@@ -62,6 +74,7 @@ const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
 
 void PropertyPointKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detach();
     _cPoints->setTransform(rclTrf);
 }
 
@@ -77,9 +90,14 @@ Base::BoundBox3d PropertyPointKernel::getBoundingBox() const
 
 PyObject* PropertyPointKernel::getPyObject()
 {
-    PointsPy* points = new PointsPy(&*_cPoints);
-    points->setConst();  // set immutable
-    return points;
+    if (!pointsPyObject) {
+        // The wrapper is kept to point it to the new points whenever they get replaced
+        pointsPyObject = new PointsPy(&*_cPoints);
+        pointsPyObject->setConst();  // set immutable
+    }
+
+    Py_INCREF(pointsPyObject);
+    return pointsPyObject;
 }
 
 void PropertyPointKernel::setPyObject(PyObject* value)
@@ -115,6 +133,7 @@ void PropertyPointKernel::Restore(Base::XMLReader& reader)
         mtrx.fromString(Matrix);
 
         aboutToSetValue();
+        detach();
         _cPoints->setTransform(mtrx);
         hasSetValue();
     }
@@ -129,22 +148,29 @@ void PropertyPointKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detach();
     _cPoints->RestoreDocFile(reader);
     hasSetValue();
 }
 
 App::Property* PropertyPointKernel::Copy() const
 {
+    // share the points, they get copied on the next modification
     PropertyPointKernel* prop = new PropertyPointKernel();
-    (*prop->_cPoints) = (*this->_cPoints);
+    prop->_cPoints = this->_cPoints;
     return prop;
 }
 
 void PropertyPointKernel::Paste(const App::Property& from)
 {
-    aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
-    *(this->_cPoints) = *(prop._cPoints);
+    if (getComplexData() == prop.getComplexData()) {
+        return;
+    }
+    // keep the referenced points alive until hasSetValue() has been called
+    Base::Reference<PointKernel> tmp(_cPoints);
+    aboutToSetValue();
+    resetPointKernel(prop._cPoints);
     hasSetValue();
 }
 
@@ -156,6 +182,7 @@ unsigned int PropertyPointKernel::getMemSize() const
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detach();
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -199,6 +226,24 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detach();
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
+
+void PropertyPointKernel::detach()
+{
+    // The points may still be referenced by a copy of this property,
+    // e.g. by the undo/redo stack. So, they must not be modified in place.
+    if (_cPoints.getRefCount() > 1) {
+        resetPointKernel(new PointKernel(*_cPoints));
+    }
+}
+
+void PropertyPointKernel::resetPointKernel(PointKernel* points)
+{
+    _cPoints = points;
+    if (pointsPyObject) {
+        pointsPyObject->setTwinPointer(points);
+    }
+}
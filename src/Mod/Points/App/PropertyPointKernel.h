@@ -29,6 +29,8 @@
 namespace Points
 {
 
+class PointsPy;
+
 /** The point kernel property
  */
 class PointsExport PropertyPointKernel: public App::PropertyComplexGeoData
@@ -37,6 +39,7 @@ class PointsExport PropertyPointKernel: public App::PropertyComplexGeoData
 
 public:
     PropertyPointKernel();
+    ~PropertyPointKernel() override;
 
     /** @name Getter/setter */
     //@{
@@ -87,8 +90,14 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+private:
+    /// Makes sure the point kernel is not shared with a copy of this property before modifying it
+    void detach();
+    void resetPointKernel(PointKernel* points);
+
 private:
     Base::Reference<PointKernel> _cPoints;
+    PointsPy* pointsPyObject {nullptr};
 };
 
 }  // namespace Points
@@ -33,12 +33,8 @@
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/Part/App/BSplineSurfacePy.h>
+#include <Mod/Points/App/PointsFilter.h>
 #include <Mod/Points/App/PointsPy.h>
-#if defined(HAVE_PCL_FILTERS)
-#include <pcl/filters/passthrough.h>
-#include <pcl/filters/voxel_grid.h>
-#include <pcl/point_types.h>
-#endif
 
 #include "ApproxSurface.h"
 #include "BSplineFitting.h"
@@ -120,9 +116,16 @@ public:
             "fitBSpline(PointKernel)."
         );
 #endif
-#if defined(HAVE_PCL_FILTERS)
         add_keyword_method("filterVoxelGrid",&Module::filterVoxelGrid,
-            "filterVoxelGrid(dim)."
+            "filterVoxelGrid(Points, DimX, [DimY=DimX, DimZ=DimX]) -> Points\n"
+            "Replaces the points inside each box of the given dimensions by their centroid."
+        );
+        add_keyword_method("statisticalOutlierRemoval",&Module::statisticalOutlierRemoval,
+            "statisticalOutlierRemoval(Points, [MeanK=8, StdDevMul=1.0]) -> Points\n"
+            "MeanK is the number of nearest neighbours used to compute the mean\n"
+            "distance of a point. A point is removed if its mean distance exceeds\n"
+            "the average of all mean distances by more than StdDevMul times their\n"
+            "standard deviation."
         );
         add_keyword_method("normalEstimation",&Module::normalEstimation,
             "normalEstimation(Points,[KSearch=0, SearchRadius=0]) -> Normals\n"
@@ -142,7 +145,6 @@ public:
             "f.ViewObject.Proxy=0\n"
             "f.ViewObject.DisplayMode=1\n"
         );
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
             "regionGrowingSegmentation()."
@@ -749,7 +751,7 @@ Mesh.show(m)
         throw Py::RuntimeError("Computation of B-spline surface failed");
     }
 #endif
-#if defined(HAVE_PCL_FILTERS)
+
     Py::Object filterVoxelGrid(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
@@ -771,29 +773,49 @@ Mesh.show(m)
 
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
 
-        pcl::PointCloud<pcl::PointXYZ>::Ptr cloud (new pcl::PointCloud<pcl::PointXYZ>);
-        cloud->reserve(points->size());
-        for (Points::PointKernel::const_iterator it = points->begin(); it != points->end(); ++it) {
-            cloud->push_back(pcl::PointXYZ(it->x, it->y, it->z));
+        try {
+            Points::PointsFilter filter(*points);
+            Base::Vector3d leafSize(voxDimX, voxDimY, voxDimZ);
+            Points::PointKernel* points_sample = new Points::PointKernel(filter.voxelGrid(leafSize));
+            return Py::asObject(new Points::PointsPy(points_sample));
+        }
+        catch (const Base::Exception& e) {
+            throw Py::ValueError(e.what());
         }
+    }
+
+    Py::Object statisticalOutlierRemoval(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        int meanK = 8;
+        double stdDevMul = 1.0;
+
+        static const std::array<const char*,4> kwds_outlier {"Points", "MeanK", "StdDevMul", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|id", kwds_outlier,
+                                        &(Points::PointsPy::Type), &pts,
+                                        &meanK, &stdDevMul))
+            throw Py::Exception();
 
-        // Create the filtering object
-        pcl::PointCloud<pcl::PointXYZ>::Ptr cloud_downSmpl (new pcl::PointCloud<pcl::PointXYZ>);
-        pcl::VoxelGrid<pcl::PointXYZ> voxG;
-        voxG.setInputCloud (cloud);
-        voxG.setLeafSize (voxDimX, voxDimY, voxDimZ);
-        voxG.filter (*cloud_downSmpl);
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
 
-        Points::PointKernel* points_sample = new Points::PointKernel();
-        points_sample->reserve(cloud_downSmpl->size());
-        for (pcl::PointCloud<pcl::PointXYZ>::const_iterator it = cloud_downSmpl->begin();it!=cloud_downSmpl->end();++it) {
-            points_sample->push_back(Base::Vector3d(it->x,it->y,it->z));
+        std::vector<std::size_t> inliers;
+        try {
+            Points::PointsFilter filter(*points);
+            inliers = filter.statisticalOutlierRemoval(std::max(meanK, 0), stdDevMul);
+        }
+        catch (const Base::Exception& e) {
+            throw Py::ValueError(e.what());
         }
 
-        return Py::asObject(new Points::PointsPy(points_sample));
+        Points::PointKernel* points_inlier = new Points::PointKernel();
+        points_inlier->reserve(inliers.size());
+        for (std::size_t index : inliers) {
+            points_inlier->push_back(points->getPoint(static_cast<int>(index)));
+        }
+
+        return Py::asObject(new Points::PointsPy(points_inlier));
     }
-#endif
-#if defined(HAVE_PCL_FILTERS)
+
     Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
@@ -809,10 +831,15 @@ Mesh.show(m)
         Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
 
         std::vector<Base::Vector3d> normals;
-        NormalEstimation estimate(*points);
-        estimate.setKSearch(ksearch);
-        estimate.setSearchRadius(searchRadius);
-        estimate.perform(normals);
+        try {
+            NormalEstimation estimate(*points);
+            estimate.setKSearch(ksearch);
+            estimate.setSearchRadius(searchRadius);
+            estimate.perform(normals);
+        }
+        catch (const Base::Exception& e) {
+            throw Py::ValueError(e.what());
+        }
 
         Py::List list;
         for (std::vector<Base::Vector3d>::iterator it = normals.begin(); it != normals.end(); ++it) {
@@ -821,7 +848,7 @@ Mesh.show(m)
 
         return list;
     }
-#endif
+
 #if defined(HAVE_PCL_SEGMENTATION)
     Py::Object regionGrowingSegmentation(const Py::Tuple& args, const Py::Dict& kwds)
     {
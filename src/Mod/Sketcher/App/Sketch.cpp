@@ -37,6 +37,7 @@
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/Profiler.h>
 #include <Base/Reader.h>
 #include <Base/TimeInfo.h>
 #include <Base/VectorPy.h>
@@ -4585,6 +4586,7 @@ bool Sketch::updateNonDrivingConstraints()
 
 int Sketch::solve()
 {
+    FC_PROFILE_ZONE("Sketch::solve");
     Base::TimeElapsed start_time;
     std::string solvername;
 
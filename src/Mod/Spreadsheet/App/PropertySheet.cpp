@@ -73,6 +73,8 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    cellToDependantMap.clear();
+    cellToPrecedentMap.clear();
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -289,6 +291,8 @@ PropertySheet::PropertySheet(const PropertySheet& other)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , cellToDependantMap(other.cellToDependantMap)
+    , cellToPrecedentMap(other.cellToPrecedentMap)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
@@ -1386,6 +1390,14 @@ void PropertySheet::addDependencies(CellAddress key)
                 propertyNameToCellMap[propName].insert(key);
                 cellToPropertyNameMap[key].insert(propName);
 
+                if (docObj == owner && !name.empty()) {
+                    CellAddress addr = stringToAddress(name.c_str(), true);
+                    if (addr.isValid()) {
+                        cellToDependantMap[addr].insert(key);
+                        cellToPrecedentMap[key].insert(addr);
+                    }
+                }
+
                 // Also an alias?
                 if (!name.empty() && docObj->isDerivedFrom<Sheet>()) {
                     auto other = static_cast<Sheet*>(docObj);
@@ -1398,6 +1410,11 @@ void PropertySheet::addDependencies(CellAddress key)
                         // Insert into maps
                         propertyNameToCellMap[propName].insert(key);
                         cellToPropertyNameMap[key].insert(std::move(propName));
+
+                        if (other == owner) {
+                            cellToDependantMap[j->second].insert(key);
+                            cellToPrecedentMap[key].insert(j->second);
+                        }
                     }
                 }
             }
@@ -1436,6 +1453,26 @@ void PropertySheet::removeDependencies(CellAddress key)
         cellToPropertyNameMap.erase(i1);
     }
 
+    /* Remove from cell <-> cell maps */
+
+    auto i3 = cellToPrecedentMap.find(key);
+
+    if (i3 != cellToPrecedentMap.end()) {
+        for (const auto& addr : i3->second) {
+            auto k = cellToDependantMap.find(addr);
+
+            if (k != cellToDependantMap.end()) {
+                k->second.erase(key);
+
+                if (k->second.empty()) {
+                    cellToDependantMap.erase(k);
+                }
+            }
+        }
+
+        cellToPrecedentMap.erase(i3);
+    }
+
     /* Remove from DocumentObject <-> Key maps */
 
     std::map<CellAddress, std::set<std::string>>::iterator i2 = cellToDocumentObjectMap.find(key);
@@ -1645,6 +1682,19 @@ const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
     }
 }
 
+const std::set<CellAddress>& PropertySheet::getDependants(CellAddress pos) const
+{
+    static std::set<CellAddress> empty;
+    auto i = cellToDependantMap.find(pos);
+
+    if (i != cellToDependantMap.end()) {
+        return i->second;
+    }
+    else {
+        return empty;
+    }
+}
+
 void PropertySheet::recomputeDependencies(CellAddress key)
 {
     AtomicPropertyChange signaller(*this);
@@ -200,6 +200,8 @@ public:
 
     const std::set<std::string>& getDeps(App::CellAddress pos) const;
 
+    const std::set<App::CellAddress>& getDependants(App::CellAddress pos) const;
+
     void recomputeDependencies(App::CellAddress key);
 
     PyObject* getPyObject() override;
@@ -322,6 +324,15 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
 
+    /*! Cells of this sheet depending on the cell given in key, i.e. the
+      same information as propertyNameToCellMap restricted to this sheet, but
+      kept by address for fast recompute ordering.
+      */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToDependantMap;
+
+    /*! Cells of this sheet the cell given in key depends on */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToPrecedentMap;
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <boost/tokenizer.hpp>
 #include <boost/regex.hpp>
 #include <deque>
@@ -36,11 +37,14 @@
 #include <vector>
 #endif
 
+#include <QtConcurrentMap>
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DynamicProperty.h>
 #include <App/ExpressionParser.h>
 #include <App/FeaturePythonPyImp.h>
+#include <App/PropertyPythonObject.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Reader.h>
@@ -956,6 +960,138 @@ void Sheet::recomputeCell(CellAddress p)
     }
 }
 
+/**
+ * @brief Check whether \a expression only reads properties of plain C++ objects.
+ *
+ * The references are resolved again while evaluating, so reject anything whose
+ * resolution may run Python or follow a link, i.e. sub-objects, links and
+ * objects with a Python proxy. Must be called from the main thread.
+ */
+
+static bool hasNativeReferences(const Expression* expression)
+{
+    for (const auto& v : expression->getIdentifiers()) {
+        const ObjectIdentifier& path = v.first;
+        if (!path.getSubObjectName().empty()) {
+            return false;
+        }
+        const Property* prop = path.getDirectProperty();
+        if (!prop) {
+            return false;
+        }
+        auto owner = freecad_cast<DocumentObject*>(prop->getContainer());
+        if (!owner || owner->isLink()) {
+            return false;
+        }
+        auto proxy = owner->getPropertyByName("Proxy");
+        if (proxy && proxy->isDerivedFrom<PropertyPythonObject>()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Recompute cells not depending on each other.
+ * @param level Addresses of the cells.
+ *
+ * Cells holding a numeric expression that only reads properties of plain C++
+ * objects are evaluated in parallel without Python, see
+ * App::Expression::getNativeValue(). All other cells, and those the native
+ * evaluation gives up on, are recomputed one by one on the main thread.
+ */
+
+void Sheet::recomputeLevel(const std::vector<CellAddress>& level)
+{
+    // Below this the thread overhead outweighs the gain
+    const std::size_t minParallelCells = 64;
+
+    struct NativeResult
+    {
+        CellAddress address;
+        const Expression* expression;
+        App::any value;
+        bool valid;
+    };
+    std::vector<NativeResult> results;
+    if (level.size() >= minParallelCells) {
+        for (const auto& addr : level) {
+            Cell* cell = cells.getValue(addr);
+            if (!cell || cell->hasException()) {
+                continue;
+            }
+            // Compile here, as the compilation itself is not thread safe
+            const Expression* expression = cell->getExpression();
+            if (expression && expression->prepareNativeValue()
+                && hasNativeReferences(expression)) {
+                results.push_back({addr, expression, App::any(), false});
+            }
+        }
+        if (results.size() >= minParallelCells) {
+            QtConcurrent::blockingMap(results, [](NativeResult& res) {
+                res.valid = res.expression->getNativeValue(res.value, true);
+            });
+        }
+        else {
+            results.clear();
+        }
+    }
+
+    auto it = results.begin();
+    for (const auto& addr : level) {
+        FC_TRACE(addr.toString());
+        if (it != results.end() && it->address == addr) {
+            const NativeResult& res = *it++;
+            if (res.valid) {
+                setNativeProperty(addr, res.value);
+                cells.clearDirty(addr);
+                cellErrors.erase(addr);
+                cellUpdated(addr);
+                continue;
+            }
+        }
+        recomputeCell(addr);
+    }
+}
+
+/**
+ * @brief Set the property of cell \a key to a result of App::Expression::getNativeValue().
+ *
+ * The property is the same as updateProperty() gives for the value.
+ */
+
+void Sheet::setNativeProperty(CellAddress key, const App::any& value)
+{
+    if (value.type() == typeid(bool)) {
+        Base::PyGILStateLocker lock;
+        setObjectProperty(key, Py::Boolean(App::any_cast<bool>(value)));
+        return;
+    }
+
+    Base::Quantity quantity;
+    if (value.type() == typeid(Base::Quantity)) {
+        quantity = App::any_cast<const Base::Quantity&>(value);
+    }
+    else if (value.type() == typeid(double)) {
+        quantity = Base::Quantity(App::any_cast<double>(value));
+    }
+    else {
+        quantity = Base::Quantity(static_cast<double>(App::any_cast<long>(value)));
+    }
+
+    NumberExpression number(this, quantity);
+    long l;
+    if (!number.getUnit().isEmpty()) {
+        setQuantityProperty(key, number.getValue(), number.getUnit());
+    }
+    else if (number.isInteger(&l)) {
+        setIntegerProperty(key, l);
+    }
+    else {
+        setFloatProperty(key, number.getValue());
+    }
+}
+
 PropertySheet::BindingType Sheet::getCellBinding(Range& range,
                                                  ExpressionPtr* pStart,
                                                  ExpressionPtr* pEnd,
@@ -1063,56 +1199,68 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
+    // Add the cells depending on the dirty ones
     std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
     while (!workQueue.empty()) {
         CellAddress currPos = workQueue.front();
         workQueue.pop_front();
 
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos, Vertex());
-        if (res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
-        }
-
-        // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep, Vertex());
-            if (resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if (dirtyCells.insert(dep).second) {
-                    workQueue.push_back(dep);
+        for (const auto& dep : cells.getDependants(currPos)) {
+            if (dirtyCells.insert(dep).second) {
+                workQueue.push_back(dep);
+            }
+        }
+    }
+
+    // Sort the cells into levels, where each cell only depends on cells of
+    // the previous levels, so that the cells of one level can be computed in
+    // any order
+    std::map<CellAddress, int> precedents;
+    for (const auto& addr : dirtyCells) {
+        precedents.emplace(addr, 0);
+    }
+    for (const auto& addr : dirtyCells) {
+        for (const auto& dep : cells.getDependants(addr)) {
+            ++precedents[dep];
+        }
+    }
+    std::vector<std::vector<CellAddress>> levels(1);
+    for (const auto& v : precedents) {
+        if (v.second == 0) {
+            levels.back().push_back(v.first);
+        }
+    }
+    std::size_t count = 0;
+    while (!levels.back().empty()) {
+        std::vector<CellAddress> next;
+        for (const auto& addr : levels.back()) {
+            for (const auto& dep : cells.getDependants(addr)) {
+                if (--precedents[dep] == 0) {
+                    next.push_back(dep);
                 }
             }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
         }
+        std::sort(next.begin(), next.end());
+        count += levels.back().size();
+        levels.push_back(std::move(next));
     }
-    // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
-    try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
+    levels.pop_back();
+
+    if (count == dirtyCells.size()) {
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
-            FC_TRACE(addr.toString());
-            recomputeCell(addr);
+        for (const auto& level : levels) {
+            recomputeLevel(level);
         }
     }
-    catch (std::exception&) {
-        for (auto& v : VertexList) {
-            Cell* cell = cells.getValue(v.first);
+    else {
+        for (const auto& addr : dirtyCells) {
+            Cell* cell = cells.getValue(addr);
             // Mark as erroneous
             if (cell) {
-                cellErrors.insert(v.first);
+                cellErrors.insert(addr);
                 cell->setException("Pending computation due to cyclic dependency", true);
-                cellUpdated(v.first);
+                cellUpdated(addr);
             }
         }
 
@@ -1649,7 +1797,7 @@ void Sheet::providesTo(CellAddress address, std::set<std::string>& result) const
 
 std::set<CellAddress> Sheet::providesTo(CellAddress address) const
 {
-    return cells.getDeps(getFullName() + "." + address.toString());
+    return cells.getDependants(address);
 }
 
 void Sheet::onDocumentRestored()
@@ -252,12 +252,16 @@ protected:
 
     void recomputeCell(App::CellAddress p);
 
+    void recomputeLevel(const std::vector<App::CellAddress>& level);
+
     App::Property* getProperty(App::CellAddress key) const;
 
     App::Property* getProperty(const char* addr) const;
 
     void updateProperty(App::CellAddress key);
 
+    void setNativeProperty(App::CellAddress key, const App::any& value);
+
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
     App::Property* setObjectProperty(App::CellAddress key, Py::Object obj);
@@ -3,8 +3,13 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <sstream>
+
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/Expression.h"
+#include "App/FeatureTest.h"
+#include "App/ObjectIdentifier.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +99,103 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, recomputeStatistics)
+{
+    // Arrange
+    auto obj = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Test"));
+    doc()->recompute();
+    EXPECT_EQ(obj->getRecomputeStatistics().executions, 0);
+    doc()->setStatus(App::Document::RecomputeStatistics, true);
+    obj->touch();
+    doc()->recompute();
+    obj->Integer.setValue(4);
+    doc()->recompute();
+    obj->ExceptionType.setValue(1);
+    doc()->recompute();
+
+    // Act
+    const auto& stats = obj->getRecomputeStatistics();
+    std::ostringstream csv;
+    doc()->exportRecomputeStatistics(csv);
+    std::ostringstream json;
+    doc()->exportRecomputeStatistics(json, true);
+
+    // Assert
+    EXPECT_EQ(stats.executions, 3);
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_EQ(stats.touchedBy, "ExceptionType");
+    EXPECT_GE(stats.totalTime, stats.maxTime);
+    EXPECT_GE(stats.maxTime, stats.lastTime);
+    EXPECT_GT(stats.memSize, 0U);
+    EXPECT_THAT(csv.str(), ::testing::StartsWith("Name,Label,Type,Executions,Failures,"));
+    EXPECT_THAT(csv.str(), ::testing::HasSubstr("\nTest,\"Test\",App::FeatureTest,3,1,"));
+    EXPECT_THAT(json.str(), ::testing::HasSubstr("{\"Name\":\"Test\",\"Label\":\"Test\""));
+    EXPECT_THAT(json.str(), ::testing::HasSubstr("\"TouchedBy\":\"ExceptionType\"}"));
+
+    doc()->resetRecomputeStatistics();
+    EXPECT_EQ(obj->getRecomputeStatistics().executions, 0);
+}
+
+TEST_F(DocumentTest, recomputeExpressionChain)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    auto third = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Third"));
+    first->Label.setValue("Source");
+    auto bind = [](App::DocumentObject* obj, const char* expr) {
+        obj->setExpression(App::ObjectIdentifier::parse(obj, "Integer"),
+                           std::shared_ptr<App::Expression>(App::Expression::parse(obj, expr)));
+    };
+    bind(second, "<<Source>>.Integer * 2");
+    bind(third, "Second.Integer + 1");
+    first->Integer.setValue(2);
+    doc()->recompute();
+    EXPECT_EQ(second->Integer.getValue(), 4);
+    EXPECT_EQ(third->Integer.getValue(), 5);
+
+    // Act: change a value used by the chain
+    first->Integer.setValue(5);
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(second->Integer.getValue(), 10);
+    EXPECT_EQ(third->Integer.getValue(), 11);
+
+    // Act: change a value not used by the chain
+    int secondCount = second->ExecCount.getValue();
+    int thirdCount = third->ExecCount.getValue();
+    first->Float.setValue(1.5);
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(second->ExecCount.getValue(), secondCount);
+    EXPECT_EQ(third->ExecCount.getValue(), thirdCount);
+    EXPECT_EQ(second->Integer.getValue(), 10);
+
+    // Act: relabel the source, the binding follows the new label
+    first->Label.setValue("Renamed");
+    first->Integer.setValue(6);
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(second->Integer.getValue(), 12);
+    EXPECT_EQ(third->Integer.getValue(), 13);
+
+    // Act: undo a change of the source
+    doc()->setUndoMode(1);
+    doc()->openTransaction("Change");
+    first->Integer.setValue(8);
+    doc()->commitTransaction();
+    doc()->recompute();
+    EXPECT_EQ(third->Integer.getValue(), 17);
+    EXPECT_TRUE(doc()->undo());
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(first->Integer.getValue(), 6);
+    EXPECT_EQ(second->Integer.getValue(), 12);
+    EXPECT_EQ(third->Integer.getValue(), 13);
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -2,7 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <sstream>
+
 #include <App/Application.h>
+#include <App/Document.h>
 #include <App/ElementMap.h>
 #include <src/App/InitApplication.h>
 
@@ -553,4 +557,136 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
             return e.indexedName.toString() == "Pong2";
         }));
 }
+
+TEST_F(ElementMapTest, replayFeatureChain)
+{
+    // Arrange
+    //   pattern: a body with a long chain of features, each one mapping all
+    //   the faces of its base feature, the way a PartDesign body recomputes
+    constexpr int featureCount = 30;
+    constexpr int faceCount = 50;
+    Data::ElementMapPtr base;
+
+    // Act
+    for (int feature = 1; feature <= featureCount; ++feature) {
+        auto map = std::make_shared<Data::ElementMap>();
+        map->hasher = _hasher;
+        std::ostringstream ss;
+        for (int i = 1; i <= faceCount; ++i) {
+            Data::IndexedName face("Face", i);
+            Data::MappedName name = base ? base->find(face) : Data::MappedName(face);
+            map->encodeElementName('F', name, ss, nullptr, feature, nullptr, feature - 1);
+            map->setElementName(face, name, feature);
+        }
+        // drop and re-add some of the names, as a feature renaming its faces would
+        for (int i = 1; i <= faceCount; i += 10) {
+            Data::IndexedName face("Face", i);
+            Data::MappedName name = map->find(face);
+            map->erase(name);
+            EXPECT_FALSE(map->find(name));
+            map->setElementName(face, name, feature);
+        }
+        base = map;
+    }
+
+    // Assert
+    EXPECT_EQ(base->size(), faceCount);
+    for (int i = 1; i <= faceCount; ++i) {
+        Data::IndexedName face("Face", i);
+        EXPECT_EQ(base->find(base->find(face)), face);
+    }
+    auto all = base->getAll();
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end(), [](const auto& a, const auto& b) {
+        return a.name < b.name;
+    }));
+}
+
+TEST_F(ElementMapTest, saveBinaryRoundTrip)
+{
+    // Arrange
+    constexpr int featureCount = 20;
+    constexpr int faceCount = 500;
+    Data::ElementMapPtr base;
+    for (int feature = 1; feature <= featureCount; ++feature) {
+        auto map = std::make_shared<Data::ElementMap>();
+        map->hasher = _hasher;
+        std::ostringstream ss;
+        for (int i = 1; i <= faceCount; ++i) {
+            Data::IndexedName face("Face", i);
+            Data::MappedName name = base ? base->find(face) : Data::MappedName(face);
+            map->encodeElementName('F', name, ss, nullptr, feature, nullptr, feature - 1);
+            map->setElementName(face, name, feature);
+        }
+        base = map;
+    }
+    base->beforeSave(_hasher);
+    std::ostringstream text;
+    std::ostringstream binary;
+
+    // Act
+    base->save(text);
+    base->saveBinary(binary);
+    auto doc = App::GetApplication().getDocument(_docName.c_str());
+    App::GetApplication().signalStartRestoreDocument(*doc);
+    std::istringstream input(binary.str());
+    auto restored = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, input);
+    App::GetApplication().signalFinishRestoreDocument(*doc);
+
+    // Assert
+    EXPECT_LT(binary.str().size(), text.str().size());
+    EXPECT_EQ(restored->size(), base->size());
+    for (int i = 1; i <= faceCount; ++i) {
+        Data::IndexedName face("Face", i);
+        EXPECT_EQ(restored->find(face), base->find(face));
+        EXPECT_EQ(restored->find(base->find(face)), face);
+    }
+}
+
+TEST_F(ElementMapTest, restoreBinarySharedChildMap)
+{
+    // Arrange
+    auto& app = App::GetApplication();
+    auto doc = app.getDocument(_docName.c_str());
+    LessComplexPart shared(1L, "Shared", _hasher);
+    auto makeParent = [&](long tag) {
+        auto map = std::make_shared<Data::ElementMap>();
+        map->hasher = _hasher;
+        map->addChildElements(
+            tag,
+            {{Data::IndexedName("Face", 1), 6, 0, 1L, shared.elementMapPtr, QByteArray(), _sid}});
+        return map;
+    };
+    auto first = makeParent(2L);
+    auto second = makeParent(3L);
+    std::ostringstream firstData;
+    std::ostringstream secondData;
+    app.signalStartSaveDocument(*doc, "");
+    first->beforeSave(_hasher);
+    second->beforeSave(_hasher);
+    first->saveBinary(firstData);
+    second->saveBinary(secondData);
+    app.signalFinishSaveDocument(*doc, "");
+
+    // Act
+    app.signalStartRestoreDocument(*doc);
+    std::istringstream firstInput(firstData.str());
+    auto firstRestored = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, firstInput);
+    std::istringstream secondInput(secondData.str());
+    auto secondRestored = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, secondInput);
+    std::istringstream againInput(firstData.str());
+    auto againRestored = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, againInput);
+    app.signalFinishRestoreDocument(*doc);
+
+    // Assert
+    EXPECT_EQ(againRestored, firstRestored);
+    EXPECT_NE(secondRestored, firstRestored);
+    auto firstChildren = firstRestored->getChildElements();
+    auto secondChildren = secondRestored->getChildElements();
+    ASSERT_EQ(firstChildren.size(), 1);
+    ASSERT_EQ(secondChildren.size(), 1);
+    ASSERT_TRUE(firstChildren[0].elementMap);
+    EXPECT_EQ(secondChildren[0].elementMap, firstChildren[0].elementMap);
+    EXPECT_EQ(firstChildren[0].elementMap->size(), shared.elementMapPtr->size());
+}
+
 // NOLINTEND(readability-magic-numbers)
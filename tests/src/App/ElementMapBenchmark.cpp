@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/ElementMap.h>
+#include <App/StringHasher.h>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+// Compares the size and the time of the text and the binary element map files. This is not a
+// test, it is built with ENABLE_DEVELOPER_BENCHMARKS and run by hand from a release build.
+class ElementMapBenchmark: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _hasher = Base::Reference<App::StringHasher>(new App::StringHasher);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    template<typename Func>
+    static double milliseconds(Func func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+        return time.count();
+    }
+
+    std::string _docName;
+    App::Document* _doc {};
+    App::StringHasherRef _hasher;
+};
+
+TEST_F(ElementMapBenchmark, saveAndRestore)
+{
+    // a chain of features, each one mapping all the faces of its base feature
+    constexpr int featureCount = 50;
+    constexpr int faceCount = 2000;
+    Data::ElementMapPtr base;
+    for (int feature = 1; feature <= featureCount; ++feature) {
+        auto map = std::make_shared<Data::ElementMap>();
+        map->hasher = _hasher;
+        std::ostringstream ss;
+        for (int i = 1; i <= faceCount; ++i) {
+            Data::IndexedName face("Face", i);
+            Data::MappedName name = base ? base->find(face) : Data::MappedName(face);
+            map->encodeElementName('F', name, ss, nullptr, feature, nullptr, feature - 1);
+            map->setElementName(face, name, feature);
+        }
+        base = map;
+    }
+    base->beforeSave(_hasher);
+    auto& app = App::GetApplication();
+
+    std::ostringstream text;
+    std::ostringstream binary;
+    double textSave = milliseconds([&] { base->save(text); });
+    double binarySave = milliseconds([&] { base->saveBinary(binary); });
+    double textRestore = milliseconds([&] {
+        app.signalStartRestoreDocument(*_doc);
+        std::istringstream input(text.str());
+        std::make_shared<Data::ElementMap>()->restore(_hasher, input);
+        app.signalFinishRestoreDocument(*_doc);
+    });
+    double binaryRestore = milliseconds([&] {
+        app.signalStartRestoreDocument(*_doc);
+        std::istringstream input(binary.str());
+        std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, input);
+        app.signalFinishRestoreDocument(*_doc);
+    });
+    std::cout << "element map text: " << text.str().size() << " bytes, save " << textSave
+              << " ms, restore " << textRestore << " ms\n";
+    std::cout << "element map binary: " << binary.str().size() << " bytes, save " << binarySave
+              << " ms, restore " << binaryRestore << " ms\n";
+
+    _hasher->setSaveAll(true);
+    Base::StringWriter textWriter;
+    Base::StringWriter binaryWriter;
+    binaryWriter.setMode("BinaryElementMap");
+    textSave = milliseconds([&] { _hasher->SaveDocFile(textWriter); });
+    binarySave = milliseconds([&] { _hasher->SaveDocFile(binaryWriter); });
+    binaryRestore = milliseconds([&] {
+        auto restored = Base::Reference<App::StringHasher>(new App::StringHasher);
+        std::istringstream stream(binaryWriter.getString());
+        Base::Reader reader(stream, "StringHasher.Table.txt", 1);
+        restored->RestoreDocFile(reader);
+    });
+    textRestore = milliseconds([&] {
+        auto restored = Base::Reference<App::StringHasher>(new App::StringHasher);
+        std::istringstream stream(textWriter.getString());
+        Base::Reader reader(stream, "StringHasher.Table.txt", 1);
+        restored->RestoreDocFile(reader);
+    });
+    std::cout << "string table text: " << textWriter.getString().size() << " bytes, save "
+              << textSave << " ms, restore " << textRestore << " ms\n";
+    std::cout << "string table binary: " << binaryWriter.getString().size() << " bytes, save "
+              << binarySave << " ms, restore " << binaryRestore << " ms\n";
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
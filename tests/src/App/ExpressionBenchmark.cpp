@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include "App/Application.h"
+#include "App/Document.h"
+#include "App/Expression.h"
+#include "App/ExpressionParser.h"
+#include "App/FeatureTest.h"
+#include "Base/Interpreter.h"
+
+#include "src/App/InitApplication.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+// Compares the native expression evaluation with the Python evaluation. This is not a test,
+// it is built with ENABLE_DEVELOPER_BENCHMARKS and run by hand from a release build.
+class ExpressionBenchmark: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _feature = static_cast<App::FeatureTest*>(_doc->addObject("App::FeatureTest"));
+        _feature->Integer.setValue(7);
+        _feature->Float.setValue(0.25);
+        _feature->Distance.setValue(12.5);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::FeatureTest* feature()
+    {
+        return _feature;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    App::FeatureTest* _feature {};
+};
+
+TEST_F(ExpressionBenchmark, evaluate)
+{
+    constexpr int evaluations = 100000;
+    std::array<const char*, 5> expressions = {
+        "1 + 2 * 3",
+        "Distance * 2 + 1 mm",
+        "Integer * Float - Integer % 4",
+        "Distance > 10 mm ? hypot(Distance, 3 mm) : sqrt(Distance ^ 2)",
+        "sin(30 deg) * cos(Float * 1 rad) + abs(-Distance) / 1 mm",
+    };
+
+    for (auto text : expressions) {
+        std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(feature(), text));
+        App::any value;
+        ASSERT_TRUE(expression->getNativeValue(value)) << text;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < evaluations; ++i) {
+            expression->getNativeValue(value);
+        }
+        std::chrono::duration<double, std::nano> native = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        {
+            Base::PyGILStateLocker lock;
+            for (int i = 0; i < evaluations; ++i) {
+                value = App::pyObjectToAny(expression->getPyValue());
+            }
+        }
+        std::chrono::duration<double, std::nano> python = std::chrono::steady_clock::now() - start;
+
+        std::cout << text << ": native " << native.count() / evaluations << " ns, python "
+                  << python.count() / evaluations << " ns per evaluation\n";
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "Base/Quantity.h"
 
 #include "App/Application.h"
@@ -7,6 +12,9 @@
 #include "App/DocumentObject.h"
 #include "App/Expression.h"
 #include "App/ExpressionParser.h"
+#include "App/PropertyStandard.h"
+#include "App/PropertyUnits.h"
+#include "Base/Interpreter.h"
 
 #include "src/App/InitApplication.h"
 
@@ -102,6 +110,64 @@ TEST_F(ExpressionParserTest, functionPARSEQUANT)
 
 }
 
+TEST_F(ExpressionParserTest, nativeEvaluationMatchesPython)
+{
+    auto length = static_cast<App::PropertyLength*>(this_obj()->addDynamicProperty("App::PropertyLength", "NativeLength"));
+    length->setValue(12.5);
+    auto count = static_cast<App::PropertyInteger*>(this_obj()->addDynamicProperty("App::PropertyInteger", "NativeCount"));
+    count->setValue(7);
+    auto factor = static_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "NativeFactor"));
+    factor->setValue(0.25);
+
+    std::array<const char*, 24> supported = {
+        "1 + 2", "7 / 2", "2 ^ 10", "2 ^ -1", "-7 % 3", "7.5 % -2", "-(3)", "True + 1",
+        "1 mm + 2 mm", "2 * 3 mm", "10 mm / 4 mm", "(2 mm) ^ 2", "1 < 2.5", "1 mm >= 2 mm",
+        "1 ? 2 mm : 3 mm", "0 ? 2 : 3.5", "sin(30 deg)", "sqrt(4 mm^2)", "hypot(3 mm, 4 mm)",
+        "NativeLength * 2", "NativeCount * NativeFactor", "NativeCount % 4", "NativeLength > 10 mm ? NativeCount : -NativeCount",
+        "mod(NativeLength, 5 mm)",
+    };
+    for (auto text : supported) {
+        std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(this_obj(), text));
+        App::any native;
+        ASSERT_TRUE(expression->getNativeValue(native)) << text;
+        Base::PyGILStateLocker lock;
+        App::any python = App::pyObjectToAny(expression->getPyValue());
+        EXPECT_EQ(native.type(), python.type()) << text;
+        EXPECT_TRUE(App::isAnyEqual(native, python)) << text;
+    }
+
+    // Python objects, errors and unsupported property types use the Python path
+    std::array<const char*, 5> unsupported = {
+        "1 / 0", "1 mm + 1 s", "str(1)", "vector(1, 2, 3)", "Placement.Base.x",
+    };
+    for (auto text : unsupported) {
+        std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(this_obj(), text));
+        App::any native;
+        EXPECT_FALSE(expression->getNativeValue(native)) << text;
+    }
+}
+
+TEST_F(ExpressionParserTest, nativeEvaluationFromSeveralThreads)
+{
+    // the first evaluation compiles the native program, let the threads race on it
+    std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(this_obj(), "hypot(3 mm, 4 mm) * 2"));
+    auto expected = parse_quantity_text_as_quantity("10 mm");
+    std::atomic<int> failures {0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            App::any value;
+            if (!expression->getNativeValue(value) || App::any_cast<Base::Quantity>(value) != expected) {
+                ++failures;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failures, 0);
+}
+
 TEST_F(ExpressionParserTest, isTokenAConstant)
 {
     std::array<std::string, 7> constants {"pi", "e", "True", "False", "true", "false", "None"};
@@ -8,6 +8,8 @@
 #include "App/Expression.h"
 #include "App/ObjectIdentifier.h"
 #include "App/PropertyExpressionEngine.h"
+#include "App/PropertyStandard.h"
+#include "App/PropertyUnits.h"
 
 #include "src/App/InitApplication.h"
 
@@ -90,4 +92,38 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+TEST_F(PropertyExpressionEngineTest, executeOnlyPendingBindings)
+{
+    auto source = static_cast<App::PropertyString*>(source_prop());
+    auto target = static_cast<App::PropertyLength*>(target_prop());
+    auto other = static_cast<App::PropertyInteger*>(this_obj()->addDynamicProperty("App::PropertyInteger", "this_other"));
+    source->setValue("2 mm");
+
+    auto target_path = App::ObjectIdentifier::parse(this_obj(), target_name());
+    std::shared_ptr<App::Expression> target_rule(App::Expression::parse(this_obj(), "parsequant(" + source_name() + ")"));
+    this_obj()->setExpression(target_path, target_rule);
+    EXPECT_TRUE(this_obj()->ExpressionEngine.hasPendingBindings());
+
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(target->getValue(), 2.0);
+    EXPECT_FALSE(this_obj()->ExpressionEngine.hasPendingBindings());
+
+    // A property not used by any binding
+    other->setValue(3);
+    EXPECT_FALSE(this_obj()->ExpressionEngine.hasPendingBindings());
+
+    // Overriding the bound value
+    target->setValue(1.0);
+    EXPECT_TRUE(this_obj()->ExpressionEngine.hasPendingBindings());
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(target->getValue(), 2.0);
+
+    // Changing the input
+    source->setValue("3 mm");
+    EXPECT_TRUE(this_obj()->ExpressionEngine.hasPendingBindings());
+    this_obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(target->getValue(), 3.0);
+    EXPECT_FALSE(this_obj()->ExpressionEngine.hasPendingBindings());
+}
+
 // clang-format on
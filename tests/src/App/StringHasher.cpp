@@ -6,9 +6,14 @@
 #include <App/StringHasher.h>
 #include <App/StringHasherPy.h>
 #include <App/StringIDPy.h>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
 
 #include <QCryptographicHash>
 #include <array>
+#include <set>
+#include <sstream>
+#include <thread>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1591,76 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, concurrentGetID)  // NOLINT
+{
+    // Arrange
+    constexpr int threadCount = 8;
+    constexpr int stringCount = 5000;
+    std::vector<std::vector<long>> ids(threadCount, std::vector<long>(stringCount));
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([this, t, &ids]() {
+            // every thread maps the same strings, but in a different order
+            for (int i = 0; i < stringCount; ++i) {
+                int index = (i + t * stringCount / threadCount) % stringCount;
+                auto text = QByteArray::number(index);
+                ids[t][index] = Hasher()->getID(text).value();
+                Hasher()->getID(givenMappedName("Face", text.constData()), {});
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    std::set<long> unique;
+    for (int i = 0; i < stringCount; ++i) {
+        for (int t = 1; t < threadCount; ++t) {
+            EXPECT_EQ(ids[0][i], ids[t][i]);
+        }
+        EXPECT_EQ(Hasher()->getID(ids[0][i]).dataToText(), QByteArray::number(i).toStdString());
+        unique.insert(ids[0][i]);
+    }
+    EXPECT_EQ(unique.size(), stringCount);
+    // one entry per string and per mapped name, plus the shared "Face" prefix
+    EXPECT_EQ(Hasher()->size(), 2 * stringCount + 1);
+}
+
+TEST_F(StringHasherTest, binaryDocFileRoundTrip)  // NOLINT
+{
+    // Arrange
+    constexpr int stringCount = 2000;
+    Hasher()->setSaveAll(true);
+    for (int i = 0; i < stringCount; ++i) {
+        auto text = QByteArray::number(i);
+        Hasher()->getID(text);
+        Hasher()->getID(givenMappedName("Face", text.constData()), {});
+    }
+    givenSomeHashedValues();
+    Hasher()->getID(QByteArray("\x01\x02\x03", 3), App::StringHasher::Option::Binary);
+    Hasher()->getID(QByteArray(1000, 'x'));
+    Base::StringWriter textWriter;
+    Base::StringWriter binaryWriter;
+    binaryWriter.setMode("BinaryElementMap");
+
+    // Act
+    Hasher()->SaveDocFile(textWriter);
+    Hasher()->SaveDocFile(binaryWriter);
+    auto restored = Base::Reference<App::StringHasher>(new App::StringHasher);
+    std::istringstream stream(binaryWriter.getString());
+    Base::Reader reader(stream, "StringHasher.Table.txt", 1);
+    restored->RestoreDocFile(reader);
+
+    // Assert
+    EXPECT_LT(binaryWriter.getString().size(), textWriter.getString().size());
+    ASSERT_EQ(restored->size(), Hasher()->size());
+    for (auto& entry : Hasher()->getIDMap()) {
+        auto sid = restored->getID(entry.first);
+        ASSERT_TRUE(sid);
+        EXPECT_EQ(sid.dataToBytes(), entry.second.dataToBytes());
+    }
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <App/StringHasher.h>
+
+#include <QByteArray>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+// Measures the StringHasher throughput with several threads. This is not a test, it is built
+// with ENABLE_DEVELOPER_BENCHMARKS and run by hand from a release build.
+class StringHasherBenchmark: public ::testing::Test
+{
+protected:
+    // Runs getID() for stringCount strings in every thread, returns the ids per second
+    static double run(App::StringHasher& hasher, int threadCount, int stringCount)
+    {
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&hasher, t, threadCount, stringCount]() {
+                // every thread maps the same strings, but in a different order
+                for (int i = 0; i < stringCount; ++i) {
+                    int index = (i + t * stringCount / threadCount) % stringCount;
+                    hasher.getID(QByteArray::number(index));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+        return threadCount * stringCount / time.count();
+    }
+};
+
+TEST_F(StringHasherBenchmark, getID)
+{
+    constexpr int stringCount = 200000;
+    for (int threadCount : {1, 2, 4, 8, 16}) {
+        Base::Reference<App::StringHasher> hasher(new App::StringHasher);
+        double insert = run(*hasher, threadCount, stringCount);
+        double lookup = run(*hasher, threadCount, stringCount);
+        std::cout << threadCount << " threads: " << insert / 1e6 << " M ids/s for new strings, "
+                  << lookup / 1e6 << " M ids/s for known strings\n";
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
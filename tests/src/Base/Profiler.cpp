@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <Base/Profiler.h>
+
+#include <sstream>
+#include <thread>
+#include <utility>
+
+// a zone ends in a destructor, so recording it must never throw
+static_assert(noexcept(Base::Profiler::record(std::declval<Base::Profiler::Event>())));
+
+class Profiler: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Base::Profiler::clear();
+    }
+    void TearDown() override
+    {
+        Base::Profiler::setEnabled(false);
+        Base::Profiler::clear();
+    }
+};
+
+TEST_F(Profiler, TestDisabled)
+{
+    {
+        FC_PROFILE_ZONE("disabled");
+    }
+    EXPECT_TRUE(Base::Profiler::getEvents().empty());
+}
+
+TEST_F(Profiler, TestNesting)
+{
+    Base::Profiler::setEnabled(true);
+    {
+        FC_PROFILE_ZONE("outer");
+        {
+            FC_PROFILE_ZONE_DETAIL("inner", std::string("Part::Box"));
+        }
+    }
+    Base::Profiler::setEnabled(false);
+
+    auto events = Base::Profiler::getEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_STREQ(events[0].name, "inner");
+    EXPECT_EQ(events[0].detail, "Part::Box");
+    EXPECT_EQ(events[0].depth, 1);
+    EXPECT_STREQ(events[1].name, "outer");
+    EXPECT_EQ(events[1].depth, 0);
+    EXPECT_LE(events[1].start, events[0].start);
+    EXPECT_GE(events[1].start + events[1].duration, events[0].start + events[0].duration);
+    EXPECT_EQ(events[0].thread, events[1].thread);
+}
+
+TEST_F(Profiler, TestDetailNotEvaluatedWhenDisabled)
+{
+    int evaluated = 0;
+    auto detail = [&evaluated]() {
+        ++evaluated;
+        return std::string("detail");
+    };
+    {
+        FC_PROFILE_ZONE_DETAIL("disabled", detail());
+    }
+    EXPECT_EQ(evaluated, 0);
+}
+
+TEST_F(Profiler, TestDetailInIfElse)
+{
+    Base::Profiler::setEnabled(true);
+    bool branch = false;
+    if (branch) {
+        FC_PROFILE_ZONE_DETAIL("if", std::string("if"));
+    }
+    else {
+        FC_PROFILE_ZONE_DETAIL("else", std::string("else"));
+    }
+
+    auto events = Base::Profiler::getEvents();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].detail, "else");
+}
+
+TEST_F(Profiler, TestThreads)
+{
+    Base::Profiler::setEnabled(true);
+    {
+        FC_PROFILE_ZONE("main");
+        std::thread worker([]() {
+            FC_PROFILE_ZONE("worker");
+        });
+        worker.join();
+    }
+
+    auto events = Base::Profiler::getEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0].thread, events[1].thread);
+    EXPECT_EQ(events[0].depth, 0);
+}
+
+TEST_F(Profiler, TestChromeTrace)
+{
+    Base::Profiler::setEnabled(true);
+    {
+        FC_PROFILE_ZONE_DETAIL("zone", std::string("say \"hi\"\n"));
+    }
+    std::ostringstream str;
+    Base::Profiler::writeChromeTrace(str);
+
+    std::string json = str.str();
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[{\"name\":\"zone\",\"ph\":\"X\""),
+              0);
+    EXPECT_NE(json.find("\"args\":{\"detail\":\"say \\\"hi\\\"\\n\"}"), std::string::npos);
+}
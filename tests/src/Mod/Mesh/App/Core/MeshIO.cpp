@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <sstream>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+class MeshIOTest: public ::testing::Test
+{
+protected:
+    // Creates a planar grid of size x size points
+    static MeshCore::MeshKernel makeGrid(unsigned long size)
+    {
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        points.reserve(size * size);
+        for (unsigned long i = 0; i < size; i++) {
+            for (unsigned long j = 0; j < size; j++) {
+                points.emplace_back(0.1F * float(i), -0.1F * float(j), 0.01F * float(i + j));
+            }
+        }
+        for (unsigned long i = 0; i + 1 < size; i++) {
+            for (unsigned long j = 0; j + 1 < size; j++) {
+                unsigned long p = i * size + j;
+                facets.emplace_back(p, p + size, p + 1);
+                facets.emplace_back(p + 1, p + size, p + size + 1);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets);
+        return kernel;
+    }
+
+    static Base::Matrix4D makeTransform()
+    {
+        Base::Matrix4D mat;
+        mat.rotZ(0.5);
+        mat.move(Base::Vector3d(10, 0, 0));
+        return mat;
+    }
+
+    // The writer as it was before: one facet after the other through the stream
+    static void legacyAsciiSTL(const MeshCore::MeshKernel& kernel,
+                               const Base::Matrix4D& mat,
+                               std::ostream& output)
+    {
+        MeshCore::MeshFacetIterator clIter(kernel);
+        clIter.Transform(mat);
+        output.precision(6);
+        output.setf(std::ios::fixed | std::ios::showpoint);
+        output << "solid Mesh\n";
+        for (clIter.Init(); clIter.More(); clIter.Next()) {
+            const MeshCore::MeshGeomFacet& facet = *clIter;
+            output << "  facet normal " << facet.GetNormal().x << " " << facet.GetNormal().y << " "
+                   << facet.GetNormal().z << '\n';
+            output << "    outer loop\n";
+            for (const auto& pnt : facet._aclPoints) {
+                output << "      vertex " << pnt.x << " " << pnt.y << " " << pnt.z << '\n';
+            }
+            output << "    endloop\n";
+            output << "  endfacet\n";
+        }
+        output << "endsolid Mesh\n";
+    }
+
+    static void legacyBinarySTL(const MeshCore::MeshKernel& kernel,
+                                const Base::Matrix4D& mat,
+                                std::ostream& output)
+    {
+        const std::string& header = MeshCore::MeshOutput::GetSTLHeaderData();
+        output.write(header.c_str(), std::strlen(header.c_str()));
+        uint32_t count = (uint32_t)kernel.CountFacets();
+        output.write((const char*)&count, sizeof(count));
+
+        uint16_t attribute = 0;
+        MeshCore::MeshFacetIterator clIter(kernel);
+        clIter.Transform(mat);
+        for (clIter.Init(); clIter.More(); clIter.Next()) {
+            const MeshCore::MeshGeomFacet& facet = *clIter;
+            Base::Vector3f normal = facet.GetNormal();
+            output.write((const char*)&(normal.x), sizeof(float));
+            output.write((const char*)&(normal.y), sizeof(float));
+            output.write((const char*)&(normal.z), sizeof(float));
+            for (const auto& pnt : facet._aclPoints) {
+                output.write((const char*)&(pnt.x), sizeof(float));
+                output.write((const char*)&(pnt.y), sizeof(float));
+                output.write((const char*)&(pnt.z), sizeof(float));
+            }
+            output.write((const char*)&attribute, sizeof(attribute));
+        }
+    }
+};
+
+TEST_F(MeshIOTest, TestAsciiSTL)
+{
+    MeshCore::MeshKernel kernel = makeGrid(200);
+    Base::Matrix4D mat = makeTransform();
+
+    std::stringstream legacy;
+    legacyAsciiSTL(kernel, mat, legacy);
+
+    std::stringstream str;
+    MeshCore::MeshOutput output(kernel);
+    output.Transform(mat);
+    EXPECT_TRUE(output.SaveAsciiSTL(str));
+    EXPECT_EQ(str.str(), legacy.str());
+}
+
+TEST_F(MeshIOTest, TestBinarySTL)
+{
+    MeshCore::MeshKernel kernel = makeGrid(200);
+    Base::Matrix4D mat = makeTransform();
+
+    std::stringstream legacy;
+    legacyBinarySTL(kernel, mat, legacy);
+
+    std::stringstream str;
+    MeshCore::MeshOutput output(kernel);
+    output.Transform(mat);
+    EXPECT_TRUE(output.SaveBinarySTL(str));
+    EXPECT_EQ(str.str(), legacy.str());
+}
+
+TEST_F(MeshIOTest, TestBinaryPLY)
+{
+    MeshCore::MeshKernel kernel = makeGrid(200);
+
+    std::stringstream str;
+    MeshCore::MeshOutput output(kernel);
+    EXPECT_TRUE(output.SaveBinaryPLY(str));
+
+    MeshCore::MeshKernel result;
+    MeshCore::MeshInput input(result);
+    EXPECT_TRUE(input.LoadPLY(str));
+    EXPECT_EQ(result.CountPoints(), kernel.CountPoints());
+    EXPECT_EQ(result.CountFacets(), kernel.CountFacets());
+    EXPECT_EQ(result.GetPoints()[12345], kernel.GetPoints()[12345]);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(result.GetFacets()[23456]._aulPoints[i], kernel.GetFacets()[23456]._aulPoints[i]);
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+
+#include <Base/FileInfo.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+// Compares the STL and PLY writers of MeshOutput with the writers they replaced. This is not a
+// test, it is built with ENABLE_DEVELOPER_BENCHMARKS and run by hand from a release build.
+class MeshIOBenchmark: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        fileInfo.setFile(Base::FileInfo::getTempFileName());
+    }
+
+    void TearDown() override
+    {
+        fileInfo.deleteFile();
+    }
+
+    // Creates a planar grid of size x size points
+    static MeshCore::MeshKernel makeGrid(unsigned long size)
+    {
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        points.reserve(size * size);
+        for (unsigned long i = 0; i < size; i++) {
+            for (unsigned long j = 0; j < size; j++) {
+                points.emplace_back(0.1F * float(i), -0.1F * float(j), 0.01F * float(i + j));
+            }
+        }
+        for (unsigned long i = 0; i + 1 < size; i++) {
+            for (unsigned long j = 0; j + 1 < size; j++) {
+                unsigned long p = i * size + j;
+                facets.emplace_back(p, p + size, p + 1);
+                facets.emplace_back(p + 1, p + size, p + size + 1);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets);
+        return kernel;
+    }
+
+    // The writer as it was before: one facet after the other through the stream
+    static void legacyAsciiSTL(const MeshCore::MeshKernel& kernel,
+                               const Base::Matrix4D& mat,
+                               std::ostream& output)
+    {
+        MeshCore::MeshFacetIterator clIter(kernel);
+        clIter.Transform(mat);
+        output.precision(6);
+        output.setf(std::ios::fixed | std::ios::showpoint);
+        output << "solid Mesh\n";
+        for (clIter.Init(); clIter.More(); clIter.Next()) {
+            const MeshCore::MeshGeomFacet& facet = *clIter;
+            output << "  facet normal " << facet.GetNormal().x << " " << facet.GetNormal().y << " "
+                   << facet.GetNormal().z << '\n';
+            output << "    outer loop\n";
+            for (const auto& pnt : facet._aclPoints) {
+                output << "      vertex " << pnt.x << " " << pnt.y << " " << pnt.z << '\n';
+            }
+            output << "    endloop\n";
+            output << "  endfacet\n";
+        }
+        output << "endsolid Mesh\n";
+    }
+
+    static void legacyBinarySTL(const MeshCore::MeshKernel& kernel,
+                                const Base::Matrix4D& mat,
+                                std::ostream& output)
+    {
+        const std::string& header = MeshCore::MeshOutput::GetSTLHeaderData();
+        output.write(header.c_str(), std::strlen(header.c_str()));
+        uint32_t count = (uint32_t)kernel.CountFacets();
+        output.write((const char*)&count, sizeof(count));
+
+        uint16_t attribute = 0;
+        MeshCore::MeshFacetIterator clIter(kernel);
+        clIter.Transform(mat);
+        for (clIter.Init(); clIter.More(); clIter.Next()) {
+            const MeshCore::MeshGeomFacet& facet = *clIter;
+            Base::Vector3f normal = facet.GetNormal();
+            output.write((const char*)&(normal.x), sizeof(float));
+            output.write((const char*)&(normal.y), sizeof(float));
+            output.write((const char*)&(normal.z), sizeof(float));
+            for (const auto& pnt : facet._aclPoints) {
+                output.write((const char*)&(pnt.x), sizeof(float));
+                output.write((const char*)&(pnt.y), sizeof(float));
+                output.write((const char*)&(pnt.z), sizeof(float));
+            }
+            output.write((const char*)&attribute, sizeof(attribute));
+        }
+    }
+
+    // Returns the milliseconds it takes to write the file with func
+    long measure(const std::function<void(std::ostream&)>& func) const
+    {
+        std::ofstream str(fileInfo.filePath(), std::ios::out | std::ios::binary);
+        auto start = std::chrono::steady_clock::now();
+        func(str);
+        str.close();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    }
+
+private:
+    Base::FileInfo fileInfo;
+};
+
+TEST_F(MeshIOBenchmark, write)
+{
+    for (unsigned long size : {200UL, 600UL, 1000UL}) {
+        MeshCore::MeshKernel kernel = makeGrid(size);
+        Base::Matrix4D mat;
+        mat.rotZ(0.5);
+        mat.move(Base::Vector3d(10, 0, 0));
+
+        MeshCore::MeshOutput output(kernel);
+        output.Transform(mat);
+
+        long legacyAscii = measure([&](std::ostream& str) {
+            legacyAsciiSTL(kernel, mat, str);
+        });
+        long ascii = measure([&](std::ostream& str) {
+            EXPECT_TRUE(output.SaveAsciiSTL(str));
+        });
+        long legacyBinary = measure([&](std::ostream& str) {
+            legacyBinarySTL(kernel, mat, str);
+        });
+        long binary = measure([&](std::ostream& str) {
+            EXPECT_TRUE(output.SaveBinarySTL(str));
+        });
+        long ply = measure([&](std::ostream& str) {
+            EXPECT_TRUE(output.SaveBinaryPLY(str));
+        });
+
+        std::cout << kernel.CountFacets() << " facets: ASCII STL legacy " << legacyAscii
+                  << " ms, new " << ascii << " ms; binary STL legacy " << legacyBinary
+                  << " ms, new " << binary << " ms; binary PLY " << ply << " ms" << std::endl;
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <Base/FileInfo.h>
+#include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/Writer3MF.h>
+#include <Mod/Mesh/App/Core/IO/ZipWriter.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <xercesc/util/PlatformUtils.hpp>
+#include <zipios++/zipfile.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+class Writer3MFTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
+    }
+
+    void SetUp() override
+    {
+        fileInfo.setFile(Base::FileInfo::getTempFileName() + ".3mf");
+    }
+
+    void TearDown() override
+    {
+        fileInfo.deleteFile();
+    }
+
+    // Creates a planar grid of size x size points
+    static MeshCore::MeshKernel makeGrid(unsigned long size)
+    {
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        points.reserve(size * size);
+        for (unsigned long i = 0; i < size; i++) {
+            for (unsigned long j = 0; j < size; j++) {
+                points.emplace_back(0.1F * float(i), 0.1F * float(j), 0.01F * float(i + j));
+            }
+        }
+        for (unsigned long i = 0; i + 1 < size; i++) {
+            for (unsigned long j = 0; j + 1 < size; j++) {
+                unsigned long p = i * size + j;
+                facets.emplace_back(p, p + size, p + 1);
+                facets.emplace_back(p + 1, p + size, p + size + 1);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets);
+        return kernel;
+    }
+
+    std::string fileName() const
+    {
+        return fileInfo.filePath();
+    }
+
+private:
+    Base::FileInfo fileInfo;
+};
+
+TEST_F(Writer3MFTest, TestRoundTrip)
+{
+    MeshCore::MeshKernel kernel = makeGrid(10);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(10, 0, 0));
+
+    {
+        MeshCore::Writer3MF writer(fileName());
+        EXPECT_TRUE(writer.AddMesh(kernel, mat));
+        EXPECT_TRUE(writer.AddMesh(kernel, Base::Matrix4D()));
+        EXPECT_TRUE(writer.Save());
+    }
+
+    MeshCore::Reader3MF reader(fileName());
+    EXPECT_TRUE(reader.Load());
+    std::vector<int> ids = reader.GetMeshIds();
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids.size(), 2);
+    EXPECT_EQ(reader.GetMesh(ids[0]).CountPoints(), 100);
+    EXPECT_EQ(reader.GetMesh(ids[0]).CountFacets(), 162);
+    EXPECT_EQ(reader.GetTransform(ids[0]), mat);
+    EXPECT_EQ(reader.GetMesh(ids[1]).GetPoints()[99], kernel.GetPoints()[99]);
+}
+
+TEST_F(Writer3MFTest, TestStreamRoundTrip)
+{
+    MeshCore::MeshKernel kernel = makeGrid(10);
+    std::stringstream str;
+    MeshCore::Writer3MF writer(str);
+    EXPECT_TRUE(writer.AddMesh(kernel, Base::Matrix4D()));
+    EXPECT_TRUE(writer.Save());
+
+    MeshCore::Reader3MF reader(str);
+    EXPECT_TRUE(reader.Load());
+    EXPECT_EQ(reader.GetMeshIds().size(), 1);
+}
+
+TEST_F(Writer3MFTest, TestProductionExtension)
+{
+    MeshCore::MeshKernel kernel = makeGrid(10);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(0, 0, 5));
+
+    {
+        MeshCore::Writer3MF writer(fileName());
+        writer.SetProductionExtension(true);
+        EXPECT_TRUE(writer.AddMesh(kernel, mat));
+        EXPECT_TRUE(writer.AddMesh(kernel, mat));
+        EXPECT_TRUE(writer.Save());
+    }
+
+    zipios::ZipFile zip(fileName());
+    EXPECT_TRUE(zip.getEntry("3D/Objects/object_1.model"));
+    EXPECT_TRUE(zip.getEntry("3D/Objects/object_2.model"));
+    EXPECT_TRUE(zip.getEntry("3D/_rels/3dmodel.model.rels"));
+
+    MeshCore::Reader3MF reader(fileName());
+    EXPECT_TRUE(reader.Load());
+    std::vector<int> ids = reader.GetMeshIds();
+    EXPECT_EQ(ids.size(), 2);
+    EXPECT_EQ(reader.GetMesh(ids[0]).CountFacets(), 162);
+    EXPECT_EQ(reader.GetTransform(ids[0]), mat);
+}
+
+TEST_F(Writer3MFTest, TestZipOffsetsAfterPrefix)
+{
+    const std::string prefix = "data before the archive";
+    std::ostringstream str;
+    str << prefix;
+    {
+        MeshCore::ZipWriter zip(str);
+        zip.putNextEntry("entry.txt");
+        zip.write(std::string_view("content"));
+        zip.close();
+    }
+
+    auto read32 = [](const std::string& data, std::size_t pos) {
+        uint32_t value = 0;
+        for (int i = 3; i >= 0; i--) {
+            value = (value << 8) | static_cast<unsigned char>(data[pos + i]);
+        }
+        return value;
+    };
+
+    // The offsets in the end of central directory record and in the central
+    // directory point to the headers within the whole stream
+    std::string data = str.str();
+    ASSERT_GT(data.size(), prefix.size() + 22);
+    std::size_t eocd = data.size() - 22;
+    EXPECT_EQ(read32(data, eocd), 0x06054b50U);
+    std::size_t dir = read32(data, eocd + 16);
+    ASSERT_LT(dir, eocd);
+    EXPECT_EQ(read32(data, dir), 0x02014b50U);
+    std::size_t header = read32(data, dir + 42);
+    EXPECT_EQ(header, prefix.size());
+    EXPECT_EQ(read32(data, header), 0x04034b50U);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
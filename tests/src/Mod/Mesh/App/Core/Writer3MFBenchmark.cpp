@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <Base/FileInfo.h>
+#include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/Writer3MF.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <xercesc/util/PlatformUtils.hpp>
+#include <zipios++/zipoutputstream.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+// Compares the 3MF writer with the iostreams and zipios writer it replaced. This is not a test,
+// it is built with ENABLE_DEVELOPER_BENCHMARKS and run by hand from a release build.
+class Writer3MFBenchmark: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
+    }
+
+    void SetUp() override
+    {
+        fileInfo.setFile(Base::FileInfo::getTempFileName() + ".3mf");
+    }
+
+    void TearDown() override
+    {
+        fileInfo.deleteFile();
+    }
+
+    // Creates a planar grid of size x size points
+    static MeshCore::MeshKernel makeGrid(unsigned long size)
+    {
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        points.reserve(size * size);
+        for (unsigned long i = 0; i < size; i++) {
+            for (unsigned long j = 0; j < size; j++) {
+                points.emplace_back(0.1F * float(i), 0.1F * float(j), 0.01F * float(i + j));
+            }
+        }
+        for (unsigned long i = 0; i + 1 < size; i++) {
+            for (unsigned long j = 0; j + 1 < size; j++) {
+                unsigned long p = i * size + j;
+                facets.emplace_back(p, p + size, p + 1);
+                facets.emplace_back(p + 1, p + size, p + size + 1);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets);
+        return kernel;
+    }
+
+    std::string fileName() const
+    {
+        return fileInfo.filePath();
+    }
+
+    static long milliseconds(std::chrono::steady_clock::duration elapsed)
+    {
+        return static_cast<long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    }
+
+    // Writes the model entry the way the writer did before: iostreams formatting and
+    // single-threaded deflate
+    void writeLegacy(const MeshCore::MeshKernel& kernel) const
+    {
+        zipios::ZipOutputStream zip(fileName());
+        zip.putNextEntry("3D/3dmodel.model");
+        for (const auto& it : kernel.GetPoints()) {
+            zip << "     <vertex x=\"" << it.x << "\" y=\"" << it.y << "\" z=\"" << it.z
+                << "\" />\n";
+        }
+        for (const auto& it : kernel.GetFacets()) {
+            zip << "     <triangle v1=\"" << it._aulPoints[0] << "\" v2=\"" << it._aulPoints[1]
+                << "\" v3=\"" << it._aulPoints[2] << "\" />\n";
+        }
+    }
+
+    void write(const MeshCore::MeshKernel& kernel, bool parallel, bool production) const
+    {
+        MeshCore::Writer3MF writer(fileName());
+        writer.SetParallel(parallel);
+        writer.SetProductionExtension(production);
+        writer.AddMesh(kernel, Base::Matrix4D());
+        EXPECT_TRUE(writer.Save());
+    }
+
+private:
+    Base::FileInfo fileInfo;
+};
+
+TEST_F(Writer3MFBenchmark, write)
+{
+    for (unsigned long size : {100UL, 400UL, 1000UL}) {
+        MeshCore::MeshKernel kernel = makeGrid(size);
+
+        auto start = std::chrono::steady_clock::now();
+        writeLegacy(kernel);
+        auto legacy = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        write(kernel, false, false);
+        auto serial = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        write(kernel, true, false);
+        auto parallel = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        write(kernel, true, true);
+        auto production = std::chrono::steady_clock::now() - start;
+
+        MeshCore::Reader3MF reader(fileName());
+        EXPECT_TRUE(reader.Load());
+        std::vector<int> ids = reader.GetMeshIds();
+        ASSERT_EQ(ids.size(), 1);
+        EXPECT_EQ(reader.GetMesh(ids[0]).CountFacets(), kernel.CountFacets());
+
+        std::cout << kernel.CountFacets() << " facets: legacy " << milliseconds(legacy)
+                  << " ms, serial " << milliseconds(serial) << " ms, parallel "
+                  << milliseconds(parallel) << " ms, production extension "
+                  << milliseconds(production) << " ms" << std::endl;
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -147,4 +147,35 @@ TEST_F(ExporterTest, TestMeshesInPart)
     EXPECT_DOUBLE_EQ(bbox.MinZ, -3.0);
     EXPECT_DOUBLE_EQ(bbox.MaxZ, 9.0);
 }
+
+TEST_F(ExporterTest, TestBinarySTLStreaming)
+{
+    Base::Placement plm;
+    plm.setPosition(Base::Vector3d(10, 5, 2));
+    setPlacementTo2ndCube(plm);
+
+    // add extra scope because the facet count will be written when destroying the exporter
+    Mesh::Exporter::Statistics stats;
+    {
+        Mesh::ExporterBinarySTL exporter(getFileName());
+        EXPECT_EQ(exporter.addObjects(getObjects(), 0.1F), 2);
+        stats = exporter.getStatistics();
+    }
+
+    EXPECT_EQ(stats.meshes, 2U);
+    EXPECT_EQ(stats.tessellated, 2U);
+    EXPECT_EQ(stats.facets, 24U);
+    EXPECT_GT(stats.peakMemory, 0U);
+
+    Mesh::MeshObject kernel;
+    EXPECT_TRUE(kernel.load(getFileName().c_str()));
+    EXPECT_EQ(kernel.countFacets(), 24U);
+    auto bbox = kernel.getBoundBox();
+    EXPECT_DOUBLE_EQ(bbox.MinX, -5.0);
+    EXPECT_DOUBLE_EQ(bbox.MaxX, 15.0);
+    EXPECT_DOUBLE_EQ(bbox.MinY, -5.0);
+    EXPECT_DOUBLE_EQ(bbox.MaxY, 10.0);
+    EXPECT_DOUBLE_EQ(bbox.MinZ, -5.0);
+    EXPECT_DOUBLE_EQ(bbox.MaxZ, 7.0);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
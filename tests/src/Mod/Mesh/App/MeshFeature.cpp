@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include <src/App/InitApplication.h>
+#include <memory>
 #include <Mod/Mesh/App/MeshFeature.h>
+#include <Mod/Mesh/App/MeshProperties.h>
 
 class MeshFeatureTest: public ::testing::Test
 {
@@ -37,4 +39,29 @@ TEST_F(MeshFeatureTest, getComplexElementTypes)
     EXPECT_STREQ(types[0], "Mesh");
     EXPECT_STREQ(types[1], "Segment");
 }
+TEST_F(MeshFeatureTest, copyKernelOnWrite)
+{
+    Mesh::PropertyMeshKernel prop;
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    prop.setValue(kernel);
+
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto meshCopy = static_cast<Mesh::PropertyMeshKernel*>(copy.get());
+    EXPECT_EQ(meshCopy->getValuePtr(), prop.getValuePtr());
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1, 0, 0));
+    prop.transformGeometry(mat);
+
+    EXPECT_NE(meshCopy->getValuePtr(), prop.getValuePtr());
+    EXPECT_EQ(meshCopy->getValue().countFacets(), 1UL);
+    EXPECT_DOUBLE_EQ(meshCopy->getBoundingBox().MinX, 0.0);
+    EXPECT_DOUBLE_EQ(prop.getBoundingBox().MinX, 1.0);
+
+    prop.Paste(*meshCopy);
+    EXPECT_EQ(meshCopy->getValuePtr(), prop.getValuePtr());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
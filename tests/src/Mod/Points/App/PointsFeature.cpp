@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
+#include <memory>
 #include <src/App/InitApplication.h>
+#include <Base/Interpreter.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PointsPy.h>
 
 class PointsFeatureTest: public ::testing::Test
 {
@@ -33,4 +36,29 @@ TEST_F(PointsFeatureTest, getComplexElementTypes)
 
     EXPECT_EQ(types.size(), 0);
 }
+
+TEST_F(PointsFeatureTest, pythonObjectFollowsCopyOnWrite)
+{
+    Points::PropertyPointKernel prop;
+    Points::PointKernel kernel;
+    kernel.push_back(Base::Vector3d(0, 0, 0));
+    prop.setValue(kernel);
+
+    Base::PyGILStateLocker lock;
+    Py::Object pyPoints(prop.getPyObject(), true);
+    auto points = static_cast<Points::PointsPy*>(pyPoints.ptr());
+
+    // Modifying the points while shared with a copy replaces them
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1, 0, 0));
+    prop.transformGeometry(mat);
+
+    EXPECT_EQ(points->getPointKernelPtr(), &prop.getValue());
+    EXPECT_DOUBLE_EQ(points->getPointKernelPtr()->getBoundBox().MinX, 1.0);
+
+    prop.Paste(*copy);
+    EXPECT_EQ(points->getPointKernelPtr(), &prop.getValue());
+    EXPECT_DOUBLE_EQ(points->getPointKernelPtr()->getBoundBox().MinX, 0.0);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <Base/Exception.h>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsFilter.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsFilterTest: public ::testing::Test
+{
+protected:
+    // Creates a noisy 20x20 plane at the height z = 5 with a few points far above
+    static Points::PointKernel makeScan(std::size_t count, std::size_t outliers)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(-10.0, 10.0);
+        Points::PointKernel kernel;
+        kernel.reserve(count + outliers);
+        for (std::size_t i = 0; i < count; i++) {
+            kernel.push_back(Base::Vector3d(dist(gen), dist(gen), 5.0 + 0.0001 * dist(gen)));
+        }
+        for (std::size_t i = 0; i < outliers; i++) {
+            kernel.push_back(Base::Vector3d(dist(gen), dist(gen), 50.0 + dist(gen)));
+        }
+        return kernel;
+    }
+};
+
+TEST_F(PointsFilterTest, TestVoxelGrid)
+{
+    Points::PointKernel kernel;
+    kernel.push_back(Base::Vector3d(0.1, 0.1, 0.1));
+    kernel.push_back(Base::Vector3d(0.3, 0.3, 0.3));
+    kernel.push_back(Base::Vector3d(1.5, 0.1, 0.1));
+    kernel.push_back(Base::Vector3d(1.7, 0.3, 0.1));
+    kernel.push_back(Base::Vector3d(1.6, 1.6, 1.6));
+
+    Points::PointsFilter filter(kernel);
+    Points::PointKernel result = filter.voxelGrid(Base::Vector3d(1.0, 1.0, 1.0));
+    EXPECT_EQ(result.size(), 3);
+    EXPECT_EQ(result.getPoint(0), Base::Vector3d(0.2, 0.2, 0.2));
+    EXPECT_EQ(result.getPoint(1), Base::Vector3d(1.6, 0.2, 0.1));
+    EXPECT_EQ(result.getPoint(2), Base::Vector3d(1.6, 1.6, 1.6));
+
+    EXPECT_THROW(filter.voxelGrid(Base::Vector3d(0.0, 1.0, 1.0)), Base::ValueError);
+}
+
+TEST_F(PointsFilterTest, TestOutlierRemoval)
+{
+    Points::PointKernel kernel = makeScan(10000, 20);
+    Points::PointsFilter filter(kernel);
+    std::vector<std::size_t> inliers = filter.statisticalOutlierRemoval(8, 1.0);
+    EXPECT_GT(inliers.size(), 9000);
+    EXPECT_TRUE(std::all_of(inliers.begin(), inliers.end(), [](std::size_t index) {
+        return index < 10000;
+    }));
+}
+
+TEST_F(PointsFilterTest, TestNormalEstimation)
+{
+    Points::PointKernel kernel = makeScan(10000, 0);
+    Points::PointsFilter filter(kernel);
+
+    auto byNeighbours = filter.normalEstimation(10, 0.0);
+    auto byRadius = filter.normalEstimation(0, 0.5);
+    for (const auto& normals : {byNeighbours, byRadius}) {
+        EXPECT_EQ(normals.size(), kernel.size());
+        // all normals point towards the origin
+        EXPECT_TRUE(std::all_of(normals.begin(), normals.end(), [](const Base::Vector3d& normal) {
+            return normal.z < -0.99;
+        }));
+    }
+
+    EXPECT_THROW(filter.normalEstimation(0, 0.0), Base::ValueError);
+}
+
+TEST_F(PointsFilterTest, TestNonFinite)
+{
+    Points::PointKernel kernel = makeScan(2000, 10);
+    Points::PointKernel invalid = kernel;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    invalid.push_back(Base::Vector3d(nan, nan, nan));
+    invalid.push_back(Base::Vector3d(std::numeric_limits<double>::infinity(), 0.0, 5.0));
+
+    // the invalid points are removed and don't change the result for the other ones
+    Points::PointsFilter filter(kernel);
+    Points::PointsFilter invalidFilter(invalid);
+    EXPECT_EQ(invalidFilter.statisticalOutlierRemoval(8, 1.0),
+              filter.statisticalOutlierRemoval(8, 1.0));
+
+    // the invalid points get a NaN normal
+    auto normals = filter.normalEstimation(10, 0.0);
+    auto invalidNormals = invalidFilter.normalEstimation(10, 0.0);
+    ASSERT_EQ(invalidNormals.size(), invalid.size());
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_EQ(invalidNormals[i], normals[i]);
+    }
+    for (std::size_t i = normals.size(); i < invalidNormals.size(); i++) {
+        EXPECT_TRUE(std::isnan(invalidNormals[i].x));
+    }
+
+    // the invalid points neither add voxels nor extend the grid
+    Base::Vector3d leafSize(1.0, 1.0, 1.0);
+    Points::PointKernel voxels = filter.voxelGrid(leafSize);
+    Points::PointKernel invalidVoxels = invalidFilter.voxelGrid(leafSize);
+    ASSERT_EQ(invalidVoxels.size(), voxels.size());
+    for (std::size_t i = 0; i < voxels.size(); i++) {
+        EXPECT_EQ(invalidVoxels.getPoint(int(i)), voxels.getPoint(int(i)));
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
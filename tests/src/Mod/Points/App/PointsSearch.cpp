@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <set>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsSearch.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsSearchTest: public ::testing::Test
+{
+protected:
+    // Creates random points in a box, optionally flattened to a plane
+    static std::vector<Base::Vector3d> makePoints(std::size_t count, double height)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(-10.0, 10.0);
+        std::vector<Base::Vector3d> points;
+        points.reserve(count);
+        for (std::size_t i = 0; i < count; i++) {
+            points.emplace_back(dist(gen), dist(gen), height * dist(gen));
+        }
+        return points;
+    }
+
+    // Brute force k nearest neighbours
+    static std::vector<double> bruteForce(const std::vector<Base::Vector3d>& points,
+                                          const Base::Vector3d& point,
+                                          std::size_t k)
+    {
+        std::vector<double> distances;
+        for (const auto& it : points) {
+            distances.push_back(Base::DistanceP2(it, point));
+        }
+        std::sort(distances.begin(), distances.end());
+        distances.resize(std::min(k, distances.size()));
+        return distances;
+    }
+};
+
+TEST_F(PointsSearchTest, TestEmpty)
+{
+    Points::PointsSearch search(std::vector<Base::Vector3d> {});
+    std::vector<std::size_t> indices;
+    std::vector<double> distances;
+    EXPECT_EQ(search.nearest(Base::Vector3d(), 5, indices, distances), 0);
+    EXPECT_EQ(search.radius(Base::Vector3d(), 1.0, indices, distances), 0);
+
+    std::size_t index {};
+    double distance {};
+    EXPECT_FALSE(search.nearest(Base::Vector3d(), index, distance));
+}
+
+TEST_F(PointsSearchTest, TestNearest)
+{
+    for (double height : {1.0, 0.0}) {
+        std::vector<Base::Vector3d> points = makePoints(2000, height);
+        Points::PointsSearch search(points);
+
+        std::vector<Base::Vector3d> queries = makePoints(50, 2.0);
+        queries.emplace_back(100.0, 0.0, 0.0);
+        queries.emplace_back(-30.0, 50.0, 20.0);
+        for (const auto& point : queries) {
+            std::vector<std::size_t> indices;
+            std::vector<double> distances;
+            EXPECT_EQ(search.nearest(point, 10, indices, distances), 10);
+            std::vector<double> expected = bruteForce(points, point, 10);
+            for (std::size_t i = 0; i < 10; i++) {
+                EXPECT_DOUBLE_EQ(distances[i], expected[i]);
+                EXPECT_DOUBLE_EQ(Base::DistanceP2(points[indices[i]], point), distances[i]);
+            }
+        }
+    }
+}
+
+TEST_F(PointsSearchTest, TestNearestAll)
+{
+    std::vector<Base::Vector3d> points = makePoints(20, 1.0);
+    Points::PointsSearch search(points);
+    std::vector<std::size_t> indices;
+    std::vector<double> distances;
+    EXPECT_EQ(search.nearest(Base::Vector3d(), 50, indices, distances), 20);
+    std::set<std::size_t> unique(indices.begin(), indices.end());
+    EXPECT_EQ(unique.size(), 20);
+}
+
+TEST_F(PointsSearchTest, TestRadius)
+{
+    std::vector<Base::Vector3d> points = makePoints(2000, 1.0);
+    Points::PointsSearch search(points);
+
+    for (const auto& point : makePoints(50, 1.0)) {
+        std::vector<std::size_t> indices;
+        std::vector<double> distances;
+        std::size_t count = search.radius(point, 2.0, indices, distances);
+        std::size_t expected = std::count_if(points.begin(), points.end(), [&point](auto& it) {
+            return Base::DistanceP2(it, point) <= 4.0;
+        });
+        EXPECT_EQ(count, expected);
+        EXPECT_TRUE(std::is_sorted(distances.begin(), distances.end()));
+    }
+}
+
+TEST_F(PointsSearchTest, TestKernel)
+{
+    Points::PointKernel kernel;
+    kernel.push_back(Base::Vector3d(0, 0, 0));
+    kernel.push_back(Base::Vector3d(1, 0, 0));
+    kernel.push_back(Base::Vector3d(5, 0, 0));
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(0, 0, 10));
+    kernel.setTransform(mat);
+
+    Points::PointsSearch search(kernel);
+    std::size_t index {};
+    double distance {};
+    EXPECT_TRUE(search.nearest(Base::Vector3d(4, 0, 10), index, distance));
+    EXPECT_EQ(index, 2);
+    EXPECT_DOUBLE_EQ(distance, 1.0);
+
+    search.addPoints({Base::Vector3d(4, 0, 10)});
+    search.rebuild();
+    EXPECT_TRUE(search.nearest(Base::Vector3d(4, 0, 10), index, distance));
+    EXPECT_EQ(index, 3);
+    EXPECT_DOUBLE_EQ(distance, 0.0);
+}
+
+TEST_F(PointsSearchTest, TestNonFinite)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<Base::Vector3d> points = makePoints(200, 1.0);
+    points.insert(points.begin(), Base::Vector3d(nan, nan, nan));
+    points.emplace_back(inf, 0.0, 0.0);
+    points.emplace_back(0.0, nan, 0.0);
+    Points::PointsSearch search(points);
+    EXPECT_EQ(search.size(), points.size());
+
+    // the non-finite points are never found and don't block the other ones
+    std::vector<Base::Vector3d> finite(points.begin() + 1, points.end() - 2);
+    for (const auto& point : makePoints(20, 2.0)) {
+        std::vector<std::size_t> indices;
+        std::vector<double> distances;
+        EXPECT_EQ(search.nearest(point, 5, indices, distances), 5);
+        std::vector<double> expected = bruteForce(finite, point, 5);
+        for (std::size_t i = 0; i < 5; i++) {
+            EXPECT_DOUBLE_EQ(distances[i], expected[i]);
+            EXPECT_DOUBLE_EQ(Base::DistanceP2(points[indices[i]], point), distances[i]);
+        }
+
+        search.radius(point, 100.0, indices, distances);
+        EXPECT_EQ(indices.size(), finite.size());
+        EXPECT_EQ(std::count(indices.begin(), indices.end(), 0), 0);
+    }
+
+    // nothing is found for a non-finite query point
+    std::size_t index {};
+    double distance {};
+    EXPECT_FALSE(search.nearest(Base::Vector3d(nan, 0.0, 0.0), index, distance));
+    std::vector<std::size_t> indices;
+    std::vector<double> distances;
+    EXPECT_EQ(search.nearest(Base::Vector3d(0.0, 0.0, inf), 5, indices, distances), 0);
+    EXPECT_EQ(search.radius(Base::Vector3d(0.0, nan, 0.0), 30.0, indices, distances), 0);
+    EXPECT_EQ(search.nearest(Base::Vector3d(), points.size(), indices, distances), finite.size());
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
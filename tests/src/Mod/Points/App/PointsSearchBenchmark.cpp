@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+
+#include <QtConcurrentMap>
+
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsGrid.h>
+#include <Mod/Points/App/PointsSearch.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+// Compares the PointsSearch index with the PointsGrid for building and nearest point queries.
+// This is not a test, it is built with ENABLE_DEVELOPER_BENCHMARKS and run by hand from a
+// release build.
+class PointsSearchBenchmark: public ::testing::Test
+{
+protected:
+    // Creates random points in a box
+    static Points::PointKernel makePoints(std::size_t count, unsigned int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> dist(-100.0, 100.0);
+        Points::PointKernel kernel;
+        kernel.reserve(count);
+        for (std::size_t i = 0; i < count; i++) {
+            kernel.push_back(Base::Vector3d(dist(gen), dist(gen), dist(gen)));
+        }
+        return kernel;
+    }
+
+    template<typename Func>
+    static long measure(Func&& func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    }
+};
+
+TEST_F(PointsSearchBenchmark, nearest)
+{
+    constexpr std::size_t queries = 100000;
+    Points::PointKernel query = makePoints(queries, 7);
+
+    for (std::size_t count : {10000UL, 100000UL, 1000000UL}) {
+        Points::PointKernel kernel = makePoints(count, 42);
+
+        std::unique_ptr<Points::PointsGrid> grid;
+        long gridBuild = measure([&]() {
+            grid = std::make_unique<Points::PointsGrid>(kernel);
+        });
+        std::unique_ptr<Points::PointsSearch> search;
+        long searchBuild = measure([&]() {
+            search = std::make_unique<Points::PointsSearch>(kernel);
+        });
+
+        // The grid only returns the candidates of the nearest non-empty cells
+        std::vector<std::size_t> gridResult(queries);
+        long gridNearest = measure([&]() {
+            std::set<unsigned long> candidates;
+            for (std::size_t i = 0; i < queries; i++) {
+                grid->SearchNearestFromPoint(query.getPoint(i), candidates);
+                double best = std::numeric_limits<double>::max();
+                for (unsigned long index : candidates) {
+                    double dist = Base::DistanceP2(kernel.getPoint(index), query.getPoint(i));
+                    if (dist < best) {
+                        best = dist;
+                        gridResult[i] = index;
+                    }
+                }
+            }
+        });
+
+        std::vector<std::size_t> searchResult(queries);
+        long searchNearest = measure([&]() {
+            for (std::size_t i = 0; i < queries; i++) {
+                double distance {};
+                search->nearest(query.getPoint(i), searchResult[i], distance);
+            }
+        });
+
+        std::vector<std::size_t> order(queries);
+        std::iota(order.begin(), order.end(), 0);
+        long searchKnn = measure([&]() {
+            QtConcurrent::blockingMap(order, [&](std::size_t& i) {
+                std::vector<std::size_t> indices;
+                std::vector<double> distances;
+                search->nearest(query.getPoint(i), 8, indices, distances);
+            });
+        });
+        long searchRadius = measure([&]() {
+            QtConcurrent::blockingMap(order, [&](std::size_t& i) {
+                std::vector<std::size_t> indices;
+                std::vector<double> distances;
+                search->radius(query.getPoint(i), 2.0, indices, distances);
+            });
+        });
+
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < queries; i++) {
+            if (Base::DistanceP2(kernel.getPoint(gridResult[i]), query.getPoint(i))
+                < Base::DistanceP2(kernel.getPoint(searchResult[i]), query.getPoint(i))) {
+                mismatches++;
+            }
+        }
+        EXPECT_EQ(mismatches, 0);
+
+        std::cout << count << " points, " << queries << " queries: build grid " << gridBuild
+                  << " ms, search " << searchBuild << " ms; nearest grid " << gridNearest
+                  << " ms, search " << searchNearest << " ms; parallel 8 nearest " << searchKnn
+                  << " ms, radius " << searchRadius << " ms" << std::endl;
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <string>
+
+#include <App/Document.h>
+#include <App/PropertyPythonObject.h>
+#include <App/PropertyStandard.h>
+#include <Base/Interpreter.h>
+#include <Mod/Spreadsheet/App/Cell.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = static_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet"));
+    }
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+    void setCell(char column, int row, const std::string& content)
+    {
+        std::string address = column + std::to_string(row);
+        _sheet->setCell(address.c_str(), content.c_str());
+    }
+
+    template<typename T>
+    T* getCellProperty(char column, int row)
+    {
+        std::string address = column + std::to_string(row);
+        return dynamic_cast<T*>(_sheet->getPropertyByName(address.c_str()));
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetTest, recomputeIndependentCells)  // NOLINT
+{
+    // Enough cells per dependency level for the parallel native evaluation,
+    // mixed with cells that need Python
+    const int rows = 100;
+    setCell('A', 1, "2");
+    for (int row = 1; row <= rows; ++row) {
+        std::string ref = "B" + std::to_string(row);
+        setCell('B', row, "=A1 * " + std::to_string(row));
+        setCell('C', row, "=" + ref + " * 1.5 mm");
+        setCell('D', row, "=" + ref + " > 100");
+        setCell('E', row, "=" + ref + " / 4");
+        setCell('F', row, "=str(" + ref + ")");
+    }
+    doc()->recompute();
+
+    for (int row = 1; row <= rows; ++row) {
+        auto intProp = getCellProperty<App::PropertyInteger>('B', row);
+        ASSERT_NE(intProp, nullptr);
+        EXPECT_EQ(intProp->getValue(), 2 * row);
+        auto quantityProp = getCellProperty<Spreadsheet::PropertySpreadsheetQuantity>('C', row);
+        ASSERT_NE(quantityProp, nullptr);
+        EXPECT_DOUBLE_EQ(quantityProp->getValue(), 3.0 * row);
+        auto boolProp = getCellProperty<App::PropertyPythonObject>('D', row);
+        ASSERT_NE(boolProp, nullptr);
+        {
+            Base::PyGILStateLocker lock;
+            EXPECT_EQ(boolProp->getValue().isTrue(), 2 * row > 100);
+        }
+        if (row % 2 == 0) {
+            EXPECT_NE(getCellProperty<App::PropertyInteger>('E', row), nullptr);
+        }
+        else {
+            EXPECT_NE(getCellProperty<App::PropertyFloat>('E', row), nullptr);
+        }
+        auto stringProp = getCellProperty<App::PropertyString>('F', row);
+        ASSERT_NE(stringProp, nullptr);
+        EXPECT_EQ(std::string(stringProp->getValue()), std::to_string(2 * row));
+    }
+
+    setCell('A', 1, "3");
+    doc()->recompute();
+    EXPECT_EQ(getCellProperty<App::PropertyInteger>('B', rows)->getValue(), 3 * rows);
+    EXPECT_DOUBLE_EQ(getCellProperty<Spreadsheet::PropertySpreadsheetQuantity>('C', rows)->getValue(),
+                     4.5 * rows);
+}
+
+TEST_F(SheetTest, recomputeCyclicDependency)  // NOLINT
+{
+    setCell('A', 1, "=B1 + 1");
+    setCell('B', 1, "=A1 + 1");
+    setCell('C', 1, "=5");
+    doc()->recompute();
+
+    EXPECT_TRUE(sheet()->getCell(App::CellAddress("A1"))->hasException());
+    EXPECT_TRUE(sheet()->getCell(App::CellAddress("B1"))->hasException());
+    EXPECT_FALSE(sheet()->getCell(App::CellAddress("C1"))->hasException());
+}
+
+TEST_F(SheetTest, recomputeCellsReadingOtherObjects)  // NOLINT
+{
+    // A plain C++ object is read in parallel, one with a Python proxy is read
+    // on the main thread only
+    auto other = static_cast<Spreadsheet::Sheet*>(doc()->addObject("Spreadsheet::Sheet", "Other"));
+    other->setCell("A1", "2");
+    auto feature = doc()->addObject("App::FeaturePython", "Feature");
+    auto value = static_cast<App::PropertyInteger*>(
+        feature->addDynamicProperty("App::PropertyInteger", "Value"));
+    value->setValue(3);
+
+    const int rows = 100;
+    for (int row = 1; row <= rows; ++row) {
+        setCell('A', row, "=Other.A1 * " + std::to_string(row));
+        setCell('B', row, "=Feature.Value * " + std::to_string(row));
+    }
+    doc()->recompute();
+
+    for (int row = 1; row <= rows; ++row) {
+        auto otherProp = getCellProperty<App::PropertyInteger>('A', row);
+        ASSERT_NE(otherProp, nullptr);
+        EXPECT_EQ(otherProp->getValue(), 2 * row);
+        auto featureProp = getCellProperty<App::PropertyInteger>('B', row);
+        ASSERT_NE(featureProp, nullptr);
+        EXPECT_EQ(featureProp->getValue(), 3 * row);
+    }
+}